@@ -0,0 +1,28 @@
+#pragma once
+
+#include <chrono>
+#include <cstdio>
+
+// Runs `fn` once to warm up, then `iters` times, and returns the mean wall
+// time of one call in microseconds.
+template <typename Fn> double bench_us(Fn &&fn, const int iters) {
+  fn();
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < iters; i++) {
+    fn();
+  }
+  auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::micro>(end - start).count() / iters;
+}
+
+inline void bench_header(const char *title) {
+  std::printf("\n%s\n", title);
+  std::printf("%-28s %12s %12s %9s %10s\n", "shape", "direct(us)", "im2col(us)",
+              "speedup", "GFLOP/s");
+}
+
+inline void bench_row(const char *shape, const double direct_us,
+                      const double im2col_us, const double flops) {
+  std::printf("%-28s %12.1f %12.1f %8.2fx %10.2f\n", shape, direct_us,
+              im2col_us, direct_us / im2col_us, flops / (im2col_us * 1e3));
+}
@@ -0,0 +1,116 @@
+#include "./bench.hh"
+#include <memory>
+#include <vhn.hh>
+
+// Direct vs im2col + blocked-GEMM convolution on the host, swept over kernel
+// sizes and channel counts.
+
+namespace {
+
+using gemm_config = vhn::LinearConfig<4, 4, 32, 64, false>;
+
+template <int IC, int OC, int K, int SIZE> void bench_conv2d(const int iters) {
+  using hparams = vhn::Conv2dHParams<IC, OC, K, K / 2, SIZE, SIZE>;
+  using direct_t =
+      vhn::Conv2d<float, hparams,
+                  vhn::Conv2dConfig<true, 1, 1, 4, 1, 1, vhn::CONV2D_DIRECT>,
+                  OPT_ENABLED>;
+  using im2col_t = vhn::Conv2d<
+      float, hparams,
+      vhn::Conv2dConfig<true, 1, 1, 4, 1, 1, vhn::CONV2D_IM2COL, gemm_config>,
+      OPT_ENABLED>;
+
+  struct Buffers {
+    typename direct_t::Input_t input;
+    typename direct_t::Weight_t weight;
+    typename direct_t::Bias_t bias;
+    typename direct_t::Output_t output;
+  };
+  auto buf = std::make_unique<Buffers>();
+
+  BaseTestCase generator;
+  generator.generate_random_array(&buf->input[0][0][0], IC * SIZE * SIZE);
+  generator.generate_random_array(&buf->weight[0][0][0][0], OC * IC * K * K);
+  generator.generate_random_array(buf->bias, OC);
+
+  double direct_us = bench_us(
+      [&] {
+        direct_t::conv2d(buf->output, buf->input, buf->weight, buf->bias);
+      },
+      iters);
+  double im2col_us = bench_us(
+      [&] {
+        im2col_t::conv2d(buf->output, buf->input, buf->weight, buf->bias);
+      },
+      iters);
+
+  char shape[64];
+  std::snprintf(shape, sizeof(shape), "ic=%d oc=%d k=%d %dx%d", IC, OC, K,
+                SIZE, SIZE);
+  double flops = 2.0 * OC * IC * K * K * direct_t::out_width *
+                 direct_t::out_height;
+  bench_row(shape, direct_us, im2col_us, flops);
+}
+
+template <int IC, int OC, int K, int N> void bench_conv1d(const int iters) {
+  using hparams = vhn::Conv1dHParams<IC, OC, K, K / 2, N>;
+  using direct_t =
+      vhn::Conv1d<float, hparams,
+                  vhn::Conv1dConfig<true, 1, 1, 4, 1, 1, vhn::CONV1D_DIRECT>,
+                  OPT_ENABLED>;
+  using im2col_t = vhn::Conv1d<
+      float, hparams,
+      vhn::Conv1dConfig<true, 1, 1, 4, 1, 1, vhn::CONV1D_IM2COL, gemm_config>,
+      OPT_ENABLED>;
+
+  struct Buffers {
+    typename direct_t::Input_t input;
+    typename direct_t::Weight_t weight;
+    typename direct_t::Bias_t bias;
+    typename direct_t::Output_t output;
+  };
+  auto buf = std::make_unique<Buffers>();
+
+  BaseTestCase generator;
+  generator.generate_random_array(&buf->input[0][0], IC * N);
+  generator.generate_random_array(&buf->weight[0][0][0], OC * IC * K);
+  generator.generate_random_array(buf->bias, OC);
+
+  double direct_us = bench_us(
+      [&] {
+        direct_t::conv1d(buf->output, buf->input, buf->weight, buf->bias);
+      },
+      iters);
+  double im2col_us = bench_us(
+      [&] {
+        im2col_t::conv1d(buf->output, buf->input, buf->weight, buf->bias);
+      },
+      iters);
+
+  char shape[64];
+  std::snprintf(shape, sizeof(shape), "ic=%d oc=%d k=%d n=%d", IC, OC, K, N);
+  double flops = 2.0 * OC * IC * K * direct_t::out_length;
+  bench_row(shape, direct_us, im2col_us, flops);
+}
+
+} // namespace
+
+int main() {
+  bench_header("Conv2d");
+  bench_conv2d<16, 16, 1, 32>(20);
+  bench_conv2d<16, 16, 3, 32>(20);
+  bench_conv2d<16, 16, 5, 32>(10);
+  bench_conv2d<64, 64, 1, 32>(10);
+  bench_conv2d<64, 64, 3, 32>(5);
+  bench_conv2d<64, 64, 5, 32>(3);
+  bench_conv2d<128, 128, 3, 16>(5);
+
+  bench_header("Conv1d");
+  bench_conv1d<16, 16, 3, 256>(50);
+  bench_conv1d<16, 16, 7, 256>(50);
+  bench_conv1d<64, 64, 3, 256>(20);
+  bench_conv1d<64, 64, 7, 256>(20);
+  bench_conv1d<256, 256, 3, 128>(5);
+
+  return 0;
+}
@@ -0,0 +1,101 @@
+#include "./bench.hh"
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <random>
+#include <vector>
+#include <vhn.hh>
+
+// Host embedding gather on Zipf-distributed token IDs: the plain
+// row-by-row copy against the batched gather with prefetch and / or
+// in-batch deduplication, for tables far larger than the last-level cache.
+
+namespace {
+
+constexpr int kVocab = 250000;
+
+std::vector<int> zipf_tokens(const int count, const double s,
+                             const unsigned seed) {
+  std::vector<double> cdf(kVocab);
+  double total = 0.0;
+  for (int r = 0; r < kVocab; r++) {
+    total += 1.0 / std::pow(r + 1.0, s);
+    cdf[r] = total;
+  }
+  // Scatter ranks over the table so hot rows are not adjacent.
+  std::vector<int> row_of_rank(kVocab);
+  for (int r = 0; r < kVocab; r++) {
+    row_of_rank[r] = static_cast<int>((r * 2654435761u) % kVocab);
+  }
+
+  std::mt19937 rng(seed);
+  std::uniform_real_distribution<double> uniform(0.0, total);
+  std::vector<int> tokens(count);
+  for (auto &t : tokens) {
+    const int rank = static_cast<int>(
+        std::lower_bound(cdf.begin(), cdf.end(), uniform(rng)) - cdf.begin());
+    t = row_of_rank[std::min(rank, kVocab - 1)];
+  }
+  return tokens;
+}
+
+template <int EMBED> void bench_gather(const double s, const int iters) {
+  constexpr int kBatch = 4096;
+  using hparams = vhn::EmbeddingHParams<kVocab, EMBED>;
+  using plain_t = vhn::Embedding<float, hparams,
+                                 vhn::EmbeddingConfig<1, 1, 1>, OPT_ENABLED>;
+  using prefetch_t =
+      vhn::Embedding<float, hparams, vhn::EmbeddingConfig<1, 1, 1, 8, 0>,
+                     OPT_ENABLED>;
+  using dedup_t =
+      vhn::Embedding<float, hparams, vhn::EmbeddingConfig<1, 1, 1, 0, 1024>,
+                     OPT_ENABLED>;
+  using both_t =
+      vhn::Embedding<float, hparams, vhn::EmbeddingConfig<1, 1, 1, 8, 1024>,
+                     OPT_ENABLED>;
+
+  struct Buffers {
+    typename plain_t::Weight_t weight;
+    float output[kBatch * EMBED];
+  };
+  auto buf = std::make_unique<Buffers>();
+  BaseTestCase generator;
+  generator.generate_random_array(&buf->weight[0][0], kVocab * EMBED);
+
+  // A fresh batch per call keeps the previous batch's rows from being warm.
+  constexpr int kBatches = 16;
+  const auto tokens = zipf_tokens(kBatch * kBatches, s, 7);
+  int next = 0;
+  auto run = [&](auto kernel) {
+    return bench_us(
+        [&] {
+          kernel.emb(buf->output, &tokens[(next++ % kBatches) * kBatch],
+                     kBatch, buf->weight);
+        },
+        iters);
+  };
+
+  const double plain_us = run(plain_t());
+  const double prefetch_us = run(prefetch_t());
+  const double dedup_us = run(dedup_t());
+  const double both_us = run(both_t());
+
+  char shape[32];
+  std::snprintf(shape, sizeof(shape), "embed=%d s=%.1f", EMBED, s);
+  std::printf("%-20s %10.1f %10.1f %10.1f %10.1f %8.2fx\n", shape, plain_us,
+              prefetch_us, dedup_us, both_us, plain_us / both_us);
+}
+
+} // namespace
+
+int main() {
+  std::printf("\nEmbedding gather, vocab %d, batch 4096 (us per batch)\n",
+              kVocab);
+  std::printf("%-20s %10s %10s %10s %10s %9s\n", "embed / zipf", "plain",
+              "prefetch", "dedup", "both", "speedup");
+  bench_gather<64>(0.8, 50);
+  bench_gather<64>(1.1, 50);
+  bench_gather<256>(0.8, 20);
+  bench_gather<256>(1.1, 20);
+  return 0;
+}
@@ -0,0 +1,52 @@
+#include "./bench.hh"
+#include <memory>
+#include <vhn.hh>
+
+// Row reductions on the host: the sequential reference (one dependent
+// accumulator) against the OPT_ENABLED multi-accumulator path.
+
+namespace {
+
+using host_config = vhn::ReduceConfig<1, 4, 4, true>;
+
+template <int N> void bench_reduce(const int iters) {
+  constexpr int kRows = 256;
+  using sum_ref_t = vhn::ReduceSum<float, N>;
+  using sum_opt_t = vhn::ReduceSum<float, N, host_config, OPT_ENABLED>;
+  using max_ref_t = vhn::ReduceMax<float, N>;
+  using max_opt_t = vhn::ReduceMax<float, N, host_config, OPT_ENABLED>;
+
+  struct Buffers {
+    float input[kRows][N];
+    float output[kRows];
+  };
+  auto buf = std::make_unique<Buffers>();
+  BaseTestCase generator;
+  generator.generate_random_array(&buf->input[0][0], kRows * N);
+
+  auto run = [&](auto kernel) {
+    return bench_us([&] { kernel.reduce(buf->output, buf->input, kRows); },
+                    iters);
+  };
+
+  const double sum_ref_us = run(sum_ref_t());
+  const double sum_opt_us = run(sum_opt_t());
+  const double max_ref_us = run(max_ref_t());
+  const double max_opt_us = run(max_opt_t());
+
+  std::printf("%-8d %10.1f %10.1f %8.2fx %10.1f %10.1f %8.2fx\n", N,
+              sum_ref_us, sum_opt_us, sum_ref_us / sum_opt_us, max_ref_us,
+              max_opt_us, max_ref_us / max_opt_us);
+}
+
+} // namespace
+
+int main() {
+  std::printf("\nReduce, 256 rows (us per call)\n");
+  std::printf("%-8s %10s %10s %9s %10s %10s %9s\n", "n", "sum ref",
+              "sum opt", "speedup", "max ref", "max opt", "speedup");
+  bench_reduce<64>(200);
+  bench_reduce<768>(100);
+  bench_reduce<4096>(20);
+  return 0;
+}
@@ -1,7 +1,11 @@
 #pragma once
 
 // Common
+#include "./vhn/layout.hh"
+#include "./vhn/mapped_tensor.hh"
 #include "./vhn/opt_level.hh"
+#include "./vhn/quant.hh"
+#include "./vhn/stream.hh"
 #include "./vhn/types.hh"
 
 // Operators
@@ -12,11 +12,11 @@ public:
   using dtype = DType;
   static constexpr int n = N;
 
-  static void kernel(dtype output, const dtype input) {
+  static dtype kernel(const dtype input) {
 #ifdef __VITIS_HLS__
-    output = dtype(1.0f) / (dtype(1.0f) + hls::exp(-input));
+    return dtype(1.0f) / (dtype(1.0f) + hls::exp(-input));
 #else
-    output = dtype(1.0f) / (dtype(1.0f) + std::exp(-input));
+    return dtype(1.0f) / (dtype(1.0f) + std::exp(-input));
 #endif
   }
 };
@@ -73,8 +73,16 @@ private:
 
     auto &registry = LayerRegistry::instance();
 
+    json modules = config["modules"];
+    if (config["model"].value("fold_bn", false)) {
+      modules = fold_batchnorm(modules);
+    }
+    if (config["model"].value("fuse_epilogue", false)) {
+      modules = fuse_conv_epilogue(modules);
+    }
+
     // dfs
-    for (const auto &module : config["modules"]) {
+    for (const auto &module : modules) {
       generate_module_recursive(out, module, module.value("name", "module"),
                                 dtype, registry);
     }
@@ -84,8 +92,7 @@ private:
     out << "  constexpr const char* name = \""
         << config["model"].value("name", "Network") << "\";\n";
     out << "  constexpr const char* dtype = \"" << dtype << "\";\n";
-    out << "  constexpr int num_modules = " << config["modules"].size()
-        << ";\n";
+    out << "  constexpr int num_modules = " << modules.size() << ";\n";
     out << "}\n";
   }
 
@@ -106,8 +113,127 @@ private:
     out << generator->generate_config(name,
                                       module.value("hls_cfg", json::object()));
     out << generator->generate_type_alias(name, dtype, module);
+    if (module.contains("folded_bn")) {
+      out << "// " << module["folded_bn"].get<std::string>()
+          << " folded into " << name << "\n";
+      out << "using " << name << "_bn_fold = vhn::BatchNormFold<" << name
+          << "_t>;\n";
+    }
+    if (module.contains("fused_epilogue")) {
+      out << "// " << module["fused_epilogue"].get<std::string>()
+          << " fused into " << name << " epilogue\n";
+    }
     out << "\n";
   }
+
+  // Graph pass: drop every bn1d / bn2d module that directly follows a
+  // linear / conv1d / conv2d module. The producer is tagged with
+  // "folded_bn" so its BatchNormFold helper is emitted alongside it.
+  static json fold_batchnorm(const json &modules) {
+    json folded = json::array();
+
+    for (const auto &module : modules) {
+      std::string type = module.value("type", "");
+      bool is_bn = (type == "bn1d" || type == "bn2d");
+
+      if (is_bn && !folded.empty()) {
+        json &prev = folded.back();
+        std::string prev_type = prev.value("type", "");
+        std::string channel_key;
+
+        if (prev_type == "linear") {
+          channel_key = "out_features";
+        } else if (prev_type == "conv1d" || prev_type == "conv2d") {
+          channel_key = "out_channels";
+        }
+
+        if (!channel_key.empty() && !prev.contains("folded_bn")) {
+          auto prev_hparams = prev.value("hparams", json::object());
+          auto bn_hparams = module.value("hparams", json::object());
+          if (prev_hparams.value(channel_key, -1) !=
+              bn_hparams.value("channels", -2)) {
+            throw std::runtime_error(
+                "Cannot fold '" + module.value("name", "module") +
+                "' into '" + prev.value("name", "module") +
+                "': channel count mismatch");
+          }
+          prev["folded_bn"] = module.value("name", "module");
+          continue;
+        }
+      }
+
+      folded.push_back(module);
+    }
+
+    return folded;
+  }
+
+  // Graph pass: merge a conv2d with the bn2d and / or activation elementwise
+  // module that directly follow it into a single conv2d_fused module. The
+  // absorbed module names are recorded under "fused_epilogue".
+  static json fuse_conv_epilogue(const json &modules) {
+    json fused = json::array();
+
+    for (size_t i = 0; i < modules.size(); i++) {
+      const json &module = modules[i];
+      auto hls_cfg = module.value("hls_cfg", json::object());
+      if (module.value("type", "") != "conv2d" ||
+          hls_cfg.value("layout", std::string("nchw")) != "nchw") {
+        fused.push_back(module);
+        continue;
+      }
+
+      auto hparams = module.value("hparams", json::object());
+      auto epilogue = hparams.value("epilogue", json::object());
+      epilogue["batchnorm"] = false;
+      epilogue["activation"] = "none";
+      std::string absorbed;
+      size_t next = i + 1;
+
+      if (next < modules.size() && modules[next].value("type", "") == "bn2d" &&
+          !module.contains("folded_bn")) {
+        auto bn_hparams = modules[next].value("hparams", json::object());
+        if (hparams.value("out_channels", -1) !=
+            bn_hparams.value("channels", -2)) {
+          throw std::runtime_error(
+              "Cannot fuse '" + modules[next].value("name", "module") +
+              "' into '" + module.value("name", "module") +
+              "': channel count mismatch");
+        }
+        epilogue["batchnorm"] = true;
+        absorbed = modules[next].value("name", "module");
+        next++;
+      }
+
+      if (next < modules.size() &&
+          modules[next].value("type", "") == "elementwise") {
+        auto op = modules[next]
+                      .value("hparams", json::object())
+                      .value("op", std::string(""));
+        if (op == "relu" || op == "sigmoid" || op == "gelu") {
+          epilogue["activation"] = op;
+          absorbed += (absorbed.empty() ? "" : ", ") +
+                      modules[next].value("name", "module");
+          next++;
+        }
+      }
+
+      if (absorbed.empty()) {
+        fused.push_back(module);
+        continue;
+      }
+
+      json merged = module;
+      hparams["epilogue"] = epilogue;
+      merged["type"] = "conv2d_fused";
+      merged["hparams"] = hparams;
+      merged["fused_epilogue"] = absorbed;
+      fused.push_back(merged);
+      i = next - 1;
+    }
+
+    return fused;
+  }
 };
 
 } // namespace vhn
@@ -0,0 +1,350 @@
+#pragma once
+
+#include "../opt_level.hh"
+#include "../stream.hh"
+
+namespace vhn {
+
+template <typename DType, typename HParams, typename Config = void,
+          OptLevel OPT_LEVEL = OPT_NONE>
+class CausalConv1d;
+
+// Causal (left-padded) dilated Conv1d fed one CHUNK of timesteps per call.
+// y[t] only depends on x[t - j * DILATION], j = 0 .. KERNEL_SIZE - 1; the
+// (KERNEL_SIZE - 1) * DILATION samples preceding each chunk are carried
+// across calls in a CausalConv1dState ring buffer.
+template <int IN_CHANNELS, int OUT_CHANNELS, int KERNEL_SIZE, int CHUNK,
+          int DILATION = 1, int GROUPS = 1>
+struct CausalConv1dHParams {
+  static constexpr int in_channels = IN_CHANNELS;
+  static constexpr int out_channels = OUT_CHANNELS;
+  static constexpr int kernel_size = KERNEL_SIZE;
+  static constexpr int chunk = CHUNK;
+  static constexpr int dilation = DILATION;
+  static constexpr int groups = GROUPS;
+  static constexpr int history_length = (KERNEL_SIZE - 1) * DILATION;
+
+  static_assert(IN_CHANNELS % GROUPS == 0 && OUT_CHANNELS % GROUPS == 0,
+                "CausalConv1d channels must be divisible by groups");
+};
+
+// Per-stream history. `head` is the next slot to overwrite (i.e. the oldest
+// sample once the buffer is full); `filled` counts valid samples so the
+// first outputs see implicit zero padding exactly like Conv1d.
+template <typename DType, typename HParams> struct CausalConv1dState {
+  using dtype = DType;
+  static constexpr int in_channels = HParams::in_channels;
+  static constexpr int history_length = HParams::history_length;
+  static constexpr int buffer_length = history_length > 0 ? history_length : 1;
+
+  dtype history[in_channels][buffer_length];
+  int head;
+  int filled;
+
+  CausalConv1dState() { reset(); }
+
+  void reset() {
+  RESET_LOOP:
+    for (int ic = 0; ic < in_channels; ic++) {
+      for (int i = 0; i < buffer_length; i++) {
+        history[ic][i] = dtype(0.0f);
+      }
+    }
+    head = 0;
+    filled = 0;
+  }
+
+  // Sample `d` steps before the current chunk, 1 <= d <= filled.
+  dtype past(const int ic, const int d) const {
+    int idx = head - d;
+    if (idx < 0) {
+      idx += buffer_length;
+    }
+    return history[ic][idx];
+  }
+};
+
+// ============================================================================
+// Non-optimized version (OPT_NONE)
+// ============================================================================
+template <typename DType, typename HParams>
+class CausalConv1d<DType, HParams, void, OPT_NONE> {
+public:
+  using dtype = DType;
+  static constexpr int in_channels = HParams::in_channels;
+  static constexpr int out_channels = HParams::out_channels;
+  static constexpr int kernel_size = HParams::kernel_size;
+  static constexpr int chunk = HParams::chunk;
+  static constexpr int dilation = HParams::dilation;
+  static constexpr int groups = HParams::groups;
+  static constexpr int history_length = HParams::history_length;
+  static constexpr int in_channels_per_group = in_channels / groups;
+  static constexpr int out_channels_per_group = out_channels / groups;
+  static constexpr OptLevel opt_level = OPT_NONE;
+
+  using State = CausalConv1dState<DType, HParams>;
+  using Weight_t = dtype[out_channels][in_channels_per_group][kernel_size];
+  using Bias_t = dtype[out_channels];
+  using Input_t = dtype[in_channels][chunk];
+  using Output_t = dtype[out_channels][chunk];
+
+  CausalConv1d() = default;
+  ~CausalConv1d() = default;
+
+  static void conv1d(Output_t output, const Input_t input,
+                     const Weight_t weight, const Bias_t bias, State &state) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+    conv1d_chunk_impl(output, input, weight, bias, state);
+  }
+
+  // Timesteps arrive with channels innermost; outputs leave the same way,
+  // one chunk after another.
+  static void conv1d(stream<dtype> &output_stream, stream<dtype> &input_stream,
+                     const Weight_t weight, const Bias_t bias, State &state,
+                     const int num_chunks = 1) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+  CHUNK_LOOP:
+    for (int c = 0; c < num_chunks; c++) {
+      dtype input[in_channels][chunk];
+      dtype output[out_channels][chunk];
+    READ_INPUT:
+      for (int t = 0; t < chunk; t++) {
+        for (int ic = 0; ic < in_channels; ic++) {
+          input[ic][t] = input_stream.read();
+        }
+      }
+      conv1d_chunk_impl(output, input, weight, bias, state);
+    WRITE_OUTPUT:
+      for (int t = 0; t < chunk; t++) {
+        for (int oc = 0; oc < out_channels; oc++) {
+          output_stream.write(output[oc][t]);
+        }
+      }
+    }
+  }
+
+private:
+  static void conv1d_chunk_impl(dtype output[out_channels][chunk],
+                                const dtype input[in_channels][chunk],
+                                const Weight_t weight, const Bias_t bias,
+                                State &state) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+  TIME_LOOP:
+    for (int t = 0; t < chunk; t++) {
+    OUT_CHANNEL_LOOP:
+      for (int oc = 0; oc < out_channels; oc++) {
+        const int group_base =
+            (oc / out_channels_per_group) * in_channels_per_group;
+        dtype acc = dtype(0);
+      IN_CHANNEL_LOOP:
+        for (int icg = 0; icg < in_channels_per_group; icg++) {
+          const int ic = group_base + icg;
+        KERNEL_LOOP:
+          for (int k = 0; k < kernel_size; k++) {
+            const int offset = (kernel_size - 1 - k) * dilation;
+            if (offset <= t) {
+              acc += input[ic][t - offset] * weight[oc][icg][k];
+            } else if (offset - t <= state.filled) {
+              acc += state.past(ic, offset - t) * weight[oc][icg][k];
+            }
+          }
+        }
+        output[oc][t] = acc + bias[oc];
+      }
+    }
+
+    if constexpr (history_length > 0) {
+      // Only the newest history_length samples can be referenced again.
+      constexpr int first = (chunk > history_length) ? chunk - history_length
+                                                     : 0;
+    PUSH_LOOP:
+      for (int t = first; t < chunk; t++) {
+        for (int ic = 0; ic < in_channels; ic++) {
+          state.history[ic][state.head] = input[ic][t];
+        }
+        state.head = (state.head + 1 == history_length) ? 0 : state.head + 1;
+        if (state.filled < history_length) {
+          state.filled++;
+        }
+      }
+    }
+  }
+};
+
+template <int PIPELINE_II, int UNROLL_FACTOR, int PARTITION_FACTOR>
+struct CausalConv1dConfig {
+  static constexpr int pipeline_ii = PIPELINE_II;
+  static constexpr int unroll_factor = UNROLL_FACTOR;
+  static constexpr int partition_factor = PARTITION_FACTOR;
+};
+
+// ============================================================================
+// Optimized version (OPT_ENABLED)
+// ============================================================================
+// The per-output accumulation order (input channel, then tap) is the same as
+// in the OPT_NONE version and in Conv1d, so results are bit-identical for any
+// chunking of the sequence.
+template <typename DType, typename HParams, typename Config>
+class CausalConv1d<DType, HParams, Config, OPT_ENABLED> {
+public:
+  using dtype = DType;
+  static constexpr int in_channels = HParams::in_channels;
+  static constexpr int out_channels = HParams::out_channels;
+  static constexpr int kernel_size = HParams::kernel_size;
+  static constexpr int chunk = HParams::chunk;
+  static constexpr int dilation = HParams::dilation;
+  static constexpr int groups = HParams::groups;
+  static constexpr int history_length = HParams::history_length;
+  static constexpr int in_channels_per_group = in_channels / groups;
+  static constexpr int out_channels_per_group = out_channels / groups;
+  static constexpr OptLevel opt_level = OPT_ENABLED;
+
+  static constexpr int pipeline_ii = Config::pipeline_ii;
+  static constexpr int unroll_factor = Config::unroll_factor;
+  static constexpr int partition_factor = Config::partition_factor;
+
+  using State = CausalConv1dState<DType, HParams>;
+  using Weight_t = dtype[out_channels][in_channels_per_group][kernel_size];
+  using Bias_t = dtype[out_channels];
+  using Input_t = dtype[in_channels][chunk];
+  using Output_t = dtype[out_channels][chunk];
+
+  CausalConv1d() = default;
+  ~CausalConv1d() = default;
+
+  static void conv1d(Output_t output, const Input_t input,
+                     const Weight_t weight, const Bias_t bias, State &state) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+    conv1d_chunk_impl(output, input, weight, bias, state);
+  }
+
+  static void conv1d(stream<dtype> &output_stream, stream<dtype> &input_stream,
+                     const Weight_t weight, const Bias_t bias, State &state,
+                     const int num_chunks = 1) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+  CHUNK_LOOP:
+    for (int c = 0; c < num_chunks; c++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 4096
+#endif
+      dtype input[in_channels][chunk];
+      dtype output[out_channels][chunk];
+#ifdef __VITIS_HLS__
+      if constexpr (partition_factor > 1 && in_channels <= 512) {
+#pragma HLS ARRAY_PARTITION variable = input type = cyclic factor =            \
+    partition_factor dim = 1
+      }
+#endif
+    READ_INPUT:
+      for (int t = 0; t < chunk; t++) {
+        for (int ic = 0; ic < in_channels; ic++) {
+#ifdef __VITIS_HLS__
+#pragma HLS PIPELINE II = 1
+#endif
+          input[ic][t] = input_stream.read();
+        }
+      }
+      conv1d_chunk_impl(output, input, weight, bias, state);
+    WRITE_OUTPUT:
+      for (int t = 0; t < chunk; t++) {
+        for (int oc = 0; oc < out_channels; oc++) {
+#ifdef __VITIS_HLS__
+#pragma HLS PIPELINE II = 1
+#endif
+          output_stream.write(output[oc][t]);
+        }
+      }
+    }
+  }
+
+private:
+  static void conv1d_chunk_impl(dtype output[out_channels][chunk],
+                                const dtype input[in_channels][chunk],
+                                const Weight_t weight, const Bias_t bias,
+                                State &state) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+    if constexpr (partition_factor > 1 && in_channels <= 512) {
+#pragma HLS ARRAY_PARTITION variable = weight type = cyclic factor =           \
+    partition_factor dim = 2
+    }
+#pragma HLS ARRAY_PARTITION variable = weight type = complete dim = 3
+#endif
+    const int filled = state.filled;
+
+  TIME_LOOP:
+    for (int t = 0; t < chunk; t++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 256
+#endif
+    OUT_CHANNEL_LOOP:
+      for (int oc = 0; oc < out_channels; oc++) {
+#ifdef __VITIS_HLS__
+#pragma HLS PIPELINE II = pipeline_ii
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 512
+#endif
+        const int group_base =
+            (oc / out_channels_per_group) * in_channels_per_group;
+        dtype acc = dtype(0);
+      IN_CHANNEL_LOOP:
+        for (int icg = 0; icg < in_channels_per_group; icg++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 512
+          if constexpr (unroll_factor > 1) {
+#pragma HLS UNROLL factor = unroll_factor
+          }
+#endif
+          const int ic = group_base + icg;
+        KERNEL_LOOP:
+          for (int k = 0; k < kernel_size; k++) {
+#ifdef __VITIS_HLS__
+#pragma HLS UNROLL
+#endif
+            const int offset = (kernel_size - 1 - k) * dilation;
+            if (offset <= t) {
+              acc += input[ic][t - offset] * weight[oc][icg][k];
+            } else if (offset - t <= filled) {
+              acc += state.past(ic, offset - t) * weight[oc][icg][k];
+            }
+          }
+        }
+        output[oc][t] = acc + bias[oc];
+      }
+    }
+
+    if constexpr (history_length > 0) {
+      constexpr int first = (chunk > history_length) ? chunk - history_length
+                                                     : 0;
+      int head = state.head;
+    PUSH_LOOP:
+      for (int t = first; t < chunk; t++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 256
+#endif
+        for (int ic = 0; ic < in_channels; ic++) {
+#ifdef __VITIS_HLS__
+#pragma HLS PIPELINE II = 1
+#endif
+          state.history[ic][head] = input[ic][t];
+        }
+        head = (head + 1 == history_length) ? 0 : head + 1;
+      }
+      state.head = head;
+      state.filled = (filled + (chunk - first) < history_length)
+                         ? filled + (chunk - first)
+                         : history_length;
+    }
+  }
+};
+
+} // namespace vhn
@@ -1,6 +1,8 @@
 #pragma once
 
 #include "../opt_level.hh"
+#include "./fft.hh"
+#include "./linear.hh"
 
 #ifdef __VITIS_HLS__
 #include <hls_stream.h>
@@ -13,14 +15,21 @@ template <typename DType, typename HParams, typename Config = void,
 class Conv1d;
 
 template <int IN_CHANNELS, int OUT_CHANNELS, int KERNEL_SIZE, int PADDING,
-          int N>
+          int N, int STRIDE = 1, int DILATION = 1, int GROUPS = 1>
 struct Conv1dHParams {
   static constexpr int in_channels = IN_CHANNELS;
   static constexpr int out_channels = OUT_CHANNELS;
   static constexpr int kernel_size = KERNEL_SIZE;
   static constexpr int padding = PADDING;
   static constexpr int n = N;
-  static constexpr int out_length = N - KERNEL_SIZE + 1 + 2 * PADDING;
+  static constexpr int stride = STRIDE;
+  static constexpr int dilation = DILATION;
+  static constexpr int groups = GROUPS;
+  static constexpr int out_length =
+      (N + 2 * PADDING - DILATION * (KERNEL_SIZE - 1) - 1) / STRIDE + 1;
+
+  static_assert(IN_CHANNELS % GROUPS == 0 && OUT_CHANNELS % GROUPS == 0,
+                "Conv1d channels must be divisible by groups");
 };
 
 // ============================================================================
@@ -36,9 +45,15 @@ public:
   static constexpr int padding = HParams::padding;
   static constexpr int n = HParams::n;
   static constexpr int out_length = HParams::out_length;
+  static constexpr int stride = HParams::stride;
+  static constexpr int dilation = HParams::dilation;
+  static constexpr int groups = HParams::groups;
+  static constexpr int in_channels_per_group = in_channels / groups;
+  static constexpr int out_channels_per_group = out_channels / groups;
+  static constexpr bool depthwise = groups > 1 && in_channels_per_group == 1;
   static constexpr OptLevel opt_level = OPT_NONE;
 
-  using Weight_t = dtype[out_channels][in_channels][kernel_size];
+  using Weight_t = dtype[out_channels][in_channels_per_group][kernel_size];
   using Bias_t = dtype[out_channels];
   using Input_t = dtype[in_channels][n];
   using Output_t = dtype[out_channels][out_length];
@@ -112,6 +127,9 @@ private:
 #ifdef __VITIS_HLS__
 #pragma HLS LOOP_TRIPCOUNT min = 1 max = 512
 #endif
+      const int group_base =
+          (oc / out_channels_per_group) * in_channels_per_group;
+
     OUT_POS_LOOP:
       for (int pos = 0; pos < out_length; pos++) {
 #ifdef __VITIS_HLS__
@@ -120,7 +138,7 @@ private:
 #endif
         dtype acc = dtype(0);
       IN_CHANNEL_LOOP:
-        for (int ic = 0; ic < in_channels; ic++) {
+        for (int icg = 0; icg < in_channels_per_group; icg++) {
 #ifdef __VITIS_HLS__
 #pragma HLS LOOP_TRIPCOUNT min = 1 max = 512
 #endif
@@ -129,9 +147,9 @@ private:
 #ifdef __VITIS_HLS__
 #pragma HLS LOOP_TRIPCOUNT min = 1 max = 7
 #endif
-            int in_pos = pos + k - padding;
+            int in_pos = pos * stride + k * dilation - padding;
             if (in_pos >= 0 && in_pos < n) {
-              acc += input[ic][in_pos] * weight[oc][ic][k];
+              acc += input[group_base + icg][in_pos] * weight[oc][icg][k];
             }
           }
         }
@@ -170,8 +188,17 @@ private:
 #endif
 };
 
+// Convolution algorithm used by the optimized Conv1d. CONV1D_IM2COL lowers the
+// layer to a [out_length x in_channels * kernel_size] patch matrix and runs it
+// through Linear with GEMM_CONFIG. CONV1D_FFT convolves by overlap-add in the
+// frequency domain, O(n log n) instead of O(n * kernel_size); CONV1D_AUTO
+// picks it once kernel_size reaches FFT_THRESHOLD and runs direct otherwise.
+enum Conv1dAlgo { CONV1D_DIRECT, CONV1D_IM2COL, CONV1D_FFT, CONV1D_AUTO };
+
 template <bool DATAFLOW_ENABLED, int PIPELINE_II, int UNROLL_FACTOR,
-          int PARTITION_FACTOR, int KERNEL_UNROLL, int IC_UNROLL>
+          int PARTITION_FACTOR, int KERNEL_UNROLL, int IC_UNROLL,
+          Conv1dAlgo ALGO = CONV1D_DIRECT, typename GEMM_CONFIG = void,
+          int FFT_THRESHOLD = 64>
 struct Conv1dConfig {
   static constexpr bool dataflow_enabled = DATAFLOW_ENABLED;
   static constexpr int pipeline_ii = PIPELINE_II;
@@ -179,6 +206,9 @@ struct Conv1dConfig {
   static constexpr int partition_factor = PARTITION_FACTOR;
   static constexpr int kernel_unroll = KERNEL_UNROLL;
   static constexpr int ic_unroll = IC_UNROLL;
+  static constexpr Conv1dAlgo algo = ALGO;
+  using gemm_config = GEMM_CONFIG;
+  static constexpr int fft_threshold = FFT_THRESHOLD;
 };
 
 // ============================================================================
@@ -194,6 +224,12 @@ public:
   static constexpr int padding = HParams::padding;
   static constexpr int n = HParams::n;
   static constexpr int out_length = HParams::out_length;
+  static constexpr int stride = HParams::stride;
+  static constexpr int dilation = HParams::dilation;
+  static constexpr int groups = HParams::groups;
+  static constexpr int in_channels_per_group = in_channels / groups;
+  static constexpr int out_channels_per_group = out_channels / groups;
+  static constexpr bool depthwise = groups > 1 && in_channels_per_group == 1;
   static constexpr OptLevel opt_level = OPT_ENABLED;
 
   static constexpr int dataflow_enabled = Config::dataflow_enabled;
@@ -202,11 +238,39 @@ public:
   static constexpr int partition_factor = Config::partition_factor;
   static constexpr int kernel_unroll = Config::kernel_unroll;
   static constexpr int ic_unroll = Config::ic_unroll;
-
-  using Weight_t = dtype[out_channels][in_channels][kernel_size];
+  static constexpr Conv1dAlgo algo = Config::algo;
+  static constexpr int fft_threshold = Config::fft_threshold;
+  static constexpr bool use_fft =
+      algo == CONV1D_FFT ||
+      (algo == CONV1D_AUTO && kernel_size >= fft_threshold);
+
+  // Overlap-add geometry. The dilated kernel spans fft_kernel_span taps and
+  // each fft_block slice of the padded input is transformed at fft_size =
+  // fft_block + fft_kernel_span - 1, so the circular convolution never wraps.
+  static constexpr int fft_kernel_span = (kernel_size - 1) * dilation + 1;
+  static constexpr int fft_size = fft_next_pow2(2 * fft_kernel_span);
+  static constexpr int fft_block = fft_size - fft_kernel_span + 1;
+  static constexpr int fft_padded_length = n + 2 * padding;
+  static constexpr int fft_num_blocks =
+      (fft_padded_length + fft_block - 1) / fft_block;
+  using fft = FFT<DType, fft_size>;
+
+  using gemm_config = typename Config::gemm_config;
+  static constexpr bool gemm_is_optimized =
+      !std::is_same<gemm_config, void>::value;
+  static constexpr int gemm_k = in_channels * kernel_size;
+  using gemm = Linear<DType, LinearHParams<gemm_k, out_channels>, gemm_config,
+                      gemm_is_optimized ? OPT_ENABLED : OPT_NONE>;
+
+  static_assert(algo != CONV1D_IM2COL || groups == 1,
+                "im2col Conv1d requires groups 1");
+
+  using Weight_t = dtype[out_channels][in_channels_per_group][kernel_size];
   using Bias_t = dtype[out_channels];
   using Input_t = dtype[in_channels][n];
   using Output_t = dtype[out_channels][out_length];
+  // Filter spectra for the FFT path, [..][0] real and [..][1] imaginary.
+  using Spectra_t = dtype[out_channels][in_channels_per_group][2][fft_size];
 
   Conv1d() = default;
   ~Conv1d() = default;
@@ -219,6 +283,39 @@ public:
     conv1d_2d_impl(output, input, weight, bias);
   }
 
+  // Transforms the weights once so repeated FFT convolutions can skip it.
+  static void precompute_spectra(Spectra_t spectra, const Weight_t weight) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+    spectra_impl(spectra, weight);
+  }
+
+  static void conv1d(Output_t output, const Input_t input,
+                     const Spectra_t spectra, const Bias_t bias) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+    fft_spectra_2d_impl(output, input, spectra, bias);
+  }
+
+  static void conv1d(dtype output[][out_channels][out_length],
+                     const dtype input[][in_channels][n],
+                     const Spectra_t spectra, const Bias_t bias,
+                     const int batch_size) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 32
+#endif
+  BATCH_LOOP:
+    for (int b = 0; b < batch_size; b++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_FLATTEN off
+#endif
+      fft_spectra_2d_impl(output[b], input[b], spectra, bias);
+    }
+  }
+
   static void conv1d(dtype output[][out_channels][out_length],
                      const dtype input[][in_channels][n], const Weight_t weight,
                      const Bias_t bias, const int batch_size) {
@@ -275,6 +372,247 @@ private:
                              const dtype input[in_channels][n],
                              const Weight_t weight, const Bias_t bias) {
 #ifdef __VITIS_HLS__
+#pragma HLS INLINE
+#endif
+    if constexpr (algo == CONV1D_IM2COL) {
+      im2col_2d_impl(output, input, weight, bias);
+    } else if constexpr (use_fft) {
+      fft_2d_impl(output, input, weight, bias);
+    } else if constexpr (depthwise) {
+      depthwise_2d_impl(output, input, weight, bias);
+    } else {
+      direct_2d_impl(output, input, weight, bias);
+    }
+  }
+
+  // One input channel per group: the kernel taps are fully unrolled and each
+  // output sample is a single pipelined step.
+  static void depthwise_2d_impl(dtype output[out_channels][out_length],
+                                const dtype input[in_channels][n],
+                                const Weight_t weight, const Bias_t bias) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#pragma HLS ARRAY_PARTITION variable = weight type = complete dim = 3
+#endif
+
+  DW_CHANNEL_LOOP:
+    for (int oc = 0; oc < out_channels; oc++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 1024
+#endif
+      const int ic = oc / out_channels_per_group;
+
+    DW_POS_LOOP:
+      for (int pos = 0; pos < out_length; pos++) {
+#ifdef __VITIS_HLS__
+#pragma HLS PIPELINE II = pipeline_ii
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 1024
+#endif
+        dtype acc = bias[oc];
+      DW_KERNEL_LOOP:
+        for (int k = 0; k < kernel_size; k++) {
+#ifdef __VITIS_HLS__
+#pragma HLS UNROLL
+#endif
+          int in_pos = pos * stride + k * dilation - padding;
+          if (in_pos >= 0 && in_pos < n) {
+            acc += input[ic][in_pos] * weight[oc][0][k];
+          }
+        }
+        output[oc][pos] = acc;
+      }
+    }
+  }
+
+  static void im2col_2d_impl(dtype output[out_channels][out_length],
+                             const dtype input[in_channels][n],
+                             const Weight_t weight, const Bias_t bias) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+    dtype cols[out_length][gemm_k];
+    dtype gemm_out[out_length][out_channels];
+
+  IM2COL_LOOP:
+    for (int pos = 0; pos < out_length; pos++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 1024
+#endif
+      for (int ic = 0; ic < in_channels; ic++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 512
+#endif
+        for (int k = 0; k < kernel_size; k++) {
+#ifdef __VITIS_HLS__
+#pragma HLS PIPELINE II = 1
+#endif
+          int in_pos = pos * stride + k * dilation - padding;
+          cols[pos][ic * kernel_size + k] =
+              (in_pos >= 0 && in_pos < n) ? input[ic][in_pos] : dtype(0);
+        }
+      }
+    }
+
+    // Weight_t is [oc][ic][k], i.e. already a row-major [oc][ic * k] matrix.
+    gemm::lin(gemm_out, cols, out_length,
+              reinterpret_cast<const dtype(*)[gemm_k]>(weight), bias);
+
+  SCATTER_LOOP:
+    for (int oc = 0; oc < out_channels; oc++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 512
+#endif
+      for (int pos = 0; pos < out_length; pos++) {
+#ifdef __VITIS_HLS__
+#pragma HLS PIPELINE II = 1
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 1024
+#endif
+        output[oc][pos] = gemm_out[pos][oc];
+      }
+    }
+  }
+
+  // Correlating with w is convolving with the reversed, dilated kernel
+  // h[(kernel_size - 1 - k) * dilation] = w[k]; spectra holds FFT(h).
+  static void spectra_impl(Spectra_t spectra, const Weight_t weight) {
+  SPECTRA_LOOP:
+    for (int oc = 0; oc < out_channels; oc++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 512
+#endif
+      for (int icg = 0; icg < in_channels_per_group; icg++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 512
+#endif
+        dtype *re = spectra[oc][icg][0];
+        dtype *im = spectra[oc][icg][1];
+        for (int i = 0; i < fft_size; i++) {
+#ifdef __VITIS_HLS__
+#pragma HLS PIPELINE II = 1
+#endif
+          re[i] = dtype(0);
+          im[i] = dtype(0);
+        }
+        for (int k = 0; k < kernel_size; k++) {
+          re[(kernel_size - 1 - k) * dilation] = weight[oc][icg][k];
+        }
+        fft::forward(re, im);
+      }
+    }
+  }
+
+  static void fft_2d_impl(dtype output[out_channels][out_length],
+                          const dtype input[in_channels][n],
+                          const Weight_t weight, const Bias_t bias) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+    static Spectra_t spectra;
+    spectra_impl(spectra, weight);
+    fft_spectra_2d_impl(output, input, spectra, bias);
+  }
+
+  // Overlap-add: each fft_block slice of the zero-padded input is transformed
+  // once per input channel, multiplied by the filter spectra and summed over
+  // the group in the frequency domain; one inverse FFT per output channel
+  // then scatters the block's partial sums. Full-convolution index g maps to
+  // padded position p = g - (fft_kernel_span - 1), kept when p % stride == 0.
+  static void fft_spectra_2d_impl(dtype output[out_channels][out_length],
+                                  const dtype input[in_channels][n],
+                                  const Spectra_t spectra,
+                                  const Bias_t bias) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+    static dtype block_re[in_channels][fft_size];
+    static dtype block_im[in_channels][fft_size];
+    dtype acc_re[fft_size];
+    dtype acc_im[fft_size];
+
+  FFT_INIT_LOOP:
+    for (int oc = 0; oc < out_channels; oc++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 512
+#endif
+      for (int pos = 0; pos < out_length; pos++) {
+#ifdef __VITIS_HLS__
+#pragma HLS PIPELINE II = 1
+#endif
+        output[oc][pos] = bias[oc];
+      }
+    }
+
+  FFT_BLOCK_LOOP:
+    for (int blk = 0; blk < fft_num_blocks; blk++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 64
+#endif
+      const int block_start = blk * fft_block;
+
+    FFT_INPUT_LOOP:
+      for (int ic = 0; ic < in_channels; ic++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 512
+#endif
+        for (int i = 0; i < fft_size; i++) {
+#ifdef __VITIS_HLS__
+#pragma HLS PIPELINE II = 1
+#endif
+          const int in_pos = block_start + i - padding;
+          block_re[ic][i] = (i < fft_block && in_pos >= 0 && in_pos < n)
+                                ? input[ic][in_pos]
+                                : dtype(0);
+          block_im[ic][i] = dtype(0);
+        }
+        fft::forward(block_re[ic], block_im[ic]);
+      }
+
+    FFT_OUT_CHANNEL_LOOP:
+      for (int oc = 0; oc < out_channels; oc++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 512
+#endif
+        const int group_base =
+            (oc / out_channels_per_group) * in_channels_per_group;
+
+      FFT_MAC_LOOP:
+        for (int i = 0; i < fft_size; i++) {
+#ifdef __VITIS_HLS__
+#pragma HLS PIPELINE II = pipeline_ii
+#endif
+          dtype sum_re = dtype(0);
+          dtype sum_im = dtype(0);
+          for (int icg = 0; icg < in_channels_per_group; icg++) {
+            const dtype xr = block_re[group_base + icg][i];
+            const dtype xi = block_im[group_base + icg][i];
+            const dtype hr = spectra[oc][icg][0][i];
+            const dtype hi = spectra[oc][icg][1][i];
+            sum_re += xr * hr - xi * hi;
+            sum_im += xr * hi + xi * hr;
+          }
+          acc_re[i] = sum_re;
+          acc_im[i] = sum_im;
+        }
+        fft::inverse(acc_re, acc_im);
+
+      FFT_SCATTER_LOOP:
+        for (int i = 0; i < fft_size; i++) {
+#ifdef __VITIS_HLS__
+#pragma HLS PIPELINE II = 1
+#endif
+          const int p = block_start + i - (fft_kernel_span - 1);
+          if (p >= 0 && p % stride == 0 && p / stride < out_length) {
+            output[oc][p / stride] += acc_re[i];
+          }
+        }
+      }
+    }
+  }
+
+  static void direct_2d_impl(dtype output[out_channels][out_length],
+                             const dtype input[in_channels][n],
+                             const Weight_t weight, const Bias_t bias) {
+#ifdef __VITIS_HLS__
 #pragma HLS INLINE off
 
     constexpr bool should_partition =
@@ -301,6 +639,9 @@ private:
 #pragma HLS UNROLL factor = unroll_factor
       }
 #endif
+      const int group_base =
+          (oc / out_channels_per_group) * in_channels_per_group;
+
     OUT_POS_LOOP:
       for (int pos = 0; pos < out_length; pos++) {
 #ifdef __VITIS_HLS__
@@ -313,7 +654,7 @@ private:
 #endif
 
       IN_CHANNEL_LOOP:
-        for (int ic = 0; ic < in_channels; ic++) {
+        for (int icg = 0; icg < in_channels_per_group; icg++) {
 #ifdef __VITIS_HLS__
 #pragma HLS LOOP_TRIPCOUNT min = 1 max = 512
           if constexpr (ic_unroll > 1 && in_channels <= 256) {
@@ -331,9 +672,9 @@ private:
             }
 #pragma HLS BIND_OP variable = acc op = mul impl = dsp
 #endif
-            int in_pos = pos + k - padding;
+            int in_pos = pos * stride + k * dilation - padding;
             if (in_pos >= 0 && in_pos < n) {
-              acc += input[ic][in_pos] * weight[oc][ic][k];
+              acc += input[group_base + icg][in_pos] * weight[oc][icg][k];
             }
           }
         }
@@ -2,6 +2,7 @@
 
 #ifndef __VITIS_HLS__
 #include "../builder/builder.hh"
+#include "./linear_builder.hh"
 #include <sstream>
 
 namespace vhn {
@@ -25,9 +26,16 @@ public:
     auto padding = hparams["padding"].get<int>();
     auto n = hparams["n"].get<int>();
 
+    auto stride = hparams.value("stride", 1);
+    auto dilation = hparams.value("dilation", 1);
+    auto groups = hparams.value("groups", 1);
+
     oss << "using " << name << "_hparams = vhn::Conv1dHParams<";
     oss << in_channels << ", " << out_channels << ", " << kernel_size << ", "
         << padding << ", " << n;
+    if (stride != 1 || dilation != 1 || groups != 1) {
+      oss << ", " << stride << ", " << dilation << ", " << groups;
+    }
     oss << ">;\n\n";
 
     return oss.str();
@@ -47,11 +55,37 @@ public:
     auto partition_factor = hls_cfg.value("partition_factor", 4);
     auto kernel_unroll = hls_cfg.value("kernel_unroll", 1);
     auto ic_unroll = hls_cfg.value("ic_unroll", 1);
+    auto algo = hls_cfg.value("algo", std::string("direct"));
+
+    std::string algo_enum;
+    if (algo == "direct") {
+      algo_enum = "vhn::CONV1D_DIRECT";
+    } else if (algo == "im2col") {
+      algo_enum = "vhn::CONV1D_IM2COL";
+    } else if (algo == "fft") {
+      algo_enum = "vhn::CONV1D_FFT";
+    } else if (algo == "auto") {
+      algo_enum = "vhn::CONV1D_AUTO";
+    } else {
+      throw std::runtime_error("Unsupported Conv1d algo: " + algo);
+    }
+
+    bool has_gemm = hls_cfg.contains("gemm") && !hls_cfg["gemm"].empty();
+    if (has_gemm) {
+      LinearBuilder linear_builder;
+      oss << linear_builder.generate_config(name + "_gemm", hls_cfg["gemm"]);
+    }
 
     oss << "using " << name << "_cfg = vhn::Conv1dConfig<";
     oss << (dataflow_enabled ? "true" : "false") << ", " << pipeline_ii << ", "
         << unroll_factor << ", " << partition_factor << ", " << kernel_unroll
-        << ", " << ic_unroll;
+        << ", " << ic_unroll << ", " << algo_enum;
+    if (has_gemm)
+      oss << ", " << name << "_gemm_cfg";
+    if (hls_cfg.contains("fft_threshold")) {
+      oss << (has_gemm ? "" : ", void") << ", "
+          << hls_cfg["fft_threshold"].get<int>();
+    }
     oss << ">;\n\n";
 
     return oss.str();
@@ -1,6 +1,11 @@
 #pragma once
 
+#include "../layout.hh"
 #include "../opt_level.hh"
+#include "../stream.hh"
+#include "./linear.hh"
+#include "./winograd.hh"
+#include <type_traits>
 
 #ifdef __VITIS_HLS__
 #include <hls_stream.h>
@@ -13,7 +18,8 @@ template <typename DType, typename HParams, typename Config = void,
 class Conv2d;
 
 template <int IN_CHANNELS, int OUT_CHANNELS, int KERNEL_SIZE, int PADDING,
-          int WIDTH, int HEIGHT>
+          int WIDTH, int HEIGHT, int STRIDE = 1, int DILATION = 1,
+          int GROUPS = 1>
 struct Conv2dHParams {
   static constexpr int in_channels = IN_CHANNELS;
   static constexpr int out_channels = OUT_CHANNELS;
@@ -21,8 +27,16 @@ struct Conv2dHParams {
   static constexpr int padding = PADDING;
   static constexpr int width = WIDTH;
   static constexpr int height = HEIGHT;
-  static constexpr int out_width = WIDTH - KERNEL_SIZE + 1 + 2 * PADDING;
-  static constexpr int out_height = HEIGHT - KERNEL_SIZE + 1 + 2 * PADDING;
+  static constexpr int stride = STRIDE;
+  static constexpr int dilation = DILATION;
+  static constexpr int groups = GROUPS;
+  static constexpr int out_width =
+      (WIDTH + 2 * PADDING - DILATION * (KERNEL_SIZE - 1) - 1) / STRIDE + 1;
+  static constexpr int out_height =
+      (HEIGHT + 2 * PADDING - DILATION * (KERNEL_SIZE - 1) - 1) / STRIDE + 1;
+
+  static_assert(IN_CHANNELS % GROUPS == 0 && OUT_CHANNELS % GROUPS == 0,
+                "Conv2d channels must be divisible by groups");
 };
 
 // ============================================================================
@@ -40,9 +54,16 @@ public:
   static constexpr int height = HParams::height;
   static constexpr int out_width = HParams::out_width;
   static constexpr int out_height = HParams::out_height;
+  static constexpr int stride = HParams::stride;
+  static constexpr int dilation = HParams::dilation;
+  static constexpr int groups = HParams::groups;
+  static constexpr int in_channels_per_group = in_channels / groups;
+  static constexpr int out_channels_per_group = out_channels / groups;
+  static constexpr bool depthwise = groups > 1 && in_channels_per_group == 1;
   static constexpr OptLevel opt_level = OPT_NONE;
 
-  using Weight_t = dtype[out_channels][in_channels][kernel_size][kernel_size];
+  using Weight_t =
+      dtype[out_channels][in_channels_per_group][kernel_size][kernel_size];
   using Bias_t = dtype[out_channels];
   using Input_t = dtype[in_channels][width][height];
   using Output_t = dtype[out_channels][out_width][out_height];
@@ -84,6 +105,27 @@ public:
   }
 #endif
 
+  // Row-streaming convolution over a (kernel_size - 1)-row line buffer.
+  // Pixels arrive row by row (along `width`) with channels innermost, i.e.
+  // input[ic][r][c] is element (r * height + c) * in_channels + ic; outputs
+  // use the same order over out_channels and start as soon as
+  // kernel_size - 1 rows have been read. Runs in host builds as well.
+  static void conv2d_linebuffer(stream<dtype> &output_stream,
+                                stream<dtype> &input_stream,
+                                const Weight_t weight, const Bias_t bias,
+                                const int batch_size = 1) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+  BATCH_LOOP:
+    for (int b = 0; b < batch_size; b++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 32
+#endif
+      conv2d_linebuffer_impl(output_stream, input_stream, weight, bias);
+    }
+  }
+
 private:
   static void conv2d_3d_impl(dtype output[out_channels][out_width][out_height],
                              const dtype input[in_channels][width][height],
@@ -100,6 +142,9 @@ private:
 #ifdef __VITIS_HLS__
 #pragma HLS LOOP_TRIPCOUNT min = 1 max = 512
 #endif
+      const int group_base =
+          (oc / out_channels_per_group) * in_channels_per_group;
+
     OUT_POS_Y_LOOP:
       for (int pos_y = 0; pos_y < out_width; pos_y++) {
 #ifdef __VITIS_HLS__
@@ -113,7 +158,7 @@ private:
 #endif
           dtype acc = dtype(0.0f);
         IN_CHANNEL_LOOP:
-          for (int ic = 0; ic < in_channels; ic++) {
+          for (int icg = 0; icg < in_channels_per_group; icg++) {
 #ifdef __VITIS_HLS__
 #pragma HLS LOOP_TRIPCOUNT min = 1 max = 512
 #endif
@@ -127,11 +172,12 @@ private:
 #ifdef __VITIS_HLS__
 #pragma HLS LOOP_TRIPCOUNT min = 1 max = 7
 #endif
-                int in_pos_y = pos_y + ky - padding;
-                int in_pos_x = pos_x + kx - padding;
+                int in_pos_y = pos_y * stride + ky * dilation - padding;
+                int in_pos_x = pos_x * stride + kx * dilation - padding;
                 if (in_pos_y >= 0 && in_pos_y < width && in_pos_x >= 0 &&
                     in_pos_x < height) {
-                  acc += input[ic][in_pos_y][in_pos_x] * weight[oc][ic][ky][kx];
+                  acc += input[group_base + icg][in_pos_y][in_pos_x] *
+                         weight[oc][icg][ky][kx];
                 }
               }
             }
@@ -142,6 +188,99 @@ private:
     }
   }
 
+  static void conv2d_linebuffer_impl(stream<dtype> &output_stream,
+                                     stream<dtype> &input_stream,
+                                     const Weight_t weight, const Bias_t bias) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+    constexpr int padded_width = width + 2 * padding;
+    constexpr int padded_height = height + 2 * padding;
+    constexpr int window_size = dilation * (kernel_size - 1) + 1;
+    constexpr int lines = (window_size > 1) ? window_size - 1 : 1;
+
+    dtype line_buffer[lines][padded_height][in_channels];
+    dtype window[window_size][window_size][in_channels];
+#ifdef __VITIS_HLS__
+#pragma HLS ARRAY_PARTITION variable = line_buffer type = complete dim = 1
+#pragma HLS ARRAY_PARTITION variable = window type = complete dim = 1
+#pragma HLS ARRAY_PARTITION variable = window type = complete dim = 2
+#endif
+
+  ROW_LOOP:
+    for (int r = 0; r < padded_width; r++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 512
+#endif
+    COL_LOOP:
+      for (int c = 0; c < padded_height; c++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 512
+#endif
+        const bool inside = r >= padding && r < padding + width &&
+                            c >= padding && c < padding + height;
+
+      SHIFT_LOOP:
+        for (int ic = 0; ic < in_channels; ic++) {
+#ifdef __VITIS_HLS__
+#pragma HLS PIPELINE II = 1
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 512
+#endif
+          dtype pixel = inside ? input_stream.read() : dtype(0.0f);
+
+          for (int wy = 0; wy < window_size; wy++) {
+            for (int wx = 0; wx < window_size - 1; wx++) {
+              window[wy][wx][ic] = window[wy][wx + 1][ic];
+            }
+          }
+          for (int wy = 0; wy < window_size - 1; wy++) {
+            window[wy][window_size - 1][ic] = line_buffer[wy][c][ic];
+          }
+          window[window_size - 1][window_size - 1][ic] = pixel;
+
+          if constexpr (window_size > 1) {
+            for (int wy = 0; wy < window_size - 2; wy++) {
+              line_buffer[wy][c][ic] = line_buffer[wy + 1][c][ic];
+            }
+            line_buffer[window_size - 2][c][ic] = pixel;
+          }
+        }
+
+        const int top = r - (window_size - 1);
+        const int left = c - (window_size - 1);
+        if (top < 0 || left < 0 || top % stride != 0 || left % stride != 0) {
+          continue;
+        }
+
+      OUT_CHANNEL_LOOP:
+        for (int oc = 0; oc < out_channels; oc++) {
+#ifdef __VITIS_HLS__
+#pragma HLS PIPELINE II = 1
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 512
+#endif
+          const int group_base =
+              (oc / out_channels_per_group) * in_channels_per_group;
+          dtype acc = dtype(0.0f);
+        IN_CHANNEL_LOOP:
+          for (int icg = 0; icg < in_channels_per_group; icg++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 512
+#endif
+          KERNEL_Y_LOOP:
+            for (int ky = 0; ky < kernel_size; ky++) {
+            KERNEL_X_LOOP:
+              for (int kx = 0; kx < kernel_size; kx++) {
+                acc += window[ky * dilation][kx * dilation][group_base + icg] *
+                       weight[oc][icg][ky][kx];
+              }
+            }
+          }
+          output_stream.write(acc + bias[oc]);
+        }
+      }
+    }
+  }
+
 #ifdef __VITIS_HLS__
   static void conv2d_stream_impl(hls::stream<dtype> &output_stream,
                                  hls::stream<dtype> &input_stream,
@@ -176,8 +315,43 @@ private:
 #endif
 };
 
+// Convolution algorithm used by the optimized Conv2d. The Winograd variants
+// compute F(2x2, 3x3) / F(4x4, 3x3) tiles and require a 3x3 kernel.
+// CONV2D_IM2COL lowers one output row at a time to a
+// [out_height x in_channels * k * k] patch matrix and runs it through Linear
+// with GEMM_CONFIG.
+//
+// LAYOUT selects the tensor layout of the array entry points. LAYOUT_NHWC
+// takes Input_t = [width][height][in_channels], Output_t =
+// [out_width][out_height][out_channels] and Weight_t =
+// [out_channels][k][k][in_channels / groups] (see LayoutTransform), and only
+// supports CONV2D_DIRECT.
+//
+// TILE_CONFIG (a Conv2dTileConfig, void to disable) blocks CONV2D_DIRECT
+// over output tiles, output-channel blocks and input-channel blocks.
+enum Conv2dAlgo {
+  CONV2D_DIRECT,
+  CONV2D_WINOGRAD_2X2,
+  CONV2D_WINOGRAD_4X4,
+  CONV2D_IM2COL
+};
+
+// Tile of TILE_WIDTH x TILE_HEIGHT output pixels for OC_BLOCK output
+// channels, reduced IC_BLOCK input channels at a time. The input patch,
+// weight block and accumulators of one step are copied into local buffers
+// (cache resident on host, BRAM / registers under HLS).
+template <int TILE_WIDTH, int TILE_HEIGHT, int OC_BLOCK, int IC_BLOCK>
+struct Conv2dTileConfig {
+  static constexpr int tile_width = TILE_WIDTH;
+  static constexpr int tile_height = TILE_HEIGHT;
+  static constexpr int oc_block = OC_BLOCK;
+  static constexpr int ic_block = IC_BLOCK;
+};
+
 template <bool DATAFLOW_ENABLED, int PIPELINE_II, int UNROLL_FACTOR,
-          int PARTITION_FACTOR, int KERNEL_UNROLL, int IC_UNROLL>
+          int PARTITION_FACTOR, int KERNEL_UNROLL, int IC_UNROLL,
+          Conv2dAlgo ALGO = CONV2D_DIRECT, typename GEMM_CONFIG = void,
+          TensorLayout LAYOUT = LAYOUT_NCHW, typename TILE_CONFIG = void>
 struct Conv2dConfig {
   static constexpr bool dataflow_enabled = DATAFLOW_ENABLED;
   static constexpr int pipeline_ii = PIPELINE_II;
@@ -185,6 +359,10 @@ struct Conv2dConfig {
   static constexpr int partition_factor = PARTITION_FACTOR;
   static constexpr int kernel_unroll = KERNEL_UNROLL;
   static constexpr int ic_unroll = IC_UNROLL;
+  static constexpr Conv2dAlgo algo = ALGO;
+  using gemm_config = GEMM_CONFIG;
+  static constexpr TensorLayout layout = LAYOUT;
+  using tile_config = TILE_CONFIG;
 };
 
 // ============================================================================
@@ -202,6 +380,12 @@ public:
   static constexpr int height = HParams::height;
   static constexpr int out_width = HParams::out_width;
   static constexpr int out_height = HParams::out_height;
+  static constexpr int stride = HParams::stride;
+  static constexpr int dilation = HParams::dilation;
+  static constexpr int groups = HParams::groups;
+  static constexpr int in_channels_per_group = in_channels / groups;
+  static constexpr int out_channels_per_group = out_channels / groups;
+  static constexpr bool depthwise = groups > 1 && in_channels_per_group == 1;
   static constexpr OptLevel opt_level = OPT_ENABLED;
 
   static constexpr int dataflow_enabled = Config::dataflow_enabled;
@@ -210,15 +394,112 @@ public:
   static constexpr int partition_factor = Config::partition_factor;
   static constexpr int kernel_unroll = Config::kernel_unroll;
   static constexpr int ic_unroll = Config::ic_unroll;
+  static constexpr Conv2dAlgo algo = Config::algo;
+  static constexpr TensorLayout layout = Config::layout;
+  static constexpr bool channels_last = layout == LAYOUT_NHWC;
+
+  static constexpr bool winograd =
+      algo == CONV2D_WINOGRAD_2X2 || algo == CONV2D_WINOGRAD_4X4;
+  static constexpr int winograd_m = (algo == CONV2D_WINOGRAD_4X4) ? 4 : 2;
+  using winograd_t = WinogradTransform<dtype, winograd_m>;
+  static constexpr int winograd_alpha = winograd_t::alpha;
+  static constexpr int tiles_y = (out_width + winograd_m - 1) / winograd_m;
+  static constexpr int tiles_x = (out_height + winograd_m - 1) / winograd_m;
+
+  static_assert(!winograd || kernel_size == 3,
+                "Winograd Conv2d requires a 3x3 kernel");
+  static_assert(!winograd || (stride == 1 && dilation == 1 && groups == 1),
+                "Winograd Conv2d requires stride 1, dilation 1 and groups 1");
+  static_assert(algo != CONV2D_IM2COL || groups == 1,
+                "im2col Conv2d requires groups 1");
+  static_assert(!channels_last || algo == CONV2D_DIRECT,
+                "Channels-last Conv2d requires CONV2D_DIRECT");
 
-  using Weight_t = dtype[out_channels][in_channels][kernel_size][kernel_size];
+  using tile_config = typename Config::tile_config;
+  static constexpr bool tiled = !std::is_same<tile_config, void>::value;
+  static_assert(!tiled || (algo == CONV2D_DIRECT && !channels_last),
+                "Tiled Conv2d requires CONV2D_DIRECT and LAYOUT_NCHW");
+
+  using gemm_config = typename Config::gemm_config;
+  static constexpr bool gemm_is_optimized =
+      !std::is_same<gemm_config, void>::value;
+  static constexpr int gemm_k = in_channels * kernel_size * kernel_size;
+  using gemm = Linear<DType, LinearHParams<gemm_k, out_channels>, gemm_config,
+                      gemm_is_optimized ? OPT_ENABLED : OPT_NONE>;
+
+  using Weight_t = std::conditional_t<
+      channels_last,
+      dtype[out_channels][kernel_size][kernel_size][in_channels_per_group],
+      dtype[out_channels][in_channels_per_group][kernel_size][kernel_size]>;
+  using TransformedWeight_t =
+      dtype[out_channels][in_channels][winograd_alpha][winograd_alpha];
   using Bias_t = dtype[out_channels];
-  using Input_t = dtype[in_channels][width][height];
-  using Output_t = dtype[out_channels][out_width][out_height];
+  using Input_t =
+      std::conditional_t<channels_last, dtype[width][height][in_channels],
+                         dtype[in_channels][width][height]>;
+  using Output_t = std::conditional_t<
+      channels_last, dtype[out_width][out_height][out_channels],
+      dtype[out_channels][out_width][out_height]>;
 
   Conv2d() = default;
   ~Conv2d() = default;
 
+  // Winograd filter transform U = G g G^T. Run once per weight set and feed
+  // the result to the conv2d_transformed overloads; the plain conv2d entry
+  // points redo it on every call.
+  static void transform_weight(TransformedWeight_t tweight,
+                               const Weight_t weight) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+    static_assert(winograd, "transform_weight requires a Winograd Conv2dAlgo");
+  TRANSFORM_OC_LOOP:
+    for (int oc = 0; oc < out_channels; oc++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 512
+#endif
+    TRANSFORM_IC_LOOP:
+      for (int ic = 0; ic < in_channels; ic++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 512
+#pragma HLS PIPELINE II = 1
+#endif
+        winograd_t::filter(tweight[oc][ic], weight[oc][ic]);
+      }
+    }
+  }
+
+  static void conv2d_transformed(Output_t output, const Input_t input,
+                                 const TransformedWeight_t tweight,
+                                 const Bias_t bias) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+    static_assert(winograd,
+                  "conv2d_transformed requires a Winograd Conv2dAlgo");
+    winograd_3d_impl(output, input, tweight, bias);
+  }
+
+  static void
+  conv2d_transformed(dtype output[][out_channels][out_width][out_height],
+                     const dtype input[][in_channels][width][height],
+                     const int batch_size, const TransformedWeight_t tweight,
+                     const Bias_t bias) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 32
+#endif
+    static_assert(winograd,
+                  "conv2d_transformed requires a Winograd Conv2dAlgo");
+  BATCH_LOOP:
+    for (int b = 0; b < batch_size; b++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_FLATTEN off
+#endif
+      winograd_3d_impl(output[b], input[b], tweight, bias);
+    }
+  }
+
   static void conv2d(Output_t output, const Input_t input,
                      const Weight_t weight, const Bias_t bias) {
 #ifdef __VITIS_HLS__
@@ -227,14 +508,20 @@ public:
     conv2d_3d_impl(output, input, weight, bias);
   }
 
-  static void conv2d(dtype output[][out_channels][out_width][out_height],
-                     const dtype input[][in_channels][width][height],
+  static void conv2d(Output_t output[], const Input_t input[],
                      const int batch_size, const Weight_t weight,
                      const Bias_t bias) {
 #ifdef __VITIS_HLS__
 #pragma HLS INLINE off
 #pragma HLS LOOP_TRIPCOUNT min = 1 max = 32
 #endif
+    if constexpr (winograd) {
+      static TransformedWeight_t tweight;
+      transform_weight(tweight, weight);
+      conv2d_transformed(output, input, batch_size, tweight, bias);
+      return;
+    }
+
   BATCH_LOOP:
     for (int b = 0; b < batch_size; b++) {
 #ifdef __VITIS_HLS__
@@ -256,8 +543,172 @@ public:
   }
 #endif
 
+  // Row-streaming convolution over a (kernel_size - 1)-row line buffer.
+  // Pixels arrive row by row (along `width`) with channels innermost, i.e.
+  // input[ic][r][c] is element (r * height + c) * in_channels + ic; outputs
+  // use the same order over out_channels and start as soon as
+  // kernel_size - 1 rows have been read. Runs in host builds as well.
+  static void conv2d_linebuffer(stream<dtype> &output_stream,
+                                stream<dtype> &input_stream,
+                                const Weight_t weight, const Bias_t bias,
+                                const int batch_size = 1) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+  BATCH_LOOP:
+    for (int b = 0; b < batch_size; b++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 32
+#endif
+      conv2d_linebuffer_impl(output_stream, input_stream, weight, bias);
+    }
+  }
+
 private:
-  static void conv2d_3d_impl(dtype output[out_channels][out_width][out_height],
+  static void conv2d_3d_impl(Output_t output, const Input_t input,
+                             const Weight_t weight, const Bias_t bias) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE
+#endif
+    if constexpr (channels_last) {
+      if constexpr (depthwise) {
+        nhwc_depthwise_3d_impl(output, input, weight, bias);
+      } else {
+        nhwc_direct_3d_impl(output, input, weight, bias);
+      }
+    } else if constexpr (winograd) {
+      static TransformedWeight_t tweight;
+      transform_weight(tweight, weight);
+      winograd_3d_impl(output, input, tweight, bias);
+    } else if constexpr (algo == CONV2D_IM2COL) {
+      im2col_3d_impl(output, input, weight, bias);
+    } else if constexpr (depthwise) {
+      depthwise_3d_impl(output, input, weight, bias);
+    } else if constexpr (tiled) {
+      tiled_3d_impl(output, input, weight, bias);
+    } else {
+      direct_3d_impl(output, input, weight, bias);
+    }
+  }
+
+  // One input channel per group: no channel reduction, so the whole k x k
+  // window is unrolled and each output pixel is a single pipelined step.
+  static void
+  depthwise_3d_impl(dtype output[out_channels][out_width][out_height],
+                    const dtype input[in_channels][width][height],
+                    const Weight_t weight, const Bias_t bias) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#pragma HLS ARRAY_PARTITION variable = weight type = complete dim = 3
+#pragma HLS ARRAY_PARTITION variable = weight type = complete dim = 4
+#endif
+
+  DW_CHANNEL_LOOP:
+    for (int oc = 0; oc < out_channels; oc++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 1024
+#endif
+      const int ic = oc / out_channels_per_group;
+
+    DW_POS_Y_LOOP:
+      for (int pos_y = 0; pos_y < out_width; pos_y++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 512
+#endif
+      DW_POS_X_LOOP:
+        for (int pos_x = 0; pos_x < out_height; pos_x++) {
+#ifdef __VITIS_HLS__
+#pragma HLS PIPELINE II = pipeline_ii
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 512
+#endif
+          dtype acc = bias[oc];
+        DW_KERNEL_Y_LOOP:
+          for (int ky = 0; ky < kernel_size; ky++) {
+#ifdef __VITIS_HLS__
+#pragma HLS UNROLL
+#endif
+          DW_KERNEL_X_LOOP:
+            for (int kx = 0; kx < kernel_size; kx++) {
+#ifdef __VITIS_HLS__
+#pragma HLS UNROLL
+#endif
+              int in_pos_y = pos_y * stride + ky * dilation - padding;
+              int in_pos_x = pos_x * stride + kx * dilation - padding;
+              if (in_pos_y >= 0 && in_pos_y < width && in_pos_x >= 0 &&
+                  in_pos_x < height) {
+                acc += input[ic][in_pos_y][in_pos_x] * weight[oc][0][ky][kx];
+              }
+            }
+          }
+          output[oc][pos_y][pos_x] = acc;
+        }
+      }
+    }
+  }
+
+  static void im2col_3d_impl(dtype output[out_channels][out_width][out_height],
+                             const dtype input[in_channels][width][height],
+                             const Weight_t weight, const Bias_t bias) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+    // Weight_t is [oc][ic][ky][kx], i.e. already a row-major [oc][ic*k*k]
+    // matrix.
+    const auto gemm_weight = reinterpret_cast<const dtype(*)[gemm_k]>(weight);
+
+  ROW_LOOP:
+    for (int pos_y = 0; pos_y < out_width; pos_y++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 512
+#endif
+      dtype cols[out_height][gemm_k];
+      dtype gemm_out[out_height][out_channels];
+
+    IM2COL_LOOP:
+      for (int pos_x = 0; pos_x < out_height; pos_x++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 512
+#endif
+        for (int ic = 0; ic < in_channels; ic++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 512
+#endif
+          for (int ky = 0; ky < kernel_size; ky++) {
+            for (int kx = 0; kx < kernel_size; kx++) {
+#ifdef __VITIS_HLS__
+#pragma HLS PIPELINE II = 1
+#endif
+              int in_pos_y = pos_y * stride + ky * dilation - padding;
+              int in_pos_x = pos_x * stride + kx * dilation - padding;
+              cols[pos_x][(ic * kernel_size + ky) * kernel_size + kx] =
+                  (in_pos_y >= 0 && in_pos_y < width && in_pos_x >= 0 &&
+                   in_pos_x < height)
+                      ? input[ic][in_pos_y][in_pos_x]
+                      : dtype(0.0f);
+            }
+          }
+        }
+      }
+
+      gemm::lin(gemm_out, cols, out_height, gemm_weight, bias);
+
+    SCATTER_LOOP:
+      for (int oc = 0; oc < out_channels; oc++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 512
+#endif
+        for (int pos_x = 0; pos_x < out_height; pos_x++) {
+#ifdef __VITIS_HLS__
+#pragma HLS PIPELINE II = 1
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 512
+#endif
+          output[oc][pos_y][pos_x] = gemm_out[pos_x][oc];
+        }
+      }
+    }
+  }
+
+  static void direct_3d_impl(dtype output[out_channels][out_width][out_height],
                              const dtype input[in_channels][width][height],
                              const Weight_t weight, const Bias_t bias) {
 #ifdef __VITIS_HLS__
@@ -290,6 +741,9 @@ private:
 #pragma HLS UNROLL factor = unroll_factor
       }
 #endif
+      const int group_base =
+          (oc / out_channels_per_group) * in_channels_per_group;
+
     OUT_POS_Y_LOOP:
       for (int pos_y = 0; pos_y < out_width; pos_y++) {
 #ifdef __VITIS_HLS__
@@ -307,7 +761,7 @@ private:
 #endif
 
         IN_CHANNEL_LOOP:
-          for (int ic = 0; ic < in_channels; ic++) {
+          for (int icg = 0; icg < in_channels_per_group; icg++) {
 #ifdef __VITIS_HLS__
 #pragma HLS LOOP_TRIPCOUNT min = 1 max = 512
             if constexpr (ic_unroll > 1 && in_channels <= 256) {
@@ -331,11 +785,12 @@ private:
 #pragma HLS UNROLL
 #pragma HLS BIND_OP variable = acc op = mul impl = dsp
 #endif
-                int in_pos_y = pos_y + ky - padding;
-                int in_pos_x = pos_x + kx - padding;
+                int in_pos_y = pos_y * stride + ky * dilation - padding;
+                int in_pos_x = pos_x * stride + kx * dilation - padding;
                 if (in_pos_y >= 0 && in_pos_y < width && in_pos_x >= 0 &&
                     in_pos_x < height) {
-                  acc += input[ic][in_pos_y][in_pos_x] * weight[oc][ic][ky][kx];
+                  acc += input[group_base + icg][in_pos_y][in_pos_x] *
+                         weight[oc][icg][ky][kx];
                 }
               }
             }
@@ -346,6 +801,526 @@ private:
     }
   }
 
+  // Cache-blocked direct convolution. Each step works on a tile of output
+  // pixels for a block of output channels and accumulates one block of input
+  // channels at a time from local copies of the input patch and weights, so
+  // the working set is bounded by the tile sizes instead of whole planes.
+  // Per output the reduction still runs over (icg, ky, kx) in order, so the
+  // result matches direct_3d_impl.
+  struct Tiling {
+    static constexpr int tile_y = tile_config::tile_width < out_width
+                                      ? tile_config::tile_width
+                                      : out_width;
+    static constexpr int tile_x = tile_config::tile_height < out_height
+                                      ? tile_config::tile_height
+                                      : out_height;
+    static constexpr int oc_block =
+        tile_config::oc_block < out_channels_per_group
+            ? tile_config::oc_block
+            : out_channels_per_group;
+    static constexpr int ic_block =
+        tile_config::ic_block < in_channels_per_group
+            ? tile_config::ic_block
+            : in_channels_per_group;
+    static constexpr int patch_y = (tile_y - 1) * stride +
+                                   (kernel_size - 1) * dilation + 1;
+    static constexpr int patch_x = (tile_x - 1) * stride +
+                                   (kernel_size - 1) * dilation + 1;
+  };
+
+  static void tiled_3d_impl(dtype output[out_channels][out_width][out_height],
+                            const dtype input[in_channels][width][height],
+                            const Weight_t weight, const Bias_t bias) {
+    using T = Tiling;
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+    dtype acc[T::oc_block][T::tile_y][T::tile_x];
+    dtype in_tile[T::ic_block][T::patch_y][T::patch_x];
+    dtype w_tile[T::oc_block][T::ic_block][kernel_size][kernel_size];
+#ifdef __VITIS_HLS__
+    if constexpr (partition_factor > 1) {
+#pragma HLS ARRAY_PARTITION variable = acc type = cyclic factor =              \
+    partition_factor dim = 3
+#pragma HLS ARRAY_PARTITION variable = in_tile type = cyclic factor =          \
+    partition_factor dim = 3
+    }
+#pragma HLS ARRAY_PARTITION variable = w_tile type = complete dim = 4
+#endif
+
+  TILE_Y_LOOP:
+    for (int ty = 0; ty < out_width; ty += T::tile_y) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 64
+#endif
+    TILE_X_LOOP:
+      for (int tx = 0; tx < out_height; tx += T::tile_x) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 64
+#endif
+        const int in_y0 = ty * stride - padding;
+        const int in_x0 = tx * stride - padding;
+
+      GROUP_LOOP:
+        for (int g = 0; g < groups; g++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 32
+#endif
+        OC_BLOCK_LOOP:
+          for (int ob = 0; ob < out_channels_per_group; ob += T::oc_block) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 64
+#endif
+            const int oc0 = g * out_channels_per_group + ob;
+
+          ACC_INIT_LOOP:
+            for (int o = 0; o < T::oc_block; o++) {
+              for (int y = 0; y < T::tile_y; y++) {
+                for (int x = 0; x < T::tile_x; x++) {
+#ifdef __VITIS_HLS__
+#pragma HLS PIPELINE II = 1
+#endif
+                  acc[o][y][x] = dtype(0.0f);
+                }
+              }
+            }
+
+          IC_BLOCK_LOOP:
+            for (int ib = 0; ib < in_channels_per_group; ib += T::ic_block) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 64
+#endif
+              const int ic0 = g * in_channels_per_group + ib;
+
+            LOAD_INPUT_LOOP:
+              for (int i = 0; i < T::ic_block; i++) {
+                for (int y = 0; y < T::patch_y; y++) {
+                  for (int x = 0; x < T::patch_x; x++) {
+#ifdef __VITIS_HLS__
+#pragma HLS PIPELINE II = 1
+#endif
+                    const int iy = in_y0 + y;
+                    const int ix = in_x0 + x;
+                    in_tile[i][y][x] =
+                        (ib + i < in_channels_per_group && iy >= 0 &&
+                         iy < width && ix >= 0 && ix < height)
+                            ? input[ic0 + i][iy][ix]
+                            : dtype(0.0f);
+                  }
+                }
+              }
+
+            LOAD_WEIGHT_LOOP:
+              for (int o = 0; o < T::oc_block; o++) {
+                for (int i = 0; i < T::ic_block; i++) {
+                  for (int ky = 0; ky < kernel_size; ky++) {
+                    for (int kx = 0; kx < kernel_size; kx++) {
+#ifdef __VITIS_HLS__
+#pragma HLS PIPELINE II = 1
+#endif
+                      w_tile[o][i][ky][kx] =
+                          (ob + o < out_channels_per_group &&
+                           ib + i < in_channels_per_group)
+                              ? weight[oc0 + o][ib + i][ky][kx]
+                              : dtype(0.0f);
+                    }
+                  }
+                }
+              }
+
+            TILE_OC_LOOP:
+              for (int o = 0; o < T::oc_block; o++) {
+              TILE_IC_LOOP:
+                for (int i = 0; i < T::ic_block; i++) {
+                  if (ib + i >= in_channels_per_group) {
+                    continue;
+                  }
+                TILE_KY_LOOP:
+                  for (int ky = 0; ky < kernel_size; ky++) {
+                  TILE_KX_LOOP:
+                    for (int kx = 0; kx < kernel_size; kx++) {
+                      const dtype w = w_tile[o][i][ky][kx];
+                    TILE_POS_Y_LOOP:
+                      for (int y = 0; y < T::tile_y; y++) {
+                      TILE_POS_X_LOOP:
+                        for (int x = 0; x < T::tile_x; x++) {
+#ifdef __VITIS_HLS__
+#pragma HLS PIPELINE II = pipeline_ii
+#endif
+                          acc[o][y][x] +=
+                              in_tile[i][y * stride + ky * dilation]
+                                     [x * stride + kx * dilation] *
+                              w;
+                        }
+                      }
+                    }
+                  }
+                }
+              }
+            }
+
+          STORE_LOOP:
+            for (int o = 0; o < T::oc_block; o++) {
+              for (int y = 0; y < T::tile_y; y++) {
+                for (int x = 0; x < T::tile_x; x++) {
+#ifdef __VITIS_HLS__
+#pragma HLS PIPELINE II = 1
+#endif
+                  if (ob + o < out_channels_per_group && ty + y < out_width &&
+                      tx + x < out_height) {
+                    output[oc0 + o][ty + y][tx + x] =
+                        acc[o][y][x] + bias[oc0 + o];
+                  }
+                }
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+
+  // Channels-last direct convolution. For every output pixel and kernel tap
+  // the reduction over in_channels_per_group reads input[y][x][...] and
+  // weight[oc][ky][kx][...] contiguously, i.e. a plain dot product.
+  static void nhwc_direct_3d_impl(Output_t output, const Input_t input,
+                                  const Weight_t weight, const Bias_t bias) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+    if constexpr (partition_factor > 1 && in_channels <= 512) {
+#pragma HLS ARRAY_PARTITION variable = input type = cyclic factor =            \
+    partition_factor dim = 3
+#pragma HLS ARRAY_PARTITION variable = weight type = cyclic factor =           \
+    partition_factor dim = 4
+    }
+#endif
+
+  OUT_POS_Y_LOOP:
+    for (int pos_y = 0; pos_y < out_width; pos_y++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 512
+#endif
+    OUT_POS_X_LOOP:
+      for (int pos_x = 0; pos_x < out_height; pos_x++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 512
+#endif
+      OUT_CHANNEL_LOOP:
+        for (int oc = 0; oc < out_channels; oc++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 512
+#pragma HLS PIPELINE II = pipeline_ii
+#endif
+          const int group_base =
+              (oc / out_channels_per_group) * in_channels_per_group;
+          dtype acc = dtype(0.0f);
+
+        KERNEL_Y_LOOP:
+          for (int ky = 0; ky < kernel_size; ky++) {
+            int in_pos_y = pos_y * stride + ky * dilation - padding;
+            if (in_pos_y < 0 || in_pos_y >= width) {
+              continue;
+            }
+          KERNEL_X_LOOP:
+            for (int kx = 0; kx < kernel_size; kx++) {
+              int in_pos_x = pos_x * stride + kx * dilation - padding;
+              if (in_pos_x < 0 || in_pos_x >= height) {
+                continue;
+              }
+              const dtype *in_row = &input[in_pos_y][in_pos_x][group_base];
+              const dtype *w_row = weight[oc][ky][kx];
+            IN_CHANNEL_LOOP:
+              for (int icg = 0; icg < in_channels_per_group; icg++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 512
+                if constexpr (ic_unroll > 1 && in_channels <= 256) {
+#pragma HLS UNROLL factor = ic_unroll
+                }
+#endif
+                acc += in_row[icg] * w_row[icg];
+              }
+            }
+          }
+          output[pos_y][pos_x][oc] = acc + bias[oc];
+        }
+      }
+    }
+  }
+
+  // Channels-last depthwise convolution: each kernel tap updates the whole
+  // contiguous channel vector of the output pixel.
+  static void nhwc_depthwise_3d_impl(Output_t output, const Input_t input,
+                                     const Weight_t weight,
+                                     const Bias_t bias) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+
+  DW_POS_Y_LOOP:
+    for (int pos_y = 0; pos_y < out_width; pos_y++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 512
+#endif
+    DW_POS_X_LOOP:
+      for (int pos_x = 0; pos_x < out_height; pos_x++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 512
+#endif
+        dtype *out_row = output[pos_y][pos_x];
+
+      DW_INIT_LOOP:
+        for (int oc = 0; oc < out_channels; oc++) {
+#ifdef __VITIS_HLS__
+#pragma HLS PIPELINE II = 1
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 1024
+#endif
+          out_row[oc] = bias[oc];
+        }
+
+      DW_KERNEL_Y_LOOP:
+        for (int ky = 0; ky < kernel_size; ky++) {
+          int in_pos_y = pos_y * stride + ky * dilation - padding;
+          if (in_pos_y < 0 || in_pos_y >= width) {
+            continue;
+          }
+        DW_KERNEL_X_LOOP:
+          for (int kx = 0; kx < kernel_size; kx++) {
+            int in_pos_x = pos_x * stride + kx * dilation - padding;
+            if (in_pos_x < 0 || in_pos_x >= height) {
+              continue;
+            }
+            const dtype *in_row = input[in_pos_y][in_pos_x];
+          DW_CHANNEL_LOOP:
+            for (int oc = 0; oc < out_channels; oc++) {
+#ifdef __VITIS_HLS__
+#pragma HLS PIPELINE II = pipeline_ii
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 1024
+#endif
+              out_row[oc] += in_row[oc / out_channels_per_group] *
+                             weight[oc][ky][kx][0];
+            }
+          }
+        }
+      }
+    }
+  }
+
+  // Weight element (oc, icg, ky, kx) in either layout.
+  static dtype weight_at(const Weight_t weight, const int oc, const int icg,
+                         const int ky, const int kx) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE
+#endif
+    if constexpr (channels_last) {
+      return weight[oc][ky][kx][icg];
+    } else {
+      return weight[oc][icg][ky][kx];
+    }
+  }
+
+  static void
+  winograd_3d_impl(dtype output[out_channels][out_width][out_height],
+                   const dtype input[in_channels][width][height],
+                   const TransformedWeight_t tweight, const Bias_t bias) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+    constexpr int m = winograd_m;
+    constexpr int a = winograd_alpha;
+
+  TILE_Y_LOOP:
+    for (int ty = 0; ty < tiles_y; ty++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 256
+#endif
+    TILE_X_LOOP:
+      for (int tx = 0; tx < tiles_x; tx++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 256
+#endif
+        dtype v[in_channels][a][a];
+#ifdef __VITIS_HLS__
+#pragma HLS ARRAY_PARTITION variable = v type = complete dim = 2
+#pragma HLS ARRAY_PARTITION variable = v type = complete dim = 3
+#endif
+
+      INPUT_TRANSFORM_LOOP:
+        for (int ic = 0; ic < in_channels; ic++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 512
+#pragma HLS PIPELINE II = pipeline_ii
+#endif
+          dtype d[a][a];
+          for (int i = 0; i < a; i++) {
+            for (int j = 0; j < a; j++) {
+              int in_pos_y = ty * m + i - padding;
+              int in_pos_x = tx * m + j - padding;
+              d[i][j] = (in_pos_y >= 0 && in_pos_y < width && in_pos_x >= 0 &&
+                         in_pos_x < height)
+                            ? input[ic][in_pos_y][in_pos_x]
+                            : dtype(0.0f);
+            }
+          }
+          winograd_t::input(v[ic], d);
+        }
+
+      OUT_CHANNEL_LOOP:
+        for (int oc = 0; oc < out_channels; oc++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 512
+#endif
+          dtype p[a][a];
+#ifdef __VITIS_HLS__
+#pragma HLS ARRAY_PARTITION variable = p type = complete
+#endif
+          for (int i = 0; i < a; i++) {
+            for (int j = 0; j < a; j++) {
+              p[i][j] = dtype(0.0f);
+            }
+          }
+
+        IN_CHANNEL_LOOP:
+          for (int ic = 0; ic < in_channels; ic++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 512
+#pragma HLS PIPELINE II = pipeline_ii
+#endif
+          EWMM_LOOP:
+            for (int i = 0; i < a; i++) {
+              for (int j = 0; j < a; j++) {
+#ifdef __VITIS_HLS__
+#pragma HLS UNROLL
+#endif
+                p[i][j] += tweight[oc][ic][i][j] * v[ic][i][j];
+              }
+            }
+          }
+
+          dtype y[m][m];
+          winograd_t::output(y, p);
+
+        WRITE_TILE:
+          for (int i = 0; i < m; i++) {
+            for (int j = 0; j < m; j++) {
+#ifdef __VITIS_HLS__
+#pragma HLS PIPELINE II = 1
+#endif
+              int out_pos_y = ty * m + i;
+              int out_pos_x = tx * m + j;
+              if (out_pos_y < out_width && out_pos_x < out_height) {
+                output[oc][out_pos_y][out_pos_x] = y[i][j] + bias[oc];
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+
+  static void conv2d_linebuffer_impl(stream<dtype> &output_stream,
+                                     stream<dtype> &input_stream,
+                                     const Weight_t weight, const Bias_t bias) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+    constexpr int padded_width = width + 2 * padding;
+    constexpr int padded_height = height + 2 * padding;
+    constexpr int window_size = dilation * (kernel_size - 1) + 1;
+    constexpr int lines = (window_size > 1) ? window_size - 1 : 1;
+
+    dtype line_buffer[lines][padded_height][in_channels];
+    dtype window[window_size][window_size][in_channels];
+#ifdef __VITIS_HLS__
+#pragma HLS ARRAY_PARTITION variable = line_buffer type = complete dim = 1
+#pragma HLS ARRAY_PARTITION variable = window type = complete dim = 1
+#pragma HLS ARRAY_PARTITION variable = window type = complete dim = 2
+    if constexpr (partition_factor > 1 && in_channels <= 512) {
+#pragma HLS ARRAY_PARTITION variable = line_buffer type = cyclic factor =      \
+    partition_factor dim = 3
+#pragma HLS ARRAY_PARTITION variable = window type = cyclic factor =           \
+    partition_factor dim = 3
+#pragma HLS ARRAY_PARTITION variable = weight type = cyclic factor =           \
+    partition_factor dim = 2
+    }
+#endif
+
+  ROW_LOOP:
+    for (int r = 0; r < padded_width; r++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 512
+#endif
+    COL_LOOP:
+      for (int c = 0; c < padded_height; c++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 512
+#endif
+        const bool inside = r >= padding && r < padding + width &&
+                            c >= padding && c < padding + height;
+
+      SHIFT_LOOP:
+        for (int ic = 0; ic < in_channels; ic++) {
+#ifdef __VITIS_HLS__
+#pragma HLS PIPELINE II = 1
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 512
+#endif
+          dtype pixel = inside ? input_stream.read() : dtype(0.0f);
+
+          for (int wy = 0; wy < window_size; wy++) {
+            for (int wx = 0; wx < window_size - 1; wx++) {
+              window[wy][wx][ic] = window[wy][wx + 1][ic];
+            }
+          }
+          for (int wy = 0; wy < window_size - 1; wy++) {
+            window[wy][window_size - 1][ic] = line_buffer[wy][c][ic];
+          }
+          window[window_size - 1][window_size - 1][ic] = pixel;
+
+          if constexpr (window_size > 1) {
+            for (int wy = 0; wy < window_size - 2; wy++) {
+              line_buffer[wy][c][ic] = line_buffer[wy + 1][c][ic];
+            }
+            line_buffer[window_size - 2][c][ic] = pixel;
+          }
+        }
+
+        const int top = r - (window_size - 1);
+        const int left = c - (window_size - 1);
+        if (top < 0 || left < 0 || top % stride != 0 || left % stride != 0) {
+          continue;
+        }
+
+      OUT_CHANNEL_LOOP:
+        for (int oc = 0; oc < out_channels; oc++) {
+#ifdef __VITIS_HLS__
+#pragma HLS PIPELINE II = pipeline_ii
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 512
+#endif
+          const int group_base =
+              (oc / out_channels_per_group) * in_channels_per_group;
+          dtype acc = dtype(0.0f);
+        IN_CHANNEL_LOOP:
+          for (int icg = 0; icg < in_channels_per_group; icg++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 512
+            if constexpr (ic_unroll > 1 && in_channels <= 256) {
+#pragma HLS UNROLL factor = ic_unroll
+            }
+#endif
+          KERNEL_Y_LOOP:
+            for (int ky = 0; ky < kernel_size; ky++) {
+            KERNEL_X_LOOP:
+              for (int kx = 0; kx < kernel_size; kx++) {
+                acc += window[ky * dilation][kx * dilation][group_base + icg] *
+                       weight_at(weight, oc, icg, ky, kx);
+              }
+            }
+          }
+          output_stream.write(acc + bias[oc]);
+        }
+      }
+    }
+  }
+
 #ifdef __VITIS_HLS__
   static void conv2d_stream_impl(hls::stream<dtype> &output_stream,
                                  hls::stream<dtype> &input_stream,
@@ -360,38 +1335,52 @@ private:
   BATCH_LOOP:
     for (int b = 0; b < batch_size; b++) {
 #pragma HLS LOOP_TRIPCOUNT min = 1 max = 32
-      dtype input_buffer[in_channels][width][height];
-      if constexpr (should_partition) {
+      Input_t input_buffer;
+      if constexpr (should_partition && !channels_last) {
 #pragma HLS ARRAY_PARTITION variable = input_buffer type = cyclic factor =     \
     partition_factor dim = 1
+      } else if constexpr (should_partition) {
+#pragma HLS ARRAY_PARTITION variable = input_buffer type = cyclic factor =     \
+    partition_factor dim = 3
       }
 
+      // The stream follows the memory order of Input_t / Output_t.
     READ_INPUT:
-      for (int ic = 0; ic < in_channels; ic++) {
-        for (int w = 0; w < width; w++) {
-          for (int h = 0; h < height; h++) {
-#pragma HLS LOOP_TRIPCOUNT min = 1 max = 512
-            input_buffer[ic][w][h] = input_stream.read();
-          }
+      for (int i = 0; i < in_channels * width * height; i++) {
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 262144
+#pragma HLS PIPELINE II = 1
+        if constexpr (channels_last) {
+          input_buffer[i / (height * in_channels)][(i / in_channels) % height]
+                      [i % in_channels] = input_stream.read();
+        } else {
+          input_buffer[i / (width * height)][(i / height) % width]
+                      [i % height] = input_stream.read();
         }
       }
 
-      dtype output_buffer[out_channels][out_width][out_height];
-      if constexpr (should_partition) {
+      Output_t output_buffer;
+      if constexpr (should_partition && !channels_last) {
 #pragma HLS ARRAY_PARTITION variable = output_buffer type = cyclic factor =    \
     partition_factor dim = 1
+      } else if constexpr (should_partition) {
+#pragma HLS ARRAY_PARTITION variable = output_buffer type = cyclic factor =    \
+    partition_factor dim = 3
       }
 
       conv2d_3d_impl(output_buffer, input_buffer, weight, bias);
 
     WRITE_OUTPUT:
-      for (int oc = 0; oc < out_channels; oc++) {
-        for (int w = 0; w < out_width; w++) {
-          for (int h = 0; h < out_height; h++) {
-#pragma HLS LOOP_TRIPCOUNT min = 1 max = 512
+      for (int i = 0; i < out_channels * out_width * out_height; i++) {
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 262144
 #pragma HLS PIPELINE II = pipeline_ii
-            output_stream.write(output_buffer[oc][w][h]);
-          }
+        if constexpr (channels_last) {
+          output_stream.write(output_buffer[i / (out_height * out_channels)]
+                                           [(i / out_channels) % out_height]
+                                           [i % out_channels]);
+        } else {
+          output_stream.write(
+              output_buffer[i / (out_width * out_height)]
+                           [(i / out_height) % out_width][i % out_height]);
         }
       }
     }
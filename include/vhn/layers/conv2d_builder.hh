@@ -2,6 +2,7 @@
 
 #ifndef __VITIS_HLS__
 #include "../builder/builder.hh"
+#include "./linear_builder.hh"
 #include <sstream>
 
 namespace vhn {
@@ -27,9 +28,16 @@ public:
     auto width = hparams["width"].get<int>();
     auto height = hparams["height"].get<int>();
 
+    auto stride = hparams.value("stride", 1);
+    auto dilation = hparams.value("dilation", 1);
+    auto groups = hparams.value("groups", 1);
+
     oss << "using " << name << "_hparams = vhn::Conv2dHParams<";
     oss << in_channels << ", " << out_channels << ", " << kernel_size << ", "
         << padding << ", " << width << ", " << height;
+    if (stride != 1 || dilation != 1 || groups != 1) {
+      oss << ", " << stride << ", " << dilation << ", " << groups;
+    }
     oss << ">;\n\n";
 
     return oss.str();
@@ -49,11 +57,48 @@ public:
     auto partition_factor = hls_cfg.value("partition_factor", 4);
     auto kernel_unroll = hls_cfg.value("kernel_unroll", 1);
     auto ic_unroll = hls_cfg.value("ic_unroll", 1);
+    auto algo = hls_cfg.value("algo", std::string("direct"));
+
+    std::string algo_enum;
+    if (algo == "direct") {
+      algo_enum = "vhn::CONV2D_DIRECT";
+    } else if (algo == "winograd_2x2") {
+      algo_enum = "vhn::CONV2D_WINOGRAD_2X2";
+    } else if (algo == "winograd_4x4") {
+      algo_enum = "vhn::CONV2D_WINOGRAD_4X4";
+    } else if (algo == "im2col") {
+      algo_enum = "vhn::CONV2D_IM2COL";
+    } else {
+      throw std::runtime_error("Unsupported Conv2d algo: " + algo);
+    }
+
+    auto layout = hls_cfg.value("layout", std::string("nchw"));
+    if (layout != "nchw" && layout != "nhwc") {
+      throw std::runtime_error("Unsupported Conv2d layout: " + layout);
+    }
+
+    bool has_gemm = hls_cfg.contains("gemm") && !hls_cfg["gemm"].empty();
+    if (has_gemm) {
+      LinearBuilder linear_builder;
+      oss << linear_builder.generate_config(name + "_gemm", hls_cfg["gemm"]);
+    }
 
     oss << "using " << name << "_cfg = vhn::Conv2dConfig<";
     oss << (dataflow_enabled ? "true" : "false") << ", " << pipeline_ii << ", "
         << unroll_factor << ", " << partition_factor << ", " << kernel_unroll
-        << ", " << ic_unroll;
+        << ", " << ic_unroll << ", " << algo_enum;
+    if (has_gemm)
+      oss << ", " << name << "_gemm_cfg";
+    bool has_tile = hls_cfg.contains("tile") && !hls_cfg["tile"].empty();
+    if (layout == "nhwc" || has_tile)
+      oss << (has_gemm ? "" : ", void")
+          << (layout == "nhwc" ? ", vhn::LAYOUT_NHWC" : ", vhn::LAYOUT_NCHW");
+    if (has_tile) {
+      const auto &tile = hls_cfg["tile"];
+      oss << ", vhn::Conv2dTileConfig<" << tile.value("width", 8) << ", "
+          << tile.value("height", 8) << ", " << tile.value("oc_block", 16)
+          << ", " << tile.value("ic_block", 16) << ">";
+    }
     oss << ">;\n\n";
 
     return oss.str();
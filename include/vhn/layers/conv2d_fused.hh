@@ -0,0 +1,308 @@
+#pragma once
+
+#include "../opt_level.hh"
+#include "./conv2d.hh"
+#include <type_traits>
+
+namespace vhn {
+
+template <typename DType, typename HParams, typename Config = void,
+          OptLevel OPT_LEVEL = OPT_NONE>
+class Conv2dFused;
+
+// Where the residual input joins: RESIDUAL_PRE_ACT adds it before the
+// activation (ResNet style), RESIDUAL_POST_ACT after it.
+enum ResidualMode { RESIDUAL_NONE, RESIDUAL_PRE_ACT, RESIDUAL_POST_ACT };
+
+// Per-output epilogue applied to conv + bias:
+//
+//   y = act(acc * scale[oc] + shift[oc] [+ residual]) [+ residual]
+//
+// ACT_IMPL is an activation kernel such as ReLUImpl<dtype, 1> (void for
+// none); scale / shift are an inference BatchNorm reduced to one
+// multiply-add per channel, see BatchNormFold::scale_shift.
+template <typename ACT_IMPL = void, bool BATCHNORM = true,
+          ResidualMode RESIDUAL = RESIDUAL_NONE>
+struct Conv2dEpilogue {
+  using act_impl = ACT_IMPL;
+  static constexpr bool batchnorm = BATCHNORM;
+  static constexpr bool has_activation = !std::is_same<ACT_IMPL, void>::value;
+  static constexpr ResidualMode residual = RESIDUAL;
+
+  template <typename DType>
+  static DType apply(const DType acc, const DType scale, const DType shift,
+                     const DType res) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE
+#endif
+    DType y = acc;
+    if constexpr (batchnorm) {
+      y = y * scale + shift;
+    }
+    if constexpr (residual == RESIDUAL_PRE_ACT) {
+      y += res;
+    }
+    if constexpr (has_activation) {
+      y = act_impl::kernel(y);
+    }
+    if constexpr (residual == RESIDUAL_POST_ACT) {
+      y += res;
+    }
+    return y;
+  }
+};
+
+template <typename CONV_HPARAMS, typename EPILOGUE>
+struct Conv2dFusedHParams {
+  using conv_hparams = CONV_HPARAMS;
+  using epilogue = EPILOGUE;
+
+  static constexpr int in_channels = CONV_HPARAMS::in_channels;
+  static constexpr int out_channels = CONV_HPARAMS::out_channels;
+  static constexpr int width = CONV_HPARAMS::width;
+  static constexpr int height = CONV_HPARAMS::height;
+  static constexpr int out_width = CONV_HPARAMS::out_width;
+  static constexpr int out_height = CONV_HPARAMS::out_height;
+};
+
+// ============================================================================
+// Non-optimized version (OPT_NONE)
+// ============================================================================
+// Reference behaviour: a plain Conv2d followed by a separate epilogue pass.
+template <typename DType, typename HParams>
+class Conv2dFused<DType, HParams, void, OPT_NONE> {
+public:
+  using dtype = DType;
+  using epilogue = typename HParams::epilogue;
+  static constexpr int in_channels = HParams::in_channels;
+  static constexpr int out_channels = HParams::out_channels;
+  static constexpr int width = HParams::width;
+  static constexpr int height = HParams::height;
+  static constexpr int out_width = HParams::out_width;
+  static constexpr int out_height = HParams::out_height;
+  static constexpr OptLevel opt_level = OPT_NONE;
+
+  using conv = Conv2d<DType, typename HParams::conv_hparams, void, OPT_NONE>;
+
+  using Weight_t = typename conv::Weight_t;
+  using Bias_t = typename conv::Bias_t;
+  using Param_t = dtype[out_channels];
+  using Input_t = dtype[in_channels][width][height];
+  using Output_t = dtype[out_channels][out_width][out_height];
+
+  Conv2dFused() = default;
+  ~Conv2dFused() = default;
+
+  // `residual` is ignored (and may be null) when the epilogue has none.
+  static void conv2d(Output_t output, const Input_t input,
+                     const Weight_t weight, const Bias_t bias,
+                     const Param_t bn_scale, const Param_t bn_shift,
+                     const Output_t residual) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+    conv2d_3d_impl(output, input, weight, bias, bn_scale, bn_shift, residual);
+  }
+
+  static void conv2d(dtype output[][out_channels][out_width][out_height],
+                     const dtype input[][in_channels][width][height],
+                     const int batch_size, const Weight_t weight,
+                     const Bias_t bias, const Param_t bn_scale,
+                     const Param_t bn_shift,
+                     const dtype residual[][out_channels][out_width]
+                                         [out_height]) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 32
+#endif
+  BATCH_LOOP:
+    for (int b = 0; b < batch_size; b++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_FLATTEN off
+#endif
+      conv2d_3d_impl(output[b], input[b], weight, bias, bn_scale, bn_shift,
+                     (epilogue::residual == RESIDUAL_NONE) ? nullptr
+                                                           : residual[b]);
+    }
+  }
+
+private:
+  static void conv2d_3d_impl(dtype output[out_channels][out_width][out_height],
+                             const dtype input[in_channels][width][height],
+                             const Weight_t weight, const Bias_t bias,
+                             const Param_t bn_scale, const Param_t bn_shift,
+                             const Output_t residual) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+    conv::conv2d(output, input, weight, bias);
+
+  EPILOGUE_LOOP:
+    for (int oc = 0; oc < out_channels; oc++) {
+      for (int y = 0; y < out_width; y++) {
+        for (int x = 0; x < out_height; x++) {
+          const dtype res = (epilogue::residual == RESIDUAL_NONE)
+                                ? dtype(0.0f)
+                                : residual[oc][y][x];
+          output[oc][y][x] = epilogue::apply(output[oc][y][x], bn_scale[oc],
+                                             bn_shift[oc], res);
+        }
+      }
+    }
+  }
+};
+
+template <int PIPELINE_II, int UNROLL_FACTOR, int PARTITION_FACTOR>
+struct Conv2dFusedConfig {
+  static constexpr int pipeline_ii = PIPELINE_II;
+  static constexpr int unroll_factor = UNROLL_FACTOR;
+  static constexpr int partition_factor = PARTITION_FACTOR;
+};
+
+// ============================================================================
+// Optimized version (OPT_ENABLED)
+// ============================================================================
+// The epilogue is applied to each accumulator before it is written, so the
+// BatchNorm, activation and residual passes over the full feature map (and
+// their intermediate buffers) disappear.
+template <typename DType, typename HParams, typename Config>
+class Conv2dFused<DType, HParams, Config, OPT_ENABLED> {
+public:
+  using dtype = DType;
+  using epilogue = typename HParams::epilogue;
+  using conv_hparams = typename HParams::conv_hparams;
+
+  static constexpr int in_channels = HParams::in_channels;
+  static constexpr int out_channels = HParams::out_channels;
+  static constexpr int width = HParams::width;
+  static constexpr int height = HParams::height;
+  static constexpr int out_width = HParams::out_width;
+  static constexpr int out_height = HParams::out_height;
+  static constexpr OptLevel opt_level = OPT_ENABLED;
+
+  static constexpr int kernel_size = conv_hparams::kernel_size;
+  static constexpr int padding = conv_hparams::padding;
+  static constexpr int stride = conv_hparams::stride;
+  static constexpr int dilation = conv_hparams::dilation;
+  static constexpr int groups = conv_hparams::groups;
+  static constexpr int in_channels_per_group = in_channels / groups;
+  static constexpr int out_channels_per_group = out_channels / groups;
+
+  static constexpr int pipeline_ii = Config::pipeline_ii;
+  static constexpr int unroll_factor = Config::unroll_factor;
+  static constexpr int partition_factor = Config::partition_factor;
+
+  using conv = Conv2d<DType, conv_hparams, void, OPT_NONE>;
+
+  using Weight_t = typename conv::Weight_t;
+  using Bias_t = typename conv::Bias_t;
+  using Param_t = dtype[out_channels];
+  using Input_t = dtype[in_channels][width][height];
+  using Output_t = dtype[out_channels][out_width][out_height];
+
+  Conv2dFused() = default;
+  ~Conv2dFused() = default;
+
+  static void conv2d(Output_t output, const Input_t input,
+                     const Weight_t weight, const Bias_t bias,
+                     const Param_t bn_scale, const Param_t bn_shift,
+                     const Output_t residual) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+    conv2d_3d_impl(output, input, weight, bias, bn_scale, bn_shift, residual);
+  }
+
+  static void conv2d(dtype output[][out_channels][out_width][out_height],
+                     const dtype input[][in_channels][width][height],
+                     const int batch_size, const Weight_t weight,
+                     const Bias_t bias, const Param_t bn_scale,
+                     const Param_t bn_shift,
+                     const dtype residual[][out_channels][out_width]
+                                         [out_height]) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 32
+#endif
+  BATCH_LOOP:
+    for (int b = 0; b < batch_size; b++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_FLATTEN off
+#endif
+      conv2d_3d_impl(output[b], input[b], weight, bias, bn_scale, bn_shift,
+                     (epilogue::residual == RESIDUAL_NONE) ? nullptr
+                                                           : residual[b]);
+    }
+  }
+
+private:
+  static void conv2d_3d_impl(dtype output[out_channels][out_width][out_height],
+                             const dtype input[in_channels][width][height],
+                             const Weight_t weight, const Bias_t bias,
+                             const Param_t bn_scale, const Param_t bn_shift,
+                             const Output_t residual) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+    if constexpr (partition_factor > 1 && in_channels <= 512) {
+#pragma HLS ARRAY_PARTITION variable = input type = cyclic factor =            \
+    partition_factor dim = 1
+#pragma HLS ARRAY_PARTITION variable = weight type = cyclic factor =           \
+    partition_factor dim = 2
+    }
+#endif
+
+  OUT_CHANNEL_LOOP:
+    for (int oc = 0; oc < out_channels; oc++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 512
+#endif
+      const int group_base =
+          (oc / out_channels_per_group) * in_channels_per_group;
+      const dtype scale = bn_scale[oc];
+      const dtype shift = bn_shift[oc];
+
+    OUT_POS_Y_LOOP:
+      for (int y = 0; y < out_width; y++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 512
+#endif
+      OUT_POS_X_LOOP:
+        for (int x = 0; x < out_height; x++) {
+#ifdef __VITIS_HLS__
+#pragma HLS PIPELINE II = pipeline_ii
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 512
+#endif
+          dtype acc = dtype(0);
+        IN_CHANNEL_LOOP:
+          for (int icg = 0; icg < in_channels_per_group; icg++) {
+#ifdef __VITIS_HLS__
+            if constexpr (unroll_factor > 1) {
+#pragma HLS UNROLL factor = unroll_factor
+            }
+#endif
+          KERNEL_Y_LOOP:
+            for (int ky = 0; ky < kernel_size; ky++) {
+            KERNEL_X_LOOP:
+              for (int kx = 0; kx < kernel_size; kx++) {
+                int in_pos_y = y * stride + ky * dilation - padding;
+                int in_pos_x = x * stride + kx * dilation - padding;
+                if (in_pos_y >= 0 && in_pos_y < width && in_pos_x >= 0 &&
+                    in_pos_x < height) {
+                  acc += input[group_base + icg][in_pos_y][in_pos_x] *
+                         weight[oc][icg][ky][kx];
+                }
+              }
+            }
+          }
+          const dtype res = (epilogue::residual == RESIDUAL_NONE)
+                                ? dtype(0.0f)
+                                : residual[oc][y][x];
+          output[oc][y][x] =
+              epilogue::apply(dtype(acc + bias[oc]), scale, shift, res);
+        }
+      }
+    }
+  }
+};
+
+} // namespace vhn
@@ -0,0 +1,101 @@
+#pragma once
+
+#ifndef __VITIS_HLS__
+#include "../builder/builder.hh"
+#include "./conv2d_builder.hh"
+#include <sstream>
+
+namespace vhn {
+
+// hparams are the Conv2d ones plus an optional "epilogue" object:
+//   {"batchnorm": true, "activation": "none" | "relu" | "sigmoid" | "gelu",
+//    "residual": "none" | "pre_act" | "post_act"}
+class Conv2dFusedBuilder : public BaseBuilder {
+public:
+  std::string generate_hparams(const std::string &name,
+                               const std::string &dtype,
+                               const json &hparams) const override {
+    std::ostringstream oss;
+
+    auto epilogue = hparams.value("epilogue", json::object());
+    auto batchnorm = epilogue.value("batchnorm", true);
+    auto activation = epilogue.value("activation", std::string("none"));
+    auto residual = epilogue.value("residual", std::string("none"));
+
+    std::string act_impl;
+    if (activation == "none") {
+      act_impl = "void";
+    } else if (activation == "relu") {
+      act_impl = "vhn::ReLUImpl<" + dtype + ", 1>";
+    } else if (activation == "sigmoid") {
+      act_impl = "vhn::SigmoidImpl<" + dtype + ", 1>";
+    } else if (activation == "gelu") {
+      act_impl = "vhn::GeLUImpl<" + dtype + ", 1>";
+    } else {
+      throw std::runtime_error("Unsupported Conv2dFused activation: " +
+                               activation);
+    }
+
+    std::string residual_enum;
+    if (residual == "none") {
+      residual_enum = "vhn::RESIDUAL_NONE";
+    } else if (residual == "pre_act") {
+      residual_enum = "vhn::RESIDUAL_PRE_ACT";
+    } else if (residual == "post_act") {
+      residual_enum = "vhn::RESIDUAL_POST_ACT";
+    } else {
+      throw std::runtime_error("Unsupported Conv2dFused residual: " +
+                               residual);
+    }
+
+    Conv2dBuilder conv_builder;
+    oss << conv_builder.generate_hparams(name + "_conv", dtype, hparams);
+
+    oss << "using " << name << "_hparams = vhn::Conv2dFusedHParams<";
+    oss << name << "_conv_hparams, vhn::Conv2dEpilogue<" << act_impl << ", "
+        << (batchnorm ? "true" : "false") << ", " << residual_enum << ">";
+    oss << ">;\n\n";
+
+    return oss.str();
+  }
+
+  std::string generate_config(const std::string &name,
+                              const json &hls_cfg) const override {
+    if (hls_cfg.empty() || hls_cfg.is_null()) {
+      return "";
+    }
+
+    std::ostringstream oss;
+
+    auto pipeline_ii = hls_cfg.value("pipeline_ii", 1);
+    auto unroll_factor = hls_cfg.value("unroll_factor", 1);
+    auto partition_factor = hls_cfg.value("partition_factor", 4);
+
+    oss << "using " << name << "_cfg = vhn::Conv2dFusedConfig<";
+    oss << pipeline_ii << ", " << unroll_factor << ", " << partition_factor;
+    oss << ">;\n\n";
+
+    return oss.str();
+  }
+
+  std::string generate_type_alias(const std::string &name,
+                                  const std::string &dtype,
+                                  const json &hls_cfg) const override {
+    std::ostringstream oss;
+
+    std::string opt_level = "OPT_NONE";
+
+    if (!hls_cfg.empty() && !hls_cfg.is_null()) {
+      opt_level = "OPT_ENABLED";
+    }
+
+    std::string config_type =
+        (opt_level == "OPT_NONE") ? "void" : (name + "_cfg");
+
+    GENERATE_TYPE_ALIAS(oss, "Conv2dFused", name, dtype, opt_level)
+    return oss.str();
+  }
+};
+
+} // namespace vhn
+#endif
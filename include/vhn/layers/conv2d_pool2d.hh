@@ -0,0 +1,287 @@
+#pragma once
+
+#include "../opt_level.hh"
+#include "./conv2d.hh"
+#include "./pool2d.hh"
+
+namespace vhn {
+
+template <typename DType, typename HParams, typename Config = void,
+          OptLevel OPT_LEVEL = OPT_NONE>
+class Conv2dPool2d;
+
+// Conv2d followed by a max / average pool over its output.
+template <typename CONV_HPARAMS, PoolType POOL_TYPE, int POOL_KERNEL_SIZE,
+          int POOL_STRIDE, int POOL_PADDING = 0>
+struct Conv2dPool2dHParams {
+  using conv_hparams = CONV_HPARAMS;
+  using pool_hparams =
+      Pool2dHParams<CONV_HPARAMS::out_channels, POOL_KERNEL_SIZE, POOL_STRIDE,
+                    POOL_PADDING, CONV_HPARAMS::out_width,
+                    CONV_HPARAMS::out_height>;
+
+  static constexpr PoolType pool_type = POOL_TYPE;
+  static constexpr int in_channels = CONV_HPARAMS::in_channels;
+  static constexpr int out_channels = CONV_HPARAMS::out_channels;
+  static constexpr int width = CONV_HPARAMS::width;
+  static constexpr int height = CONV_HPARAMS::height;
+  static constexpr int out_width = pool_hparams::out_width;
+  static constexpr int out_height = pool_hparams::out_height;
+};
+
+// ============================================================================
+// Non-optimized version (OPT_NONE)
+// ============================================================================
+template <typename DType, typename HParams>
+class Conv2dPool2d<DType, HParams, void, OPT_NONE> {
+public:
+  using dtype = DType;
+  static constexpr int in_channels = HParams::in_channels;
+  static constexpr int out_channels = HParams::out_channels;
+  static constexpr int width = HParams::width;
+  static constexpr int height = HParams::height;
+  static constexpr int out_width = HParams::out_width;
+  static constexpr int out_height = HParams::out_height;
+  static constexpr OptLevel opt_level = OPT_NONE;
+
+  using conv = Conv2d<DType, typename HParams::conv_hparams, void, OPT_NONE>;
+  using pool = Pool2d<DType, typename HParams::pool_hparams, void, OPT_NONE,
+                      HParams::pool_type>;
+
+  using Weight_t = typename conv::Weight_t;
+  using Bias_t = typename conv::Bias_t;
+  using Input_t = dtype[in_channels][width][height];
+  using Output_t = dtype[out_channels][out_width][out_height];
+
+  Conv2dPool2d() = default;
+  ~Conv2dPool2d() = default;
+
+  static void conv_pool2d(Output_t output, const Input_t input,
+                          const Weight_t weight, const Bias_t bias) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+    conv_pool2d_3d_impl(output, input, weight, bias);
+  }
+
+  static void conv_pool2d(dtype output[][out_channels][out_width][out_height],
+                          const dtype input[][in_channels][width][height],
+                          const int batch_size, const Weight_t weight,
+                          const Bias_t bias) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 32
+#endif
+  BATCH_LOOP:
+    for (int b = 0; b < batch_size; b++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_FLATTEN off
+#endif
+      conv_pool2d_3d_impl(output[b], input[b], weight, bias);
+    }
+  }
+
+private:
+  static void
+  conv_pool2d_3d_impl(dtype output[out_channels][out_width][out_height],
+                      const dtype input[in_channels][width][height],
+                      const Weight_t weight, const Bias_t bias) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+    typename conv::Output_t conv_output;
+    conv::conv2d(conv_output, input, weight, bias);
+    pool::pool2d(output, conv_output);
+  }
+};
+
+template <int PIPELINE_II, int UNROLL_FACTOR, int PARTITION_FACTOR>
+struct Conv2dPool2dConfig {
+  static constexpr int pipeline_ii = PIPELINE_II;
+  static constexpr int unroll_factor = UNROLL_FACTOR;
+  static constexpr int partition_factor = PARTITION_FACTOR;
+};
+
+// ============================================================================
+// Optimized version (OPT_ENABLED)
+// ============================================================================
+// Pooling is applied as a convolution epilogue: for every pooled output row
+// only the pool_kernel_size convolution rows it covers are computed into a
+// small band buffer and reduced immediately, so the full-resolution
+// convolution output is never materialised. With pool_stride ==
+// pool_kernel_size (the usual case) every convolution row is computed once.
+template <typename DType, typename HParams, typename Config>
+class Conv2dPool2d<DType, HParams, Config, OPT_ENABLED> {
+public:
+  using dtype = DType;
+  using conv_hparams = typename HParams::conv_hparams;
+  using pool_hparams = typename HParams::pool_hparams;
+
+  static constexpr int in_channels = HParams::in_channels;
+  static constexpr int out_channels = HParams::out_channels;
+  static constexpr int width = HParams::width;
+  static constexpr int height = HParams::height;
+  static constexpr int out_width = HParams::out_width;
+  static constexpr int out_height = HParams::out_height;
+  static constexpr OptLevel opt_level = OPT_ENABLED;
+
+  static constexpr int kernel_size = conv_hparams::kernel_size;
+  static constexpr int padding = conv_hparams::padding;
+  static constexpr int stride = conv_hparams::stride;
+  static constexpr int dilation = conv_hparams::dilation;
+  static constexpr int groups = conv_hparams::groups;
+  static constexpr int in_channels_per_group = in_channels / groups;
+  static constexpr int out_channels_per_group = out_channels / groups;
+  static constexpr int conv_width = conv_hparams::out_width;
+  static constexpr int conv_height = conv_hparams::out_height;
+
+  static constexpr int pool_kernel_size = pool_hparams::kernel_size;
+  static constexpr int pool_stride = pool_hparams::stride;
+  static constexpr int pool_padding = pool_hparams::padding;
+
+  static constexpr int pipeline_ii = Config::pipeline_ii;
+  static constexpr int unroll_factor = Config::unroll_factor;
+  static constexpr int partition_factor = Config::partition_factor;
+
+  using conv = Conv2d<DType, conv_hparams, void, OPT_NONE>;
+  using impl = PoolImpl<dtype, HParams::pool_type,
+                        pool_kernel_size * pool_kernel_size>;
+
+  using Weight_t = typename conv::Weight_t;
+  using Bias_t = typename conv::Bias_t;
+  using Input_t = dtype[in_channels][width][height];
+  using Output_t = dtype[out_channels][out_width][out_height];
+
+  Conv2dPool2d() = default;
+  ~Conv2dPool2d() = default;
+
+  static void conv_pool2d(Output_t output, const Input_t input,
+                          const Weight_t weight, const Bias_t bias) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+    conv_pool2d_3d_impl(output, input, weight, bias);
+  }
+
+  static void conv_pool2d(dtype output[][out_channels][out_width][out_height],
+                          const dtype input[][in_channels][width][height],
+                          const int batch_size, const Weight_t weight,
+                          const Bias_t bias) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 32
+#endif
+  BATCH_LOOP:
+    for (int b = 0; b < batch_size; b++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_FLATTEN off
+#endif
+      conv_pool2d_3d_impl(output[b], input[b], weight, bias);
+    }
+  }
+
+private:
+  static void
+  conv_pool2d_3d_impl(dtype output[out_channels][out_width][out_height],
+                      const dtype input[in_channels][width][height],
+                      const Weight_t weight, const Bias_t bias) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+    if constexpr (partition_factor > 1 && in_channels <= 512) {
+#pragma HLS ARRAY_PARTITION variable = input type = cyclic factor =            \
+    partition_factor dim = 1
+#pragma HLS ARRAY_PARTITION variable = weight type = cyclic factor =           \
+    partition_factor dim = 2
+    }
+#endif
+    dtype band[pool_kernel_size][out_channels][conv_height];
+#ifdef __VITIS_HLS__
+#pragma HLS ARRAY_PARTITION variable = band type = complete dim = 1
+#endif
+
+  POOL_ROW_LOOP:
+    for (int py = 0; py < out_width; py++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 256
+#endif
+    BAND_ROW_LOOP:
+      for (int r = 0; r < pool_kernel_size; r++) {
+        const int conv_y = py * pool_stride + r - pool_padding;
+        if (conv_y < 0 || conv_y >= conv_width) {
+          continue;
+        }
+
+      OUT_CHANNEL_LOOP:
+        for (int oc = 0; oc < out_channels; oc++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 512
+#endif
+          const int group_base =
+              (oc / out_channels_per_group) * in_channels_per_group;
+
+        CONV_POS_X_LOOP:
+          for (int conv_x = 0; conv_x < conv_height; conv_x++) {
+#ifdef __VITIS_HLS__
+#pragma HLS PIPELINE II = pipeline_ii
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 512
+#endif
+            dtype acc = bias[oc];
+          IN_CHANNEL_LOOP:
+            for (int icg = 0; icg < in_channels_per_group; icg++) {
+#ifdef __VITIS_HLS__
+              if constexpr (unroll_factor > 1) {
+#pragma HLS UNROLL factor = unroll_factor
+              }
+#endif
+            KERNEL_Y_LOOP:
+              for (int ky = 0; ky < kernel_size; ky++) {
+              KERNEL_X_LOOP:
+                for (int kx = 0; kx < kernel_size; kx++) {
+                  int in_pos_y = conv_y * stride + ky * dilation - padding;
+                  int in_pos_x = conv_x * stride + kx * dilation - padding;
+                  if (in_pos_y >= 0 && in_pos_y < width && in_pos_x >= 0 &&
+                      in_pos_x < height) {
+                    acc += input[group_base + icg][in_pos_y][in_pos_x] *
+                           weight[oc][icg][ky][kx];
+                  }
+                }
+              }
+            }
+            band[r][oc][conv_x] = acc;
+          }
+        }
+      }
+
+    POOL_COL_LOOP:
+      for (int px = 0; px < out_height; px++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 256
+#endif
+      POOL_CHANNEL_LOOP:
+        for (int oc = 0; oc < out_channels; oc++) {
+#ifdef __VITIS_HLS__
+#pragma HLS PIPELINE II = pipeline_ii
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 512
+#endif
+          dtype acc = dtype(0.0f);
+          bool started = false;
+          for (int r = 0; r < pool_kernel_size; r++) {
+            for (int k = 0; k < pool_kernel_size; k++) {
+              const int conv_y = py * pool_stride + r - pool_padding;
+              const int conv_x = px * pool_stride + k - pool_padding;
+              if (conv_y >= 0 && conv_y < conv_width && conv_x >= 0 &&
+                  conv_x < conv_height) {
+                acc = started ? impl::kernel(acc, band[r][oc][conv_x])
+                              : band[r][oc][conv_x];
+                started = true;
+              }
+            }
+          }
+          output[oc][py][px] = impl::finalize(acc);
+        }
+      }
+    }
+  }
+};
+
+} // namespace vhn
@@ -0,0 +1,90 @@
+#pragma once
+
+#ifndef __VITIS_HLS__
+#include "../builder/builder.hh"
+#include "./conv2d_builder.hh"
+#include <sstream>
+
+namespace vhn {
+
+class Conv2dPool2dBuilder : public BaseBuilder {
+public:
+  std::string generate_hparams(const std::string &name,
+                               const std::string &dtype,
+                               const json &hparams) const override {
+    std::ostringstream oss;
+
+    NECESSARY_HPARAMS("Conv2dPool2d", name, "pool")
+
+    const auto &pool = hparams["pool"];
+    if (!pool.contains("kernel_size")) {
+      throw std::runtime_error("Conv2dPool2d module '" + name +
+                               "' missing pool.kernel_size param");
+    }
+
+    auto pool_type = pool.value("type", std::string("max"));
+    std::string pool_enum;
+    if (pool_type == "max") {
+      pool_enum = "vhn::POOL_MAX";
+    } else if (pool_type == "avg") {
+      pool_enum = "vhn::POOL_AVG";
+    } else {
+      throw std::runtime_error("Unsupported Conv2dPool2d pool type: " +
+                               pool_type);
+    }
+
+    auto pool_kernel_size = pool["kernel_size"].get<int>();
+    auto pool_stride = pool.value("stride", pool_kernel_size);
+    auto pool_padding = pool.value("padding", 0);
+
+    Conv2dBuilder conv_builder;
+    oss << conv_builder.generate_hparams(name + "_conv", dtype, hparams);
+
+    oss << "using " << name << "_hparams = vhn::Conv2dPool2dHParams<";
+    oss << name << "_conv_hparams, " << pool_enum << ", " << pool_kernel_size
+        << ", " << pool_stride << ", " << pool_padding;
+    oss << ">;\n\n";
+
+    return oss.str();
+  }
+
+  std::string generate_config(const std::string &name,
+                              const json &hls_cfg) const override {
+    if (hls_cfg.empty() || hls_cfg.is_null()) {
+      return "";
+    }
+
+    std::ostringstream oss;
+
+    auto pipeline_ii = hls_cfg.value("pipeline_ii", 1);
+    auto unroll_factor = hls_cfg.value("unroll_factor", 1);
+    auto partition_factor = hls_cfg.value("partition_factor", 4);
+
+    oss << "using " << name << "_cfg = vhn::Conv2dPool2dConfig<";
+    oss << pipeline_ii << ", " << unroll_factor << ", " << partition_factor;
+    oss << ">;\n\n";
+
+    return oss.str();
+  }
+
+  std::string generate_type_alias(const std::string &name,
+                                  const std::string &dtype,
+                                  const json &hls_cfg) const override {
+    std::ostringstream oss;
+
+    std::string opt_level = "OPT_NONE";
+
+    if (!hls_cfg.empty() && !hls_cfg.is_null()) {
+      opt_level = "OPT_ENABLED";
+    }
+
+    std::string config_type =
+        (opt_level == "OPT_NONE") ? "void" : (name + "_cfg");
+
+    GENERATE_TYPE_ALIAS(oss, "Conv2dPool2d", name, dtype, opt_level)
+    return oss.str();
+  }
+};
+
+} // namespace vhn
+#endif
@@ -0,0 +1,44 @@
+#pragma once
+
+namespace vhn {
+
+// ============================================================================
+// Phase decomposition for transposed convolution
+// ============================================================================
+// Along one axis a transposed convolution scatters x[i] * w[k] to
+// o = i * STRIDE - PADDING + k * DILATION. Gathering instead, output o only
+// receives taps with k * DILATION == (o + PADDING) (mod STRIDE), from
+// i = (o + PADDING - k * DILATION) / STRIDE. Grouping the taps by that phase
+// once means every output runs exactly its contributing MACs, and nothing
+// is multiplied against the zeros a zero-inserted input would contain.
+template <int KERNEL_SIZE, int STRIDE, int DILATION> struct TransposePhases {
+  static constexpr int kernel_size = KERNEL_SIZE;
+  static constexpr int stride = STRIDE;
+  static constexpr int dilation = DILATION;
+
+  struct Table {
+    int count[STRIDE];
+    int taps[STRIDE][KERNEL_SIZE];
+  };
+
+  static constexpr Table make_table() {
+    Table table{};
+    for (int k = 0; k < KERNEL_SIZE; k++) {
+      const int phase = (k * DILATION) % STRIDE;
+      table.taps[phase][table.count[phase]++] = k;
+    }
+    return table;
+  }
+
+  static constexpr Table table = make_table();
+
+  static constexpr int max_taps() {
+    int m = 0;
+    for (int p = 0; p < STRIDE; p++) {
+      m = table.count[p] > m ? table.count[p] : m;
+    }
+    return m;
+  }
+};
+
+} // namespace vhn
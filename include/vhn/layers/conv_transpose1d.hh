@@ -0,0 +1,260 @@
+#pragma once
+
+#include "../opt_level.hh"
+#include "./conv_transpose.hh"
+
+namespace vhn {
+
+template <typename DType, typename HParams, typename Config = void,
+          OptLevel OPT_LEVEL = OPT_NONE>
+class ConvTranspose1d;
+
+// Weight_t follows the PyTorch ConvTranspose layout,
+// [in_channels][out_channels / groups][kernel_size].
+template <int IN_CHANNELS, int OUT_CHANNELS, int KERNEL_SIZE, int PADDING,
+          int N, int STRIDE = 1, int OUTPUT_PADDING = 0, int DILATION = 1,
+          int GROUPS = 1>
+struct ConvTranspose1dHParams {
+  static constexpr int in_channels = IN_CHANNELS;
+  static constexpr int out_channels = OUT_CHANNELS;
+  static constexpr int kernel_size = KERNEL_SIZE;
+  static constexpr int padding = PADDING;
+  static constexpr int n = N;
+  static constexpr int stride = STRIDE;
+  static constexpr int output_padding = OUTPUT_PADDING;
+  static constexpr int dilation = DILATION;
+  static constexpr int groups = GROUPS;
+  static constexpr int out_length = (N - 1) * STRIDE - 2 * PADDING +
+                                    DILATION * (KERNEL_SIZE - 1) +
+                                    OUTPUT_PADDING + 1;
+
+  static_assert(IN_CHANNELS % GROUPS == 0 && OUT_CHANNELS % GROUPS == 0,
+                "ConvTranspose1d channels must be divisible by groups");
+  static_assert(OUTPUT_PADDING < STRIDE || OUTPUT_PADDING < DILATION,
+                "ConvTranspose1d output_padding must be smaller than stride "
+                "or dilation");
+};
+
+// ============================================================================
+// Non-optimized version (OPT_NONE)
+// ============================================================================
+// Reference scatter: every input sample adds x * w[k] to each output it
+// reaches.
+template <typename DType, typename HParams>
+class ConvTranspose1d<DType, HParams, void, OPT_NONE> {
+public:
+  using dtype = DType;
+  static constexpr int in_channels = HParams::in_channels;
+  static constexpr int out_channels = HParams::out_channels;
+  static constexpr int kernel_size = HParams::kernel_size;
+  static constexpr int padding = HParams::padding;
+  static constexpr int n = HParams::n;
+  static constexpr int out_length = HParams::out_length;
+  static constexpr int stride = HParams::stride;
+  static constexpr int dilation = HParams::dilation;
+  static constexpr int groups = HParams::groups;
+  static constexpr int in_channels_per_group = in_channels / groups;
+  static constexpr int out_channels_per_group = out_channels / groups;
+  static constexpr OptLevel opt_level = OPT_NONE;
+
+  using Weight_t = dtype[in_channels][out_channels_per_group][kernel_size];
+  using Bias_t = dtype[out_channels];
+  using Input_t = dtype[in_channels][n];
+  using Output_t = dtype[out_channels][out_length];
+
+  ConvTranspose1d() = default;
+  ~ConvTranspose1d() = default;
+
+  static void conv_transpose1d(Output_t output, const Input_t input,
+                               const Weight_t weight, const Bias_t bias) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+    conv_transpose1d_2d_impl(output, input, weight, bias);
+  }
+
+  static void conv_transpose1d(dtype output[][out_channels][out_length],
+                               const dtype input[][in_channels][n],
+                               const Weight_t weight, const Bias_t bias,
+                               const int batch_size) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 32
+#endif
+  BATCH_LOOP:
+    for (int b = 0; b < batch_size; b++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_FLATTEN off
+#endif
+      conv_transpose1d_2d_impl(output[b], input[b], weight, bias);
+    }
+  }
+
+private:
+  static void
+  conv_transpose1d_2d_impl(dtype output[out_channels][out_length],
+                           const dtype input[in_channels][n],
+                           const Weight_t weight, const Bias_t bias) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+  INIT_LOOP:
+    for (int oc = 0; oc < out_channels; oc++) {
+      for (int pos = 0; pos < out_length; pos++) {
+        output[oc][pos] = bias[oc];
+      }
+    }
+
+  IN_CHANNEL_LOOP:
+    for (int ic = 0; ic < in_channels; ic++) {
+      const int oc_base = (ic / in_channels_per_group) * out_channels_per_group;
+    IN_POS_LOOP:
+      for (int i = 0; i < n; i++) {
+      OUT_CHANNEL_LOOP:
+        for (int ocg = 0; ocg < out_channels_per_group; ocg++) {
+        KERNEL_LOOP:
+          for (int k = 0; k < kernel_size; k++) {
+            const int pos = i * stride - padding + k * dilation;
+            if (pos >= 0 && pos < out_length) {
+              output[oc_base + ocg][pos] += input[ic][i] * weight[ic][ocg][k];
+            }
+          }
+        }
+      }
+    }
+  }
+};
+
+template <int PIPELINE_II, int UNROLL_FACTOR, int PARTITION_FACTOR>
+struct ConvTranspose1dConfig {
+  static constexpr int pipeline_ii = PIPELINE_II;
+  static constexpr int unroll_factor = UNROLL_FACTOR;
+  static constexpr int partition_factor = PARTITION_FACTOR;
+};
+
+// ============================================================================
+// Optimized version (OPT_ENABLED)
+// ============================================================================
+// Phase-decomposed gather (see TransposePhases): each output sample runs only
+// the taps of its phase, so a stride-S layer does 1/S of the MACs of a
+// convolution over the zero-inserted input, with no scatter conflicts.
+template <typename DType, typename HParams, typename Config>
+class ConvTranspose1d<DType, HParams, Config, OPT_ENABLED> {
+public:
+  using dtype = DType;
+  static constexpr int in_channels = HParams::in_channels;
+  static constexpr int out_channels = HParams::out_channels;
+  static constexpr int kernel_size = HParams::kernel_size;
+  static constexpr int padding = HParams::padding;
+  static constexpr int n = HParams::n;
+  static constexpr int out_length = HParams::out_length;
+  static constexpr int stride = HParams::stride;
+  static constexpr int dilation = HParams::dilation;
+  static constexpr int groups = HParams::groups;
+  static constexpr int in_channels_per_group = in_channels / groups;
+  static constexpr int out_channels_per_group = out_channels / groups;
+  static constexpr OptLevel opt_level = OPT_ENABLED;
+
+  static constexpr int pipeline_ii = Config::pipeline_ii;
+  static constexpr int unroll_factor = Config::unroll_factor;
+  static constexpr int partition_factor = Config::partition_factor;
+
+  using phases = TransposePhases<kernel_size, stride, dilation>;
+  static constexpr int max_taps = phases::max_taps();
+
+  using Weight_t = dtype[in_channels][out_channels_per_group][kernel_size];
+  using Bias_t = dtype[out_channels];
+  using Input_t = dtype[in_channels][n];
+  using Output_t = dtype[out_channels][out_length];
+
+  ConvTranspose1d() = default;
+  ~ConvTranspose1d() = default;
+
+  static void conv_transpose1d(Output_t output, const Input_t input,
+                               const Weight_t weight, const Bias_t bias) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+    conv_transpose1d_2d_impl(output, input, weight, bias);
+  }
+
+  static void conv_transpose1d(dtype output[][out_channels][out_length],
+                               const dtype input[][in_channels][n],
+                               const Weight_t weight, const Bias_t bias,
+                               const int batch_size) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 32
+#endif
+  BATCH_LOOP:
+    for (int b = 0; b < batch_size; b++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_FLATTEN off
+#endif
+      conv_transpose1d_2d_impl(output[b], input[b], weight, bias);
+    }
+  }
+
+private:
+  static void
+  conv_transpose1d_2d_impl(dtype output[out_channels][out_length],
+                           const dtype input[in_channels][n],
+                           const Weight_t weight, const Bias_t bias) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+    if constexpr (partition_factor > 1 && in_channels <= 512) {
+#pragma HLS ARRAY_PARTITION variable = input type = cyclic factor =            \
+    partition_factor dim = 1
+#pragma HLS ARRAY_PARTITION variable = weight type = cyclic factor =           \
+    partition_factor dim = 1
+    }
+#endif
+
+  OUT_CHANNEL_LOOP:
+    for (int oc = 0; oc < out_channels; oc++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 512
+#endif
+      const int group = oc / out_channels_per_group;
+      const int ocg = oc % out_channels_per_group;
+      const int ic_base = group * in_channels_per_group;
+
+    OUT_POS_LOOP:
+      for (int pos = 0; pos < out_length; pos++) {
+#ifdef __VITIS_HLS__
+#pragma HLS PIPELINE II = pipeline_ii
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 1024
+#endif
+        const int t = pos + padding;
+        const int phase = t % stride;
+        dtype acc = bias[oc];
+
+      IN_CHANNEL_LOOP:
+        for (int icg = 0; icg < in_channels_per_group; icg++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 512
+          if constexpr (unroll_factor > 1) {
+#pragma HLS UNROLL factor = unroll_factor
+          }
+#endif
+        PHASE_TAP_LOOP:
+          for (int j = 0; j < max_taps; j++) {
+#ifdef __VITIS_HLS__
+#pragma HLS UNROLL
+#endif
+            if (j < phases::table.count[phase]) {
+              const int k = phases::table.taps[phase][j];
+              const int i = (t - k * dilation) / stride;
+              if (t >= k * dilation && i < n) {
+                acc += input[ic_base + icg][i] * weight[ic_base + icg][ocg][k];
+              }
+            }
+          }
+        }
+        output[oc][pos] = acc;
+      }
+    }
+  }
+};
+
+} // namespace vhn
@@ -0,0 +1,310 @@
+#pragma once
+
+#include "../opt_level.hh"
+#include "./conv_transpose.hh"
+
+namespace vhn {
+
+template <typename DType, typename HParams, typename Config = void,
+          OptLevel OPT_LEVEL = OPT_NONE>
+class ConvTranspose2d;
+
+// Weight_t follows the PyTorch ConvTranspose layout,
+// [in_channels][out_channels / groups][kernel_size][kernel_size].
+template <int IN_CHANNELS, int OUT_CHANNELS, int KERNEL_SIZE, int PADDING,
+          int WIDTH, int HEIGHT, int STRIDE = 1, int OUTPUT_PADDING = 0,
+          int DILATION = 1, int GROUPS = 1>
+struct ConvTranspose2dHParams {
+  static constexpr int in_channels = IN_CHANNELS;
+  static constexpr int out_channels = OUT_CHANNELS;
+  static constexpr int kernel_size = KERNEL_SIZE;
+  static constexpr int padding = PADDING;
+  static constexpr int width = WIDTH;
+  static constexpr int height = HEIGHT;
+  static constexpr int stride = STRIDE;
+  static constexpr int output_padding = OUTPUT_PADDING;
+  static constexpr int dilation = DILATION;
+  static constexpr int groups = GROUPS;
+  static constexpr int out_width = (WIDTH - 1) * STRIDE - 2 * PADDING +
+                                   DILATION * (KERNEL_SIZE - 1) +
+                                   OUTPUT_PADDING + 1;
+  static constexpr int out_height = (HEIGHT - 1) * STRIDE - 2 * PADDING +
+                                    DILATION * (KERNEL_SIZE - 1) +
+                                    OUTPUT_PADDING + 1;
+
+  static_assert(IN_CHANNELS % GROUPS == 0 && OUT_CHANNELS % GROUPS == 0,
+                "ConvTranspose2d channels must be divisible by groups");
+  static_assert(OUTPUT_PADDING < STRIDE || OUTPUT_PADDING < DILATION,
+                "ConvTranspose2d output_padding must be smaller than stride "
+                "or dilation");
+};
+
+// ============================================================================
+// Non-optimized version (OPT_NONE)
+// ============================================================================
+// Reference scatter: every input pixel adds x * w[ky][kx] to each output it
+// reaches.
+template <typename DType, typename HParams>
+class ConvTranspose2d<DType, HParams, void, OPT_NONE> {
+public:
+  using dtype = DType;
+  static constexpr int in_channels = HParams::in_channels;
+  static constexpr int out_channels = HParams::out_channels;
+  static constexpr int kernel_size = HParams::kernel_size;
+  static constexpr int padding = HParams::padding;
+  static constexpr int width = HParams::width;
+  static constexpr int height = HParams::height;
+  static constexpr int out_width = HParams::out_width;
+  static constexpr int out_height = HParams::out_height;
+  static constexpr int stride = HParams::stride;
+  static constexpr int dilation = HParams::dilation;
+  static constexpr int groups = HParams::groups;
+  static constexpr int in_channels_per_group = in_channels / groups;
+  static constexpr int out_channels_per_group = out_channels / groups;
+  static constexpr OptLevel opt_level = OPT_NONE;
+
+  using Weight_t =
+      dtype[in_channels][out_channels_per_group][kernel_size][kernel_size];
+  using Bias_t = dtype[out_channels];
+  using Input_t = dtype[in_channels][width][height];
+  using Output_t = dtype[out_channels][out_width][out_height];
+
+  ConvTranspose2d() = default;
+  ~ConvTranspose2d() = default;
+
+  static void conv_transpose2d(Output_t output, const Input_t input,
+                               const Weight_t weight, const Bias_t bias) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+    conv_transpose2d_3d_impl(output, input, weight, bias);
+  }
+
+  static void
+  conv_transpose2d(dtype output[][out_channels][out_width][out_height],
+                   const dtype input[][in_channels][width][height],
+                   const int batch_size, const Weight_t weight,
+                   const Bias_t bias) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 32
+#endif
+  BATCH_LOOP:
+    for (int b = 0; b < batch_size; b++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_FLATTEN off
+#endif
+      conv_transpose2d_3d_impl(output[b], input[b], weight, bias);
+    }
+  }
+
+private:
+  static void
+  conv_transpose2d_3d_impl(dtype output[out_channels][out_width][out_height],
+                           const dtype input[in_channels][width][height],
+                           const Weight_t weight, const Bias_t bias) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+  INIT_LOOP:
+    for (int oc = 0; oc < out_channels; oc++) {
+      for (int y = 0; y < out_width; y++) {
+        for (int x = 0; x < out_height; x++) {
+          output[oc][y][x] = bias[oc];
+        }
+      }
+    }
+
+  IN_CHANNEL_LOOP:
+    for (int ic = 0; ic < in_channels; ic++) {
+      const int oc_base = (ic / in_channels_per_group) * out_channels_per_group;
+    IN_POS_Y_LOOP:
+      for (int iy = 0; iy < width; iy++) {
+      IN_POS_X_LOOP:
+        for (int ix = 0; ix < height; ix++) {
+          const dtype x_val = input[ic][iy][ix];
+        OUT_CHANNEL_LOOP:
+          for (int ocg = 0; ocg < out_channels_per_group; ocg++) {
+          KERNEL_Y_LOOP:
+            for (int ky = 0; ky < kernel_size; ky++) {
+              const int pos_y = iy * stride - padding + ky * dilation;
+              if (pos_y < 0 || pos_y >= out_width) {
+                continue;
+              }
+            KERNEL_X_LOOP:
+              for (int kx = 0; kx < kernel_size; kx++) {
+                const int pos_x = ix * stride - padding + kx * dilation;
+                if (pos_x >= 0 && pos_x < out_height) {
+                  output[oc_base + ocg][pos_y][pos_x] +=
+                      x_val * weight[ic][ocg][ky][kx];
+                }
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+};
+
+template <int PIPELINE_II, int UNROLL_FACTOR, int PARTITION_FACTOR>
+struct ConvTranspose2dConfig {
+  static constexpr int pipeline_ii = PIPELINE_II;
+  static constexpr int unroll_factor = UNROLL_FACTOR;
+  static constexpr int partition_factor = PARTITION_FACTOR;
+};
+
+// ============================================================================
+// Optimized version (OPT_ENABLED)
+// ============================================================================
+// Phase-decomposed gather, separable over the two axes: output (y, x) runs
+// only the taps of its (phase_y, phase_x) sub-kernel, i.e. K^2 / S^2 MACs per
+// input channel instead of K^2 over a zero-inserted input.
+template <typename DType, typename HParams, typename Config>
+class ConvTranspose2d<DType, HParams, Config, OPT_ENABLED> {
+public:
+  using dtype = DType;
+  static constexpr int in_channels = HParams::in_channels;
+  static constexpr int out_channels = HParams::out_channels;
+  static constexpr int kernel_size = HParams::kernel_size;
+  static constexpr int padding = HParams::padding;
+  static constexpr int width = HParams::width;
+  static constexpr int height = HParams::height;
+  static constexpr int out_width = HParams::out_width;
+  static constexpr int out_height = HParams::out_height;
+  static constexpr int stride = HParams::stride;
+  static constexpr int dilation = HParams::dilation;
+  static constexpr int groups = HParams::groups;
+  static constexpr int in_channels_per_group = in_channels / groups;
+  static constexpr int out_channels_per_group = out_channels / groups;
+  static constexpr OptLevel opt_level = OPT_ENABLED;
+
+  static constexpr int pipeline_ii = Config::pipeline_ii;
+  static constexpr int unroll_factor = Config::unroll_factor;
+  static constexpr int partition_factor = Config::partition_factor;
+
+  using phases = TransposePhases<kernel_size, stride, dilation>;
+  static constexpr int max_taps = phases::max_taps();
+
+  using Weight_t =
+      dtype[in_channels][out_channels_per_group][kernel_size][kernel_size];
+  using Bias_t = dtype[out_channels];
+  using Input_t = dtype[in_channels][width][height];
+  using Output_t = dtype[out_channels][out_width][out_height];
+
+  ConvTranspose2d() = default;
+  ~ConvTranspose2d() = default;
+
+  static void conv_transpose2d(Output_t output, const Input_t input,
+                               const Weight_t weight, const Bias_t bias) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+    conv_transpose2d_3d_impl(output, input, weight, bias);
+  }
+
+  static void
+  conv_transpose2d(dtype output[][out_channels][out_width][out_height],
+                   const dtype input[][in_channels][width][height],
+                   const int batch_size, const Weight_t weight,
+                   const Bias_t bias) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 32
+#endif
+  BATCH_LOOP:
+    for (int b = 0; b < batch_size; b++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_FLATTEN off
+#endif
+      conv_transpose2d_3d_impl(output[b], input[b], weight, bias);
+    }
+  }
+
+private:
+  static void
+  conv_transpose2d_3d_impl(dtype output[out_channels][out_width][out_height],
+                           const dtype input[in_channels][width][height],
+                           const Weight_t weight, const Bias_t bias) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+    if constexpr (partition_factor > 1 && in_channels <= 512) {
+#pragma HLS ARRAY_PARTITION variable = input type = cyclic factor =            \
+    partition_factor dim = 1
+#pragma HLS ARRAY_PARTITION variable = weight type = cyclic factor =           \
+    partition_factor dim = 1
+    }
+#endif
+
+  OUT_CHANNEL_LOOP:
+    for (int oc = 0; oc < out_channels; oc++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 512
+#endif
+      const int group = oc / out_channels_per_group;
+      const int ocg = oc % out_channels_per_group;
+      const int ic_base = group * in_channels_per_group;
+
+    OUT_POS_Y_LOOP:
+      for (int pos_y = 0; pos_y < out_width; pos_y++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 512
+#endif
+        const int ty = pos_y + padding;
+        const int phase_y = ty % stride;
+
+      OUT_POS_X_LOOP:
+        for (int pos_x = 0; pos_x < out_height; pos_x++) {
+#ifdef __VITIS_HLS__
+#pragma HLS PIPELINE II = pipeline_ii
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 512
+#endif
+          const int tx = pos_x + padding;
+          const int phase_x = tx % stride;
+          dtype acc = bias[oc];
+
+        IN_CHANNEL_LOOP:
+          for (int icg = 0; icg < in_channels_per_group; icg++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 512
+            if constexpr (unroll_factor > 1) {
+#pragma HLS UNROLL factor = unroll_factor
+            }
+#endif
+            const int ic = ic_base + icg;
+          PHASE_TAP_Y_LOOP:
+            for (int jy = 0; jy < max_taps; jy++) {
+#ifdef __VITIS_HLS__
+#pragma HLS UNROLL
+#endif
+              if (jy >= phases::table.count[phase_y]) {
+                continue;
+              }
+              const int ky = phases::table.taps[phase_y][jy];
+              const int iy = (ty - ky * dilation) / stride;
+              if (ty < ky * dilation || iy >= width) {
+                continue;
+              }
+            PHASE_TAP_X_LOOP:
+              for (int jx = 0; jx < max_taps; jx++) {
+#ifdef __VITIS_HLS__
+#pragma HLS UNROLL
+#endif
+                if (jx < phases::table.count[phase_x]) {
+                  const int kx = phases::table.taps[phase_x][jx];
+                  const int ix = (tx - kx * dilation) / stride;
+                  if (tx >= kx * dilation && ix < height) {
+                    acc += input[ic][iy][ix] * weight[ic][ocg][ky][kx];
+                  }
+                }
+              }
+            }
+          }
+          output[oc][pos_y][pos_x] = acc;
+        }
+      }
+    }
+  }
+};
+
+} // namespace vhn
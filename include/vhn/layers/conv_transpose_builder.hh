@@ -0,0 +1,109 @@
+#pragma once
+
+#ifndef __VITIS_HLS__
+#include "../builder/builder.hh"
+#include <sstream>
+#include <vector>
+
+namespace vhn {
+
+// Shared by ConvTranspose1d ("n") / ConvTranspose2d ("width", "height").
+class ConvTransposeBuilder : public BaseBuilder {
+public:
+  ConvTransposeBuilder(const std::string &type,
+                       const std::vector<std::string> &spatial)
+      : _type(type), _spatial(spatial) {}
+
+  std::string generate_hparams(const std::string &name,
+                               const std::string &dtype,
+                               const json &hparams) const override {
+    std::ostringstream oss;
+
+    NECESSARY_HPARAMS(_type, name, "in_channels")
+    NECESSARY_HPARAMS(_type, name, "out_channels")
+    NECESSARY_HPARAMS(_type, name, "kernel_size")
+    NECESSARY_HPARAMS(_type, name, "padding")
+    for (const auto &key : _spatial) {
+      NECESSARY_HPARAMS(_type, name, key)
+    }
+
+    auto in_channels = hparams["in_channels"].get<int>();
+    auto out_channels = hparams["out_channels"].get<int>();
+    auto kernel_size = hparams["kernel_size"].get<int>();
+    auto padding = hparams["padding"].get<int>();
+
+    auto stride = hparams.value("stride", 1);
+    auto output_padding = hparams.value("output_padding", 0);
+    auto dilation = hparams.value("dilation", 1);
+    auto groups = hparams.value("groups", 1);
+
+    oss << "using " << name << "_hparams = vhn::" << _type << "HParams<";
+    oss << in_channels << ", " << out_channels << ", " << kernel_size << ", "
+        << padding;
+    for (const auto &key : _spatial) {
+      oss << ", " << hparams[key].get<int>();
+    }
+    if (stride != 1 || output_padding != 0 || dilation != 1 || groups != 1) {
+      oss << ", " << stride << ", " << output_padding << ", " << dilation
+          << ", " << groups;
+    }
+    oss << ">;\n\n";
+
+    return oss.str();
+  }
+
+  std::string generate_config(const std::string &name,
+                              const json &hls_cfg) const override {
+    if (hls_cfg.empty() || hls_cfg.is_null()) {
+      return "";
+    }
+
+    std::ostringstream oss;
+
+    auto pipeline_ii = hls_cfg.value("pipeline_ii", 1);
+    auto unroll_factor = hls_cfg.value("unroll_factor", 1);
+    auto partition_factor = hls_cfg.value("partition_factor", 4);
+
+    oss << "using " << name << "_cfg = vhn::" << _type << "Config<";
+    oss << pipeline_ii << ", " << unroll_factor << ", " << partition_factor;
+    oss << ">;\n\n";
+
+    return oss.str();
+  }
+
+  std::string generate_type_alias(const std::string &name,
+                                  const std::string &dtype,
+                                  const json &hls_cfg) const override {
+    std::ostringstream oss;
+
+    std::string opt_level = "OPT_NONE";
+
+    if (!hls_cfg.empty() && !hls_cfg.is_null()) {
+      opt_level = "OPT_ENABLED";
+    }
+
+    std::string config_type =
+        (opt_level == "OPT_NONE") ? "void" : (name + "_cfg");
+
+    GENERATE_TYPE_ALIAS(oss, _type, name, dtype, opt_level)
+    return oss.str();
+  }
+
+private:
+  std::string _type;
+  std::vector<std::string> _spatial;
+};
+
+class ConvTranspose1dBuilder : public ConvTransposeBuilder {
+public:
+  ConvTranspose1dBuilder() : ConvTransposeBuilder("ConvTranspose1d", {"n"}) {}
+};
+
+class ConvTranspose2dBuilder : public ConvTransposeBuilder {
+public:
+  ConvTranspose2dBuilder()
+      : ConvTransposeBuilder("ConvTranspose2d", {"width", "height"}) {}
+};
+
+} // namespace vhn
+#endif
@@ -1,6 +1,9 @@
 #pragma once
 
 #include "../opt_level.hh"
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
 
 #ifdef __VITIS_HLS__
 #include <hls_stream.h>
@@ -12,6 +15,8 @@ template <typename DType, typename HParams, typename Config = void,
           OptLevel OPT_LEVEL = OPT_NONE>
 class Embedding;
 
+// The gathers read only weight[index] rows, so Weight_t may be a
+// MappedTensor on the host: rows that are never looked up are never paged in.
 template <int VOCAB_SIZE, int EMBED_SIZE> struct EmbeddingHParams {
   static constexpr int vocab_size = VOCAB_SIZE;
   static constexpr int embed_size = EMBED_SIZE;
@@ -126,11 +131,19 @@ private:
 #endif
 };
 
-template <int PIPELINE_II, int UNROLL_FACTOR, int PARTITION_FACTOR>
+// PREFETCH_DISTANCE / DEDUP_SLOTS select the host batched gather (see
+// Embedding::gather_host_impl); both are ignored under HLS.
+template <int PIPELINE_II, int UNROLL_FACTOR, int PARTITION_FACTOR,
+          int PREFETCH_DISTANCE = 0, int DEDUP_SLOTS = 0>
 struct EmbeddingConfig {
   static constexpr int pipeline_ii = PIPELINE_II;
   static constexpr int unroll_factor = UNROLL_FACTOR;
   static constexpr int partition_factor = PARTITION_FACTOR;
+  static constexpr int prefetch_distance = PREFETCH_DISTANCE;
+  static constexpr int dedup_slots = DEDUP_SLOTS;
+
+  static_assert((DEDUP_SLOTS & (DEDUP_SLOTS - 1)) == 0,
+                "Embedding dedup_slots must be zero or a power of two");
 };
 
 // ============================================================================
@@ -147,6 +160,9 @@ public:
   static constexpr int pipeline_ii = Config::pipeline_ii;
   static constexpr int unroll_factor = Config::unroll_factor;
   static constexpr int partition_factor = Config::partition_factor;
+  static constexpr int prefetch_distance = Config::prefetch_distance;
+  static constexpr int dedup_slots = Config::dedup_slots;
+  static constexpr bool host_gather = prefetch_distance > 0 || dedup_slots > 0;
 
   using Weight_t = dtype[vocab_size][embed_size];
 
@@ -165,6 +181,11 @@ public:
                   const int batch_size, const Weight_t weight) {
 #ifdef __VITIS_HLS__
 #pragma HLS INLINE off
+#else
+    if constexpr (host_gather) {
+      gather_host_impl(&output[0][0], input, batch_size, weight);
+      return;
+    }
 #endif
   BATCH_LOOP:
     for (int i = 0; i < batch_size; i++) {
@@ -224,6 +245,12 @@ private:
 
   static void emb_impl_1d(dtype *output, const int *input, const int length,
                           const Weight_t weight) {
+#ifndef __VITIS_HLS__
+    if constexpr (host_gather) {
+      gather_host_impl(output, input, length, weight);
+      return;
+    }
+#endif
 #ifdef __VITIS_HLS__
 #pragma HLS INLINE off
     constexpr bool should_partition =
@@ -254,6 +281,72 @@ private:
     }
   }
 
+#ifndef __VITIS_HLS__
+  // Host batched gather over a whole index sequence:
+  //  - rows prefetch_distance tokens ahead are prefetched line by line, so
+  //    their misses overlap the current copies;
+  //  - a direct-mapped table of dedup_slots (index -> output row) entries
+  //    serves repeated tokens from the already-written, cache-hot output row
+  //    instead of the table (lossy on slot collisions, which only costs a
+  //    refetch);
+  //  - rows are copied with memcpy, which compiles to wide vector moves.
+  static void gather_host_impl(dtype *output, const int *input,
+                               const int length, const Weight_t weight) {
+    constexpr int row_bytes = embed_size * sizeof(dtype);
+    constexpr int slots = dedup_slots > 0 ? dedup_slots : 1;
+    constexpr int slot_bits = [] {
+      int bits = 0;
+      while ((1 << bits) < slots) {
+        bits++;
+      }
+      return bits;
+    }();
+    int slot_index[slots];
+    int slot_row[slots];
+    for (int s = 0; s < slots; s++) {
+      slot_index[s] = -1;
+    }
+
+  GATHER_LOOP:
+    for (int i = 0; i < length; i++) {
+#if defined(__GNUC__)
+      if constexpr (prefetch_distance > 0) {
+        if (i + prefetch_distance < length) {
+          const char *next = reinterpret_cast<const char *>(
+              weight[input[i + prefetch_distance]]);
+          for (int b = 0; b < row_bytes; b += 64) {
+            __builtin_prefetch(next + b);
+          }
+        }
+      }
+#endif
+      const int idx = input[i];
+      const dtype *src = weight[idx];
+      if constexpr (dedup_slots > 0) {
+        // Fibonacci hashing: the top slot_bits bits of idx * 2^32 / phi.
+        const std::uint32_t hash =
+            static_cast<std::uint32_t>(idx) * 2654435761u;
+        const int slot = slot_bits == 0 ? 0 : int(hash >> (32 - slot_bits));
+        if (slot_index[slot] == idx) {
+          src = &output[slot_row[slot] * embed_size];
+        } else {
+          slot_index[slot] = idx;
+          slot_row[slot] = i;
+        }
+      }
+
+      dtype *dst = &output[i * embed_size];
+      if constexpr (std::is_trivially_copyable<dtype>::value) {
+        std::memcpy(dst, src, row_bytes);
+      } else {
+        for (int j = 0; j < embed_size; j++) {
+          dst[j] = src[j];
+        }
+      }
+    }
+  }
+#endif
+
 #ifdef __VITIS_HLS__
   static void emb_1d_stream_impl(hls::stream<dtype> &output,
                                  hls::stream<int> &input, const int length,
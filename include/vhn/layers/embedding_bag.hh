@@ -0,0 +1,292 @@
+#pragma once
+
+#include "../opt_level.hh"
+
+namespace vhn {
+
+enum EmbeddingBagMode { BAG_SUM, BAG_MEAN, BAG_MAX };
+
+template <typename DType, typename HParams, typename Config = void,
+          OptLevel OPT_LEVEL = OPT_NONE>
+class EmbeddingBag;
+
+// Pooled multi-index lookup: bag b covers indices[offsets[b]] up to
+// indices[offsets[b + 1]] (the last bag ends at num_indices), or is given by
+// lengths[b] in the bag_lengths forms. Empty bags produce zeros. As in
+// PyTorch, per-sample weights scale each row before pooling and are only
+// allowed in BAG_SUM mode.
+template <int VOCAB_SIZE, int EMBED_SIZE, EmbeddingBagMode MODE = BAG_SUM,
+          bool PER_SAMPLE_WEIGHTS = false>
+struct EmbeddingBagHParams {
+  static constexpr int vocab_size = VOCAB_SIZE;
+  static constexpr int embed_size = EMBED_SIZE;
+  static constexpr EmbeddingBagMode mode = MODE;
+  static constexpr bool per_sample_weights = PER_SAMPLE_WEIGHTS;
+
+  static_assert(!PER_SAMPLE_WEIGHTS || MODE == BAG_SUM,
+                "EmbeddingBag per-sample weights require BAG_SUM");
+};
+
+// ============================================================================
+// Non-optimized version (OPT_NONE)
+// ============================================================================
+template <typename DType, typename HParams>
+class EmbeddingBag<DType, HParams, void, OPT_NONE> {
+public:
+  using dtype = DType;
+  static constexpr int vocab_size = HParams::vocab_size;
+  static constexpr int embed_size = HParams::embed_size;
+  static constexpr EmbeddingBagMode mode = HParams::mode;
+  static constexpr bool per_sample_weights = HParams::per_sample_weights;
+  static constexpr OptLevel opt_level = OPT_NONE;
+
+  using Weight_t = dtype[vocab_size][embed_size];
+
+  EmbeddingBag() = default;
+  ~EmbeddingBag() = default;
+
+  // One bag of `length` indices.
+  static void bag(dtype output[embed_size], const int indices[],
+                  const int length, const Weight_t weight,
+                  const dtype sample_weights[] = nullptr) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+    bag_single(output, indices, length, weight, sample_weights);
+  }
+
+  static void bag(dtype output[][embed_size], const int indices[],
+                  const int offsets[], const int num_bags,
+                  const int num_indices, const Weight_t weight,
+                  const dtype sample_weights[] = nullptr) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+  BAG_LOOP:
+    for (int b = 0; b < num_bags; b++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_FLATTEN off
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 32
+#endif
+      const int start = offsets[b];
+      const int end = (b + 1 < num_bags) ? offsets[b + 1] : num_indices;
+      bag_single(output[b], &indices[start], end - start, weight,
+                 sample_weights ? &sample_weights[start] : nullptr);
+    }
+  }
+
+  static void bag_lengths(dtype output[][embed_size], const int indices[],
+                          const int lengths[], const int num_bags,
+                          const Weight_t weight,
+                          const dtype sample_weights[] = nullptr) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+    int start = 0;
+  BAG_LOOP:
+    for (int b = 0; b < num_bags; b++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_FLATTEN off
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 32
+#endif
+      bag_single(output[b], &indices[start], lengths[b], weight,
+                 sample_weights ? &sample_weights[start] : nullptr);
+      start += lengths[b];
+    }
+  }
+
+private:
+  static void bag_single(dtype output[embed_size], const int indices[],
+                         const int length, const Weight_t weight,
+                         const dtype sample_weights[]) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+  INIT_LOOP:
+    for (int j = 0; j < embed_size; j++) {
+      output[j] = (mode == BAG_MAX && length > 0) ? weight[indices[0]][j]
+                                                  : dtype(0);
+    }
+
+  INDEX_LOOP:
+    for (int i = 0; i < length; i++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 128
+#endif
+      const int idx = indices[i];
+    EMBED_LOOP:
+      for (int j = 0; j < embed_size; j++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 1024
+#endif
+        if constexpr (mode == BAG_MAX) {
+          output[j] = weight[idx][j] > output[j] ? weight[idx][j] : output[j];
+        } else if constexpr (per_sample_weights) {
+          output[j] += sample_weights[i] * weight[idx][j];
+        } else {
+          output[j] += weight[idx][j];
+        }
+      }
+    }
+
+    if constexpr (mode == BAG_MEAN) {
+      if (length > 0) {
+      MEAN_LOOP:
+        for (int j = 0; j < embed_size; j++) {
+          output[j] /= dtype(length);
+        }
+      }
+    }
+  }
+};
+
+template <int PIPELINE_II, int UNROLL_FACTOR, int PARTITION_FACTOR>
+struct EmbeddingBagConfig {
+  static constexpr int pipeline_ii = PIPELINE_II;
+  static constexpr int unroll_factor = UNROLL_FACTOR;
+  static constexpr int partition_factor = PARTITION_FACTOR;
+};
+
+// ============================================================================
+// Optimized version (OPT_ENABLED)
+// ============================================================================
+// Fused gather-reduce: each row is folded into an on-chip accumulator as it
+// is read, so no bag is ever materialised. The accumulator is partitioned to
+// match the unrolled embed loop, and the mean is one multiply by 1 / length.
+template <typename DType, typename HParams, typename Config>
+class EmbeddingBag<DType, HParams, Config, OPT_ENABLED> {
+public:
+  using dtype = DType;
+  static constexpr int vocab_size = HParams::vocab_size;
+  static constexpr int embed_size = HParams::embed_size;
+  static constexpr EmbeddingBagMode mode = HParams::mode;
+  static constexpr bool per_sample_weights = HParams::per_sample_weights;
+  static constexpr OptLevel opt_level = OPT_ENABLED;
+
+  static constexpr int pipeline_ii = Config::pipeline_ii;
+  static constexpr int unroll_factor = Config::unroll_factor;
+  static constexpr int partition_factor = Config::partition_factor;
+
+  using Weight_t = dtype[vocab_size][embed_size];
+
+  EmbeddingBag() = default;
+  ~EmbeddingBag() = default;
+
+  static void bag(dtype output[embed_size], const int indices[],
+                  const int length, const Weight_t weight,
+                  const dtype sample_weights[] = nullptr) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+    bag_single(output, indices, length, weight, sample_weights);
+  }
+
+  static void bag(dtype output[][embed_size], const int indices[],
+                  const int offsets[], const int num_bags,
+                  const int num_indices, const Weight_t weight,
+                  const dtype sample_weights[] = nullptr) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+  BAG_LOOP:
+    for (int b = 0; b < num_bags; b++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_FLATTEN off
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 32
+#endif
+      const int start = offsets[b];
+      const int end = (b + 1 < num_bags) ? offsets[b + 1] : num_indices;
+      bag_single(output[b], &indices[start], end - start, weight,
+                 sample_weights ? &sample_weights[start] : nullptr);
+    }
+  }
+
+  static void bag_lengths(dtype output[][embed_size], const int indices[],
+                          const int lengths[], const int num_bags,
+                          const Weight_t weight,
+                          const dtype sample_weights[] = nullptr) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+    int start = 0;
+  BAG_LOOP:
+    for (int b = 0; b < num_bags; b++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_FLATTEN off
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 32
+#endif
+      bag_single(output[b], &indices[start], lengths[b], weight,
+                 sample_weights ? &sample_weights[start] : nullptr);
+      start += lengths[b];
+    }
+  }
+
+private:
+  static void bag_single(dtype output[embed_size], const int indices[],
+                         const int length, const Weight_t weight,
+                         const dtype sample_weights[]) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+    dtype acc[embed_size];
+#ifdef __VITIS_HLS__
+    if constexpr (partition_factor > 1 && embed_size <= 2048) {
+#pragma HLS ARRAY_PARTITION variable = acc type = cyclic factor =              \
+    partition_factor
+#pragma HLS ARRAY_PARTITION variable = weight type = cyclic factor =           \
+    partition_factor dim = 2
+    }
+#endif
+
+    // BAG_MAX seeds with the first row, so its index loop starts at 1.
+    const int first = (mode == BAG_MAX && length > 0) ? 1 : 0;
+  ACC_INIT_LOOP:
+    for (int j = 0; j < embed_size; j++) {
+#ifdef __VITIS_HLS__
+#pragma HLS PIPELINE II = 1
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 2048
+#endif
+      acc[j] = first ? weight[indices[0]][j] : dtype(0);
+    }
+
+  INDEX_LOOP:
+    for (int i = first; i < length; i++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 128
+#endif
+      const dtype *row = weight[indices[i]];
+      const dtype w = per_sample_weights ? sample_weights[i] : dtype(1);
+    EMBED_LOOP:
+      for (int j = 0; j < embed_size; j++) {
+#ifdef __VITIS_HLS__
+#pragma HLS PIPELINE II = pipeline_ii
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 2048
+        if constexpr (unroll_factor > 1) {
+#pragma HLS UNROLL factor = unroll_factor
+        }
+#endif
+        if constexpr (mode == BAG_MAX) {
+          acc[j] = row[j] > acc[j] ? row[j] : acc[j];
+        } else if constexpr (per_sample_weights) {
+          acc[j] += w * row[j];
+        } else {
+          acc[j] += row[j];
+        }
+      }
+    }
+
+    const dtype norm = (mode == BAG_MEAN && length > 0)
+                           ? dtype(1) / dtype(length)
+                           : dtype(1);
+  WRITE_LOOP:
+    for (int j = 0; j < embed_size; j++) {
+#ifdef __VITIS_HLS__
+#pragma HLS PIPELINE II = 1
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 2048
+#endif
+      output[j] = (mode == BAG_MEAN) ? acc[j] * norm : acc[j];
+    }
+  }
+};
+
+} // namespace vhn
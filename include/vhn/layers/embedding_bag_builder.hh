@@ -0,0 +1,87 @@
+#pragma once
+
+#ifndef __VITIS_HLS__
+#include "../builder/builder.hh"
+#include <sstream>
+
+namespace vhn {
+
+// hparams are those of Embedding plus "mode" ("sum", "mean" or "max",
+// default "sum") and "per_sample_weights" (default false, sum only).
+class EmbeddingBagBuilder : public BaseBuilder {
+public:
+  std::string generate_hparams(const std::string &name,
+                               const std::string &dtype,
+                               const json &hparams) const override {
+    std::ostringstream oss;
+    NECESSARY_HPARAMS("EmbeddingBag", name, "vocab_size")
+    NECESSARY_HPARAMS("EmbeddingBag", name, "embed_size")
+
+    auto vocab_size = hparams["vocab_size"];
+    auto embed_size = hparams["embed_size"];
+    auto mode = hparams.value("mode", std::string("sum"));
+    auto per_sample_weights = hparams.value("per_sample_weights", false);
+
+    std::string mode_enum;
+    if (mode == "sum") {
+      mode_enum = "vhn::BAG_SUM";
+    } else if (mode == "mean") {
+      mode_enum = "vhn::BAG_MEAN";
+    } else if (mode == "max") {
+      mode_enum = "vhn::BAG_MAX";
+    } else {
+      throw std::runtime_error("Unsupported EmbeddingBag mode: " + mode);
+    }
+    if (per_sample_weights && mode != "sum") {
+      throw std::runtime_error("EmbeddingBag module '" + name +
+                               "' per_sample_weights requires mode sum");
+    }
+
+    oss << "using " << name << "_hparams = vhn::EmbeddingBagHParams<";
+    oss << vocab_size << ", " << embed_size << ", " << mode_enum << ", "
+        << (per_sample_weights ? "true" : "false");
+    oss << ">;\n\n";
+
+    return oss.str();
+  }
+
+  std::string generate_config(const std::string &name,
+                              const json &hls_cfg) const override {
+    if (hls_cfg.empty() || hls_cfg.is_null()) {
+      return "";
+    }
+
+    std::ostringstream oss;
+
+    auto pipeline_ii = hls_cfg.value("pipeline_ii", 1);
+    auto unroll_factor = hls_cfg.value("unroll_factor", 4);
+    auto partition_factor = hls_cfg.value("partition_factor", 4);
+
+    oss << "using " << name << "_cfg = vhn::EmbeddingBagConfig<";
+    oss << pipeline_ii << ", " << unroll_factor << ", " << partition_factor;
+    oss << ">;\n\n";
+
+    return oss.str();
+  }
+
+  std::string generate_type_alias(const std::string &name,
+                                  const std::string &dtype,
+                                  const json &hls_cfg) const override {
+    std::ostringstream oss;
+
+    std::string opt_level = "OPT_NONE";
+
+    if (!hls_cfg.empty() && !hls_cfg.is_null()) {
+      opt_level = "OPT_ENABLED";
+    }
+
+    std::string config_type =
+        (opt_level == "OPT_NONE") ? "void" : (name + "_cfg");
+
+    GENERATE_TYPE_ALIAS(oss, "EmbeddingBag", name, dtype, opt_level)
+    return oss.str();
+  }
+};
+
+} // namespace vhn
+#endif
@@ -36,9 +36,18 @@ public:
     auto pipeline_ii = hls_cfg.value("pipeline_ii", 1);
     auto unroll_factor = hls_cfg.value("unroll_factor", 4);
     auto partition_factor = hls_cfg.value("partition_factor", 4);
+    auto prefetch_distance = hls_cfg.value("prefetch_distance", 0);
+    auto dedup_slots = hls_cfg.value("dedup_slots", 0);
+    if (dedup_slots < 0 || (dedup_slots & (dedup_slots - 1)) != 0) {
+      throw std::runtime_error("Embedding module '" + name +
+                               "' dedup_slots must be a power of two");
+    }
 
     oss << "using " << name << "_cfg = vhn::EmbeddingConfig<";
     oss << pipeline_ii << ", " << unroll_factor << ", " << partition_factor;
+    if (prefetch_distance != 0 || dedup_slots != 0) {
+      oss << ", " << prefetch_distance << ", " << dedup_slots;
+    }
     oss << ">;\n\n";
 
     return oss.str();
@@ -0,0 +1,134 @@
+#pragma once
+
+#include <cmath>
+
+namespace vhn {
+
+// ============================================================================
+// In-place radix-2 complex FFT
+// ============================================================================
+// Decimation-in-time: bit-reversal permutation followed by log2(N) butterfly
+// stages. Real and imaginary parts live in separate arrays. The twiddle table
+// is computed once on first use; inverse() applies the 1/N scale.
+constexpr int fft_next_pow2(const int x) {
+  int p = 1;
+  while (p < x) {
+    p <<= 1;
+  }
+  return p;
+}
+
+constexpr int fft_log2(const int x) {
+  int l = 0;
+  while ((1 << l) < x) {
+    l++;
+  }
+  return l;
+}
+
+template <typename DType, int N> struct FFT {
+  using dtype = DType;
+  static constexpr int n = N;
+  static constexpr int log_n = fft_log2(N);
+
+  static_assert(N >= 2 && (N & (N - 1)) == 0, "FFT size must be a power of 2");
+
+  static void forward(dtype re[N], dtype im[N]) { transform(re, im, false); }
+
+  static void inverse(dtype re[N], dtype im[N]) {
+    transform(re, im, true);
+    const dtype scale = dtype(1.0 / N);
+  SCALE_LOOP:
+    for (int i = 0; i < N; i++) {
+#ifdef __VITIS_HLS__
+#pragma HLS PIPELINE II = 1
+#endif
+      re[i] *= scale;
+      im[i] *= scale;
+    }
+  }
+
+private:
+  struct Twiddles {
+    dtype cos_table[N / 2];
+    dtype sin_table[N / 2];
+
+    Twiddles() {
+      const double pi = 3.14159265358979323846;
+      for (int k = 0; k < N / 2; k++) {
+        cos_table[k] = dtype(std::cos(2.0 * pi * k / N));
+        sin_table[k] = dtype(std::sin(2.0 * pi * k / N));
+      }
+    }
+  };
+
+  static const Twiddles &twiddles() {
+    static const Twiddles table;
+    return table;
+  }
+
+  static int bit_reverse(int x) {
+    int r = 0;
+  BIT_REVERSE_LOOP:
+    for (int b = 0; b < log_n; b++) {
+#ifdef __VITIS_HLS__
+#pragma HLS UNROLL
+#endif
+      r = (r << 1) | (x & 1);
+      x >>= 1;
+    }
+    return r;
+  }
+
+  static void transform(dtype re[N], dtype im[N], const bool inverse) {
+    const Twiddles &tw = twiddles();
+
+  PERMUTE_LOOP:
+    for (int i = 0; i < N; i++) {
+#ifdef __VITIS_HLS__
+#pragma HLS PIPELINE II = 1
+#endif
+      const int j = bit_reverse(i);
+      if (i < j) {
+        dtype tr = re[i];
+        dtype ti = im[i];
+        re[i] = re[j];
+        im[i] = im[j];
+        re[j] = tr;
+        im[j] = ti;
+      }
+    }
+
+  STAGE_LOOP:
+    for (int half = 1; half < N; half <<= 1) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 16
+#endif
+      const int step = N / (2 * half);
+    BUTTERFLY_LOOP:
+      for (int i = 0; i < N / 2; i++) {
+#ifdef __VITIS_HLS__
+#pragma HLS PIPELINE II = 1
+#endif
+        const int group = i / half;
+        const int k = i % half;
+        const int top = group * 2 * half + k;
+        const int bottom = top + half;
+
+        // W = exp(-+2 pi i k / (2 half)), sign flipped for the inverse.
+        const dtype wr = tw.cos_table[k * step];
+        const dtype wi = inverse ? tw.sin_table[k * step]
+                                 : dtype(-tw.sin_table[k * step]);
+
+        const dtype br = re[bottom] * wr - im[bottom] * wi;
+        const dtype bi = re[bottom] * wi + im[bottom] * wr;
+        re[bottom] = re[top] - br;
+        im[bottom] = im[top] - bi;
+        re[top] = re[top] + br;
+        im[top] = im[top] + bi;
+      }
+    }
+  }
+};
+
+} // namespace vhn
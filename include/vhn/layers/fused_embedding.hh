@@ -0,0 +1,282 @@
+#pragma once
+
+#include "../opt_level.hh"
+#include <cmath>
+
+#ifdef __VITIS_HLS__
+#include <hls_math.h>
+#endif
+
+namespace vhn {
+
+enum PositionEncoding { POSITION_LEARNED, POSITION_SINUSOIDAL };
+
+template <typename DType, typename HParams, typename Config = void,
+          OptLevel OPT_LEVEL = OPT_NONE>
+class FusedEmbedding;
+
+// Transformer front end: output[t] = token[tokens[t]] + position[start + t]
+// (+ segment[segments[t]] when NUM_SEGMENTS > 0), in a single pass.
+// POSITION_SINUSOIDAL generates the fixed encoding
+//   pe[p][2i] = sin(p * w_i), pe[p][2i + 1] = cos(p * w_i),
+//   w_i = 10000^(-2i / EMBED_SIZE)
+// on the fly, so no position table is stored or passed (use nullptr).
+template <int VOCAB_SIZE, int EMBED_SIZE, int MAX_SEQ_LEN,
+          PositionEncoding POSITION = POSITION_LEARNED, int NUM_SEGMENTS = 0>
+struct FusedEmbeddingHParams {
+  static constexpr int vocab_size = VOCAB_SIZE;
+  static constexpr int embed_size = EMBED_SIZE;
+  static constexpr int max_seq_len = MAX_SEQ_LEN;
+  static constexpr PositionEncoding position = POSITION;
+  static constexpr int num_segments = NUM_SEGMENTS;
+
+  static_assert(POSITION != POSITION_SINUSOIDAL || EMBED_SIZE % 2 == 0,
+                "Sinusoidal positions need an even embed_size");
+};
+
+template <int EMBED_SIZE> struct SinusoidalPosition {
+  static float frequency(const int pair) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE
+#endif
+    return std::pow(10000.0f, -2.0f * pair / EMBED_SIZE);
+  }
+
+  static float value(const int pos, const int j) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE
+#endif
+    const float angle = pos * frequency(j / 2);
+    return (j % 2 == 0) ? std::sin(angle) : std::cos(angle);
+  }
+};
+
+// ============================================================================
+// Non-optimized version (OPT_NONE)
+// ============================================================================
+template <typename DType, typename HParams>
+class FusedEmbedding<DType, HParams, void, OPT_NONE> {
+public:
+  using dtype = DType;
+  static constexpr int vocab_size = HParams::vocab_size;
+  static constexpr int embed_size = HParams::embed_size;
+  static constexpr int max_seq_len = HParams::max_seq_len;
+  static constexpr PositionEncoding position = HParams::position;
+  static constexpr int num_segments = HParams::num_segments;
+  static constexpr OptLevel opt_level = OPT_NONE;
+
+  using Weight_t = dtype[vocab_size][embed_size];
+  using PositionWeight_t = dtype[max_seq_len][embed_size];
+  using SegmentWeight_t =
+      dtype[num_segments > 0 ? num_segments : 1][embed_size];
+
+  FusedEmbedding() = default;
+  ~FusedEmbedding() = default;
+
+  static void emb(dtype output[][embed_size], const int tokens[],
+                  const int seq_len, const Weight_t weight,
+                  const PositionWeight_t position_weight,
+                  const int segments[] = nullptr,
+                  const SegmentWeight_t segment_weight = nullptr,
+                  const int start_pos = 0) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+  SEQ_LOOP:
+    for (int t = 0; t < seq_len; t++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 512
+#endif
+      const int pos = start_pos + t;
+    EMBED_LOOP:
+      for (int j = 0; j < embed_size; j++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 1024
+#endif
+        dtype value = weight[tokens[t]][j];
+        if constexpr (position == POSITION_SINUSOIDAL) {
+          value += dtype(SinusoidalPosition<embed_size>::value(pos, j));
+        } else {
+          value += position_weight[pos][j];
+        }
+        if constexpr (num_segments > 0) {
+          value += segment_weight[segments[t]][j];
+        }
+        output[t][j] = value;
+      }
+    }
+  }
+};
+
+template <int PIPELINE_II, int UNROLL_FACTOR, int PARTITION_FACTOR>
+struct FusedEmbeddingConfig {
+  static constexpr int pipeline_ii = PIPELINE_II;
+  static constexpr int unroll_factor = UNROLL_FACTOR;
+  static constexpr int partition_factor = PARTITION_FACTOR;
+};
+
+// ============================================================================
+// Optimized version (OPT_ENABLED)
+// ============================================================================
+// Sinusoidal positions are advanced by rotation instead of evaluating
+// sin / cos per element: with (s, c) = (sin(p w), cos(p w)),
+//   s' = s cos(w) + c sin(w),  c' = c cos(w) - s sin(w)
+// gives position p + 1 in four multiplies. The phase is re-anchored with an
+// exact sin / cos every sinusoid_anchor positions to bound rounding drift.
+template <typename DType, typename HParams, typename Config>
+class FusedEmbedding<DType, HParams, Config, OPT_ENABLED> {
+public:
+  using dtype = DType;
+  static constexpr int vocab_size = HParams::vocab_size;
+  static constexpr int embed_size = HParams::embed_size;
+  static constexpr int max_seq_len = HParams::max_seq_len;
+  static constexpr PositionEncoding position = HParams::position;
+  static constexpr int num_segments = HParams::num_segments;
+  static constexpr OptLevel opt_level = OPT_ENABLED;
+
+  static constexpr int pipeline_ii = Config::pipeline_ii;
+  static constexpr int unroll_factor = Config::unroll_factor;
+  static constexpr int partition_factor = Config::partition_factor;
+
+  static constexpr int sinusoid_anchor = 32;
+  static constexpr int num_pairs = embed_size / 2;
+
+  using Weight_t = dtype[vocab_size][embed_size];
+  using PositionWeight_t = dtype[max_seq_len][embed_size];
+  using SegmentWeight_t =
+      dtype[num_segments > 0 ? num_segments : 1][embed_size];
+
+  FusedEmbedding() = default;
+  ~FusedEmbedding() = default;
+
+  static void emb(dtype output[][embed_size], const int tokens[],
+                  const int seq_len, const Weight_t weight,
+                  const PositionWeight_t position_weight,
+                  const int segments[] = nullptr,
+                  const SegmentWeight_t segment_weight = nullptr,
+                  const int start_pos = 0) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+    if constexpr (position == POSITION_SINUSOIDAL) {
+      sinusoidal_impl(output, tokens, seq_len, weight, segments,
+                      segment_weight, start_pos);
+    } else {
+      learned_impl(output, tokens, seq_len, weight, position_weight, segments,
+                   segment_weight, start_pos);
+    }
+  }
+
+private:
+  static void learned_impl(dtype output[][embed_size], const int tokens[],
+                           const int seq_len, const Weight_t weight,
+                           const PositionWeight_t position_weight,
+                           const int segments[],
+                           const SegmentWeight_t segment_weight,
+                           const int start_pos) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+    if constexpr (partition_factor > 1 && embed_size <= 2048) {
+#pragma HLS ARRAY_PARTITION variable = weight type = cyclic factor =           \
+    partition_factor dim = 2
+#pragma HLS ARRAY_PARTITION variable = position_weight type = cyclic factor =  \
+    partition_factor dim = 2
+    }
+#endif
+  SEQ_LOOP:
+    for (int t = 0; t < seq_len; t++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 512
+#endif
+      const dtype *token_row = weight[tokens[t]];
+      const dtype *position_row = position_weight[start_pos + t];
+      const dtype *segment_row =
+          num_segments > 0 ? segment_weight[segments[t]] : nullptr;
+    EMBED_LOOP:
+      for (int j = 0; j < embed_size; j++) {
+#ifdef __VITIS_HLS__
+#pragma HLS PIPELINE II = pipeline_ii
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 2048
+        if constexpr (unroll_factor > 1) {
+#pragma HLS UNROLL factor = unroll_factor
+        }
+#endif
+        dtype value = token_row[j] + position_row[j];
+        if constexpr (num_segments > 0) {
+          value += segment_row[j];
+        }
+        output[t][j] = value;
+      }
+    }
+  }
+
+  static void sinusoidal_impl(dtype output[][embed_size], const int tokens[],
+                              const int seq_len, const Weight_t weight,
+                              const int segments[],
+                              const SegmentWeight_t segment_weight,
+                              const int start_pos) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+    float freq[num_pairs], step_sin[num_pairs], step_cos[num_pairs];
+    float phase_sin[num_pairs], phase_cos[num_pairs];
+#ifdef __VITIS_HLS__
+    if constexpr (unroll_factor > 1) {
+#pragma HLS ARRAY_PARTITION variable = phase_sin type = cyclic factor =        \
+    unroll_factor
+#pragma HLS ARRAY_PARTITION variable = phase_cos type = cyclic factor =        \
+    unroll_factor
+    }
+#endif
+
+  FREQ_LOOP:
+    for (int i = 0; i < num_pairs; i++) {
+      freq[i] = SinusoidalPosition<embed_size>::frequency(i);
+      step_sin[i] = std::sin(freq[i]);
+      step_cos[i] = std::cos(freq[i]);
+    }
+
+  SEQ_LOOP:
+    for (int t = 0; t < seq_len; t++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 512
+#endif
+      const int pos = start_pos + t;
+      if (t % sinusoid_anchor == 0) {
+      ANCHOR_LOOP:
+        for (int i = 0; i < num_pairs; i++) {
+          phase_sin[i] = std::sin(pos * freq[i]);
+          phase_cos[i] = std::cos(pos * freq[i]);
+        }
+      }
+
+      const dtype *token_row = weight[tokens[t]];
+      const dtype *segment_row =
+          num_segments > 0 ? segment_weight[segments[t]] : nullptr;
+    PAIR_LOOP:
+      for (int i = 0; i < num_pairs; i++) {
+#ifdef __VITIS_HLS__
+#pragma HLS PIPELINE II = pipeline_ii
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 1024
+        if constexpr (unroll_factor > 1) {
+#pragma HLS UNROLL factor = unroll_factor
+        }
+#endif
+        const float s = phase_sin[i];
+        const float c = phase_cos[i];
+        dtype even = token_row[2 * i] + dtype(s);
+        dtype odd = token_row[2 * i + 1] + dtype(c);
+        if constexpr (num_segments > 0) {
+          even += segment_row[2 * i];
+          odd += segment_row[2 * i + 1];
+        }
+        output[t][2 * i] = even;
+        output[t][2 * i + 1] = odd;
+        phase_sin[i] = s * step_cos[i] + c * step_sin[i];
+        phase_cos[i] = c * step_cos[i] - s * step_sin[i];
+      }
+    }
+  }
+};
+
+} // namespace vhn
@@ -0,0 +1,85 @@
+#pragma once
+
+#ifndef __VITIS_HLS__
+#include "../builder/builder.hh"
+#include <sstream>
+
+namespace vhn {
+
+// hparams: "vocab_size", "embed_size", "max_seq_len", "position"
+// ("learned" or "sinusoidal", default "learned") and "num_segments"
+// (default 0, no segment table).
+class FusedEmbeddingBuilder : public BaseBuilder {
+public:
+  std::string generate_hparams(const std::string &name,
+                               const std::string &dtype,
+                               const json &hparams) const override {
+    std::ostringstream oss;
+    NECESSARY_HPARAMS("FusedEmbedding", name, "vocab_size")
+    NECESSARY_HPARAMS("FusedEmbedding", name, "embed_size")
+    NECESSARY_HPARAMS("FusedEmbedding", name, "max_seq_len")
+
+    auto vocab_size = hparams["vocab_size"];
+    auto embed_size = hparams["embed_size"];
+    auto max_seq_len = hparams["max_seq_len"];
+    auto position = hparams.value("position", std::string("learned"));
+    auto num_segments = hparams.value("num_segments", 0);
+
+    std::string position_enum;
+    if (position == "learned") {
+      position_enum = "vhn::POSITION_LEARNED";
+    } else if (position == "sinusoidal") {
+      position_enum = "vhn::POSITION_SINUSOIDAL";
+    } else {
+      throw std::runtime_error("Unsupported FusedEmbedding position: " +
+                               position);
+    }
+
+    oss << "using " << name << "_hparams = vhn::FusedEmbeddingHParams<";
+    oss << vocab_size << ", " << embed_size << ", " << max_seq_len << ", "
+        << position_enum << ", " << num_segments;
+    oss << ">;\n\n";
+
+    return oss.str();
+  }
+
+  std::string generate_config(const std::string &name,
+                              const json &hls_cfg) const override {
+    if (hls_cfg.empty() || hls_cfg.is_null()) {
+      return "";
+    }
+
+    std::ostringstream oss;
+
+    auto pipeline_ii = hls_cfg.value("pipeline_ii", 1);
+    auto unroll_factor = hls_cfg.value("unroll_factor", 4);
+    auto partition_factor = hls_cfg.value("partition_factor", 4);
+
+    oss << "using " << name << "_cfg = vhn::FusedEmbeddingConfig<";
+    oss << pipeline_ii << ", " << unroll_factor << ", " << partition_factor;
+    oss << ">;\n\n";
+
+    return oss.str();
+  }
+
+  std::string generate_type_alias(const std::string &name,
+                                  const std::string &dtype,
+                                  const json &hls_cfg) const override {
+    std::ostringstream oss;
+
+    std::string opt_level = "OPT_NONE";
+
+    if (!hls_cfg.empty() && !hls_cfg.is_null()) {
+      opt_level = "OPT_ENABLED";
+    }
+
+    std::string config_type =
+        (opt_level == "OPT_NONE") ? "void" : (name + "_cfg");
+
+    GENERATE_TYPE_ALIAS(oss, "FusedEmbedding", name, dtype, opt_level)
+    return oss.str();
+  }
+};
+
+} // namespace vhn
+#endif
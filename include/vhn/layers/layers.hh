@@ -1,23 +1,69 @@
 #pragma once
 
 // Layers
+#include "./causal_conv1d.hh"
 #include "./conv1d.hh"
 #include "./conv2d.hh"
+#include "./conv2d_fused.hh"
+#include "./conv2d_pool2d.hh"
+#include "./conv_transpose1d.hh"
+#include "./conv_transpose2d.hh"
 #include "./embedding.hh"
+#include "./embedding_bag.hh"
+#include "./fused_embedding.hh"
 #include "./linear.hh"
+#include "./pool1d.hh"
+#include "./pool2d.hh"
+#include "./qconv1d.hh"
+#include "./qconv2d.hh"
+#include "./qembedding.hh"
+#include "./separable_conv2d.hh"
 #include "./softmax.hh"
+#include "./upsample_conv2d.hh"
 
 // Builders
 #ifndef __VITIS_HLS__
+#include "./causal_conv1d_builder.hh"
 #include "./conv1d_builder.hh"
 #include "./conv2d_builder.hh"
+#include "./conv2d_fused_builder.hh"
+#include "./conv2d_pool2d_builder.hh"
+#include "./conv_transpose_builder.hh"
+#include "./embedding_bag_builder.hh"
 #include "./embedding_builder.hh"
+#include "./fused_embedding_builder.hh"
 #include "./linear_builder.hh"
+#include "./pool1d_builder.hh"
+#include "./pool2d_builder.hh"
+#include "./qconv_builder.hh"
+#include "./qembedding_builder.hh"
+#include "./separable_conv2d_builder.hh"
 #include "./softmax_builder.hh"
+#include "./upsample_conv2d_builder.hh"
 
 REGISTER_LAYER_BUILDER("linear", LinearBuilder)
 REGISTER_LAYER_BUILDER("conv1d", Conv1dBuilder)
+REGISTER_LAYER_BUILDER("causal_conv1d", CausalConv1dBuilder)
 REGISTER_LAYER_BUILDER("conv2d", Conv2dBuilder)
+REGISTER_LAYER_BUILDER("conv2d_fused", Conv2dFusedBuilder)
+REGISTER_LAYER_BUILDER("qconv1d", QConv1dBuilder)
+REGISTER_LAYER_BUILDER("qconv2d", QConv2dBuilder)
+REGISTER_LAYER_BUILDER("separable_conv2d", SeparableConv2dBuilder)
+REGISTER_LAYER_BUILDER("conv2d_pool2d", Conv2dPool2dBuilder)
+REGISTER_LAYER_BUILDER("conv_transpose1d", ConvTranspose1dBuilder)
+REGISTER_LAYER_BUILDER("conv_transpose2d", ConvTranspose2dBuilder)
+REGISTER_LAYER_BUILDER("upsample_conv2d", UpsampleConv2dBuilder)
+REGISTER_LAYER_BUILDER("maxpool1d", MaxPool1dBuilder)
+REGISTER_LAYER_BUILDER("avgpool1d", AvgPool1dBuilder)
+REGISTER_LAYER_BUILDER("global_avgpool1d", GlobalAvgPool1dBuilder)
+REGISTER_LAYER_BUILDER("global_maxpool1d", GlobalMaxPool1dBuilder)
+REGISTER_LAYER_BUILDER("maxpool2d", MaxPool2dBuilder)
+REGISTER_LAYER_BUILDER("avgpool2d", AvgPool2dBuilder)
+REGISTER_LAYER_BUILDER("global_avgpool2d", GlobalAvgPool2dBuilder)
+REGISTER_LAYER_BUILDER("global_maxpool2d", GlobalMaxPool2dBuilder)
 REGISTER_LAYER_BUILDER("embedding", EmbeddingBuilder)
+REGISTER_LAYER_BUILDER("embedding_bag", EmbeddingBagBuilder)
+REGISTER_LAYER_BUILDER("fused_embedding", FusedEmbeddingBuilder)
+REGISTER_LAYER_BUILDER("qembedding", QEmbeddingBuilder)
 REGISTER_LAYER_BUILDER("softmax", SoftmaxBuilder)
 #endif
@@ -0,0 +1,17 @@
+#pragma once
+
+#include "../operators/operator_impl.hh"
+#include <type_traits>
+
+namespace vhn {
+
+// Reduction applied over each pooling window. POOL_AVG divides by the full
+// window size, i.e. zero padding counts towards the mean
+// (count_include_pad); POOL_MAX ignores padded positions.
+enum PoolType { POOL_MAX, POOL_AVG };
+
+template <typename DType, PoolType POOL_TYPE, int N>
+using PoolImpl = std::conditional_t<POOL_TYPE == POOL_MAX, MaxImpl<DType, N>,
+                                    MeanImpl<DType, N>>;
+
+} // namespace vhn
@@ -0,0 +1,560 @@
+#pragma once
+
+#include "../opt_level.hh"
+#include "../stream.hh"
+#include "./pool.hh"
+
+namespace vhn {
+
+template <typename DType, typename HParams, typename Config = void,
+          OptLevel OPT_LEVEL = OPT_NONE, PoolType POOL_TYPE = POOL_MAX>
+class Pool1d;
+
+template <typename DType, typename HParams, typename Config = void,
+          OptLevel OPT_LEVEL = OPT_NONE>
+using MaxPool1d = Pool1d<DType, HParams, Config, OPT_LEVEL, POOL_MAX>;
+
+template <typename DType, typename HParams, typename Config = void,
+          OptLevel OPT_LEVEL = OPT_NONE>
+using AvgPool1d = Pool1d<DType, HParams, Config, OPT_LEVEL, POOL_AVG>;
+
+template <int CHANNELS, int KERNEL_SIZE, int STRIDE, int PADDING, int N>
+struct Pool1dHParams {
+  static constexpr int channels = CHANNELS;
+  static constexpr int kernel_size = KERNEL_SIZE;
+  static constexpr int stride = STRIDE;
+  static constexpr int padding = PADDING;
+  static constexpr int n = N;
+  static constexpr int out_length =
+      (N + 2 * PADDING - KERNEL_SIZE) / STRIDE + 1;
+
+  static_assert(2 * PADDING <= KERNEL_SIZE,
+                "Pool1d padding must be at most half the kernel size");
+};
+
+// ============================================================================
+// Non-optimized version (OPT_NONE)
+// ============================================================================
+template <typename DType, typename HParams, PoolType POOL_TYPE>
+class Pool1d<DType, HParams, void, OPT_NONE, POOL_TYPE> {
+public:
+  using dtype = DType;
+  static constexpr int channels = HParams::channels;
+  static constexpr int kernel_size = HParams::kernel_size;
+  static constexpr int stride = HParams::stride;
+  static constexpr int padding = HParams::padding;
+  static constexpr int n = HParams::n;
+  static constexpr int out_length = HParams::out_length;
+  static constexpr PoolType pool_type = POOL_TYPE;
+  static constexpr OptLevel opt_level = OPT_NONE;
+
+  using impl = PoolImpl<dtype, POOL_TYPE, kernel_size>;
+
+  using Input_t = dtype[channels][n];
+  using Output_t = dtype[channels][out_length];
+
+  Pool1d() = default;
+  ~Pool1d() = default;
+
+  static void pool1d(Output_t output, const Input_t input) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+    pool1d_2d_impl(output, input);
+  }
+
+  static void pool1d(dtype output[][channels][out_length],
+                     const dtype input[][channels][n], const int batch_size) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 32
+#endif
+  BATCH_LOOP:
+    for (int b = 0; b < batch_size; b++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_FLATTEN off
+#endif
+      pool1d_2d_impl(output[b], input[b]);
+    }
+  }
+
+  // Samples arrive in order with channels innermost; outputs leave in the
+  // same order as soon as their window is complete.
+  static void pool1d(stream<dtype> &output_stream, stream<dtype> &input_stream,
+                     const int batch_size = 1) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+  BATCH_LOOP:
+    for (int b = 0; b < batch_size; b++) {
+      pool1d_stream_impl(output_stream, input_stream);
+    }
+  }
+
+private:
+  static void pool1d_2d_impl(dtype output[channels][out_length],
+                             const dtype input[channels][n]) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+  CHANNEL_LOOP:
+    for (int c = 0; c < channels; c++) {
+    OUT_POS_LOOP:
+      for (int pos = 0; pos < out_length; pos++) {
+        dtype acc = dtype(0.0f);
+        bool started = false;
+      KERNEL_LOOP:
+        for (int k = 0; k < kernel_size; k++) {
+          int in_pos = pos * stride + k - padding;
+          if (in_pos >= 0 && in_pos < n) {
+            acc = started ? impl::kernel(acc, input[c][in_pos])
+                          : input[c][in_pos];
+            started = true;
+          }
+        }
+        output[c][pos] = impl::finalize(acc);
+      }
+    }
+  }
+
+  static void pool1d_stream_impl(stream<dtype> &output_stream,
+                                 stream<dtype> &input_stream) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+    constexpr int padded_n = n + 2 * padding;
+    dtype window[kernel_size][channels];
+
+  POS_LOOP:
+    for (int p = 0; p < padded_n; p++) {
+      const bool inside = p >= padding && p < padding + n;
+      const int left = p - (kernel_size - 1);
+      const bool emit = left >= 0 && left % stride == 0;
+
+    CHANNEL_LOOP:
+      for (int c = 0; c < channels; c++) {
+        dtype sample = inside ? input_stream.read() : dtype(0.0f);
+        for (int k = 0; k < kernel_size - 1; k++) {
+          window[k][c] = window[k + 1][c];
+        }
+        window[kernel_size - 1][c] = sample;
+
+        if (emit) {
+          dtype acc = dtype(0.0f);
+          bool started = false;
+          for (int k = 0; k < kernel_size; k++) {
+            const int x = left + k;
+            if (x >= padding && x < padding + n) {
+              acc = started ? impl::kernel(acc, window[k][c]) : window[k][c];
+              started = true;
+            }
+          }
+          output_stream.write(impl::finalize(acc));
+        }
+      }
+    }
+  }
+};
+
+template <int PIPELINE_II, int UNROLL_FACTOR, int PARTITION_FACTOR>
+struct Pool1dConfig {
+  static constexpr int pipeline_ii = PIPELINE_II;
+  static constexpr int unroll_factor = UNROLL_FACTOR;
+  static constexpr int partition_factor = PARTITION_FACTOR;
+};
+
+// ============================================================================
+// Optimized version (OPT_ENABLED)
+// ============================================================================
+template <typename DType, typename HParams, typename Config,
+          PoolType POOL_TYPE>
+class Pool1d<DType, HParams, Config, OPT_ENABLED, POOL_TYPE> {
+public:
+  using dtype = DType;
+  static constexpr int channels = HParams::channels;
+  static constexpr int kernel_size = HParams::kernel_size;
+  static constexpr int stride = HParams::stride;
+  static constexpr int padding = HParams::padding;
+  static constexpr int n = HParams::n;
+  static constexpr int out_length = HParams::out_length;
+  static constexpr PoolType pool_type = POOL_TYPE;
+  static constexpr OptLevel opt_level = OPT_ENABLED;
+
+  static constexpr int pipeline_ii = Config::pipeline_ii;
+  static constexpr int unroll_factor = Config::unroll_factor;
+  static constexpr int partition_factor = Config::partition_factor;
+
+  using impl = PoolImpl<dtype, POOL_TYPE, kernel_size>;
+
+  using Input_t = dtype[channels][n];
+  using Output_t = dtype[channels][out_length];
+
+  Pool1d() = default;
+  ~Pool1d() = default;
+
+  static void pool1d(Output_t output, const Input_t input) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+    pool1d_2d_impl(output, input);
+  }
+
+  static void pool1d(dtype output[][channels][out_length],
+                     const dtype input[][channels][n], const int batch_size) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 32
+#endif
+  BATCH_LOOP:
+    for (int b = 0; b < batch_size; b++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_FLATTEN off
+#endif
+      pool1d_2d_impl(output[b], input[b]);
+    }
+  }
+
+  static void pool1d(stream<dtype> &output_stream, stream<dtype> &input_stream,
+                     const int batch_size = 1) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+  BATCH_LOOP:
+    for (int b = 0; b < batch_size; b++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 32
+#endif
+      pool1d_stream_impl(output_stream, input_stream);
+    }
+  }
+
+private:
+  static void pool1d_2d_impl(dtype output[channels][out_length],
+                             const dtype input[channels][n]) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+    if constexpr (partition_factor > 1 && channels <= 512) {
+#pragma HLS ARRAY_PARTITION variable = input type = cyclic factor =            \
+    partition_factor dim = 1
+#pragma HLS ARRAY_PARTITION variable = output type = cyclic factor =           \
+    partition_factor dim = 1
+    }
+#endif
+
+  OUT_POS_LOOP:
+    for (int pos = 0; pos < out_length; pos++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 4096
+#endif
+    CHANNEL_LOOP:
+      for (int c = 0; c < channels; c++) {
+#ifdef __VITIS_HLS__
+#pragma HLS PIPELINE II = pipeline_ii
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 1024
+        if constexpr (unroll_factor > 1) {
+#pragma HLS UNROLL factor = unroll_factor
+        }
+#endif
+        dtype acc = dtype(0.0f);
+        bool started = false;
+      KERNEL_LOOP:
+        for (int k = 0; k < kernel_size; k++) {
+#ifdef __VITIS_HLS__
+#pragma HLS UNROLL
+#endif
+          int in_pos = pos * stride + k - padding;
+          if (in_pos >= 0 && in_pos < n) {
+            acc = started ? impl::kernel(acc, input[c][in_pos])
+                          : input[c][in_pos];
+            started = true;
+          }
+        }
+        output[c][pos] = impl::finalize(acc);
+      }
+    }
+  }
+
+  static void pool1d_stream_impl(stream<dtype> &output_stream,
+                                 stream<dtype> &input_stream) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+    constexpr int padded_n = n + 2 * padding;
+    dtype window[kernel_size][channels];
+#ifdef __VITIS_HLS__
+#pragma HLS ARRAY_PARTITION variable = window type = complete dim = 1
+#endif
+
+  POS_LOOP:
+    for (int p = 0; p < padded_n; p++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 4096
+#endif
+      const bool inside = p >= padding && p < padding + n;
+      const int left = p - (kernel_size - 1);
+      const bool emit = left >= 0 && left % stride == 0;
+
+    CHANNEL_LOOP:
+      for (int c = 0; c < channels; c++) {
+#ifdef __VITIS_HLS__
+#pragma HLS PIPELINE II = pipeline_ii
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 1024
+#endif
+        dtype sample = inside ? input_stream.read() : dtype(0.0f);
+        for (int k = 0; k < kernel_size - 1; k++) {
+          window[k][c] = window[k + 1][c];
+        }
+        window[kernel_size - 1][c] = sample;
+
+        if (emit) {
+          dtype acc = dtype(0.0f);
+          bool started = false;
+          for (int k = 0; k < kernel_size; k++) {
+            const int x = left + k;
+            if (x >= padding && x < padding + n) {
+              acc = started ? impl::kernel(acc, window[k][c]) : window[k][c];
+              started = true;
+            }
+          }
+          output_stream.write(impl::finalize(acc));
+        }
+      }
+    }
+  }
+};
+
+// ============================================================================
+// Global pooling: one value per channel
+// ============================================================================
+template <typename DType, typename HParams, typename Config = void,
+          OptLevel OPT_LEVEL = OPT_NONE, PoolType POOL_TYPE = POOL_AVG>
+class GlobalPool1d;
+
+template <typename DType, typename HParams, typename Config = void,
+          OptLevel OPT_LEVEL = OPT_NONE>
+using GlobalAvgPool1d =
+    GlobalPool1d<DType, HParams, Config, OPT_LEVEL, POOL_AVG>;
+
+template <typename DType, typename HParams, typename Config = void,
+          OptLevel OPT_LEVEL = OPT_NONE>
+using GlobalMaxPool1d =
+    GlobalPool1d<DType, HParams, Config, OPT_LEVEL, POOL_MAX>;
+
+template <int CHANNELS, int N> struct GlobalPool1dHParams {
+  static constexpr int channels = CHANNELS;
+  static constexpr int n = N;
+};
+
+template <typename DType, typename HParams, PoolType POOL_TYPE>
+class GlobalPool1d<DType, HParams, void, OPT_NONE, POOL_TYPE> {
+public:
+  using dtype = DType;
+  static constexpr int channels = HParams::channels;
+  static constexpr int n = HParams::n;
+  static constexpr PoolType pool_type = POOL_TYPE;
+  static constexpr OptLevel opt_level = OPT_NONE;
+
+  using impl = PoolImpl<dtype, POOL_TYPE, n>;
+
+  using Input_t = dtype[channels][n];
+  using Output_t = dtype[channels];
+
+  GlobalPool1d() = default;
+  ~GlobalPool1d() = default;
+
+  static void pool1d(Output_t output, const Input_t input) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+    pool1d_impl(output, input);
+  }
+
+  static void pool1d(dtype output[][channels], const dtype input[][channels][n],
+                     const int batch_size) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+  BATCH_LOOP:
+    for (int b = 0; b < batch_size; b++) {
+      pool1d_impl(output[b], input[b]);
+    }
+  }
+
+  // Samples arrive with channels innermost; one value per channel is written
+  // after the last sample.
+  static void pool1d(stream<dtype> &output_stream, stream<dtype> &input_stream,
+                     const int batch_size = 1) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+  BATCH_LOOP:
+    for (int b = 0; b < batch_size; b++) {
+      dtype acc[channels];
+    POS_LOOP:
+      for (int p = 0; p < n; p++) {
+      CHANNEL_LOOP:
+        for (int c = 0; c < channels; c++) {
+          dtype x = input_stream.read();
+          acc[c] = (p == 0) ? x : impl::kernel(acc[c], x);
+        }
+      }
+    WRITE_OUTPUT:
+      for (int c = 0; c < channels; c++) {
+        output_stream.write(impl::finalize(acc[c]));
+      }
+    }
+  }
+
+private:
+  static void pool1d_impl(dtype output[channels],
+                          const dtype input[channels][n]) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+  CHANNEL_LOOP:
+    for (int c = 0; c < channels; c++) {
+      dtype acc = input[c][0];
+    POS_LOOP:
+      for (int p = 1; p < n; p++) {
+        acc = impl::kernel(acc, input[c][p]);
+      }
+      output[c] = impl::finalize(acc);
+    }
+  }
+};
+
+template <typename DType, typename HParams, typename Config,
+          PoolType POOL_TYPE>
+class GlobalPool1d<DType, HParams, Config, OPT_ENABLED, POOL_TYPE> {
+public:
+  using dtype = DType;
+  static constexpr int channels = HParams::channels;
+  static constexpr int n = HParams::n;
+  static constexpr PoolType pool_type = POOL_TYPE;
+  static constexpr OptLevel opt_level = OPT_ENABLED;
+
+  static constexpr int pipeline_ii = Config::pipeline_ii;
+  static constexpr int unroll_factor = Config::unroll_factor;
+  static constexpr int partition_factor = Config::partition_factor;
+
+  using impl = PoolImpl<dtype, POOL_TYPE, n>;
+
+  using Input_t = dtype[channels][n];
+  using Output_t = dtype[channels];
+
+  GlobalPool1d() = default;
+  ~GlobalPool1d() = default;
+
+  static void pool1d(Output_t output, const Input_t input) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+    pool1d_impl(output, input);
+  }
+
+  static void pool1d(dtype output[][channels], const dtype input[][channels][n],
+                     const int batch_size) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 32
+#endif
+  BATCH_LOOP:
+    for (int b = 0; b < batch_size; b++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_FLATTEN off
+#endif
+      pool1d_impl(output[b], input[b]);
+    }
+  }
+
+  static void pool1d(stream<dtype> &output_stream, stream<dtype> &input_stream,
+                     const int batch_size = 1) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+  BATCH_LOOP:
+    for (int b = 0; b < batch_size; b++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 32
+#endif
+      dtype acc[channels];
+#ifdef __VITIS_HLS__
+      if constexpr (partition_factor > 1 && channels <= 1024) {
+#pragma HLS ARRAY_PARTITION variable = acc type = cyclic factor =              \
+    partition_factor
+      }
+#endif
+    POS_LOOP:
+      for (int p = 0; p < n; p++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 4096
+#endif
+      CHANNEL_LOOP:
+        for (int c = 0; c < channels; c++) {
+#ifdef __VITIS_HLS__
+#pragma HLS PIPELINE II = pipeline_ii
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 1024
+#endif
+          dtype x = input_stream.read();
+          acc[c] = (p == 0) ? x : impl::kernel(acc[c], x);
+        }
+      }
+    WRITE_OUTPUT:
+      for (int c = 0; c < channels; c++) {
+#ifdef __VITIS_HLS__
+#pragma HLS PIPELINE II = 1
+#endif
+        output_stream.write(impl::finalize(acc[c]));
+      }
+    }
+  }
+
+private:
+  static void pool1d_impl(dtype output[channels],
+                          const dtype input[channels][n]) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+    if constexpr (partition_factor > 1 && channels <= 512) {
+#pragma HLS ARRAY_PARTITION variable = input type = cyclic factor =            \
+    partition_factor dim = 1
+#pragma HLS ARRAY_PARTITION variable = output type = cyclic factor =           \
+    partition_factor
+    }
+#endif
+    dtype acc[channels];
+#ifdef __VITIS_HLS__
+    if constexpr (partition_factor > 1 && channels <= 1024) {
+#pragma HLS ARRAY_PARTITION variable = acc type = cyclic factor =              \
+    partition_factor
+    }
+#endif
+
+  POS_LOOP:
+    for (int p = 0; p < n; p++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 4096
+#endif
+    CHANNEL_LOOP:
+      for (int c = 0; c < channels; c++) {
+#ifdef __VITIS_HLS__
+#pragma HLS PIPELINE II = pipeline_ii
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 1024
+        if constexpr (unroll_factor > 1) {
+#pragma HLS UNROLL factor = unroll_factor
+        }
+#endif
+        acc[c] = (p == 0) ? input[c][p] : impl::kernel(acc[c], input[c][p]);
+      }
+    }
+
+  WRITE_OUTPUT:
+    for (int c = 0; c < channels; c++) {
+#ifdef __VITIS_HLS__
+#pragma HLS PIPELINE II = 1
+#endif
+      output[c] = impl::finalize(acc[c]);
+    }
+  }
+};
+
+} // namespace vhn
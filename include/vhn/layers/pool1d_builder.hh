@@ -0,0 +1,163 @@
+#pragma once
+
+#ifndef __VITIS_HLS__
+#include "../builder/builder.hh"
+#include <sstream>
+
+namespace vhn {
+
+// Shared by MaxPool1d / AvgPool1d; `type` is the emitted class name.
+class Pool1dBuilder : public BaseBuilder {
+public:
+  explicit Pool1dBuilder(const std::string &type) : _type(type) {}
+
+  std::string generate_hparams(const std::string &name,
+                               const std::string &dtype,
+                               const json &hparams) const override {
+    std::ostringstream oss;
+
+    NECESSARY_HPARAMS(_type, name, "channels")
+    NECESSARY_HPARAMS(_type, name, "kernel_size")
+    NECESSARY_HPARAMS(_type, name, "n")
+
+    auto channels = hparams["channels"].get<int>();
+    auto kernel_size = hparams["kernel_size"].get<int>();
+    auto stride = hparams.value("stride", kernel_size);
+    auto padding = hparams.value("padding", 0);
+    auto n = hparams["n"].get<int>();
+
+    oss << "using " << name << "_hparams = vhn::Pool1dHParams<";
+    oss << channels << ", " << kernel_size << ", " << stride << ", "
+        << padding << ", " << n;
+    oss << ">;\n\n";
+
+    return oss.str();
+  }
+
+  std::string generate_config(const std::string &name,
+                              const json &hls_cfg) const override {
+    if (hls_cfg.empty() || hls_cfg.is_null()) {
+      return "";
+    }
+
+    std::ostringstream oss;
+
+    auto pipeline_ii = hls_cfg.value("pipeline_ii", 1);
+    auto unroll_factor = hls_cfg.value("unroll_factor", 1);
+    auto partition_factor = hls_cfg.value("partition_factor", 4);
+
+    oss << "using " << name << "_cfg = vhn::Pool1dConfig<";
+    oss << pipeline_ii << ", " << unroll_factor << ", " << partition_factor;
+    oss << ">;\n\n";
+
+    return oss.str();
+  }
+
+  std::string generate_type_alias(const std::string &name,
+                                  const std::string &dtype,
+                                  const json &hls_cfg) const override {
+    std::ostringstream oss;
+
+    std::string opt_level = "OPT_NONE";
+
+    if (!hls_cfg.empty() && !hls_cfg.is_null()) {
+      opt_level = "OPT_ENABLED";
+    }
+
+    std::string config_type =
+        (opt_level == "OPT_NONE") ? "void" : (name + "_cfg");
+
+    GENERATE_TYPE_ALIAS(oss, _type, name, dtype, opt_level)
+    return oss.str();
+  }
+
+private:
+  std::string _type;
+};
+
+class MaxPool1dBuilder : public Pool1dBuilder {
+public:
+  MaxPool1dBuilder() : Pool1dBuilder("MaxPool1d") {}
+};
+
+class AvgPool1dBuilder : public Pool1dBuilder {
+public:
+  AvgPool1dBuilder() : Pool1dBuilder("AvgPool1d") {}
+};
+
+// Shared by GlobalAvgPool1d / GlobalMaxPool1d.
+class GlobalPool1dBuilder : public BaseBuilder {
+public:
+  explicit GlobalPool1dBuilder(const std::string &type) : _type(type) {}
+
+  std::string generate_hparams(const std::string &name,
+                               const std::string &dtype,
+                               const json &hparams) const override {
+    std::ostringstream oss;
+
+    NECESSARY_HPARAMS(_type, name, "channels")
+    NECESSARY_HPARAMS(_type, name, "n")
+
+    auto channels = hparams["channels"].get<int>();
+    auto n = hparams["n"].get<int>();
+
+    oss << "using " << name << "_hparams = vhn::GlobalPool1dHParams<";
+    oss << channels << ", " << n;
+    oss << ">;\n\n";
+
+    return oss.str();
+  }
+
+  std::string generate_config(const std::string &name,
+                              const json &hls_cfg) const override {
+    if (hls_cfg.empty() || hls_cfg.is_null()) {
+      return "";
+    }
+
+    std::ostringstream oss;
+
+    auto pipeline_ii = hls_cfg.value("pipeline_ii", 1);
+    auto unroll_factor = hls_cfg.value("unroll_factor", 1);
+    auto partition_factor = hls_cfg.value("partition_factor", 4);
+
+    oss << "using " << name << "_cfg = vhn::Pool1dConfig<";
+    oss << pipeline_ii << ", " << unroll_factor << ", " << partition_factor;
+    oss << ">;\n\n";
+
+    return oss.str();
+  }
+
+  std::string generate_type_alias(const std::string &name,
+                                  const std::string &dtype,
+                                  const json &hls_cfg) const override {
+    std::ostringstream oss;
+
+    std::string opt_level = "OPT_NONE";
+
+    if (!hls_cfg.empty() && !hls_cfg.is_null()) {
+      opt_level = "OPT_ENABLED";
+    }
+
+    std::string config_type =
+        (opt_level == "OPT_NONE") ? "void" : (name + "_cfg");
+
+    GENERATE_TYPE_ALIAS(oss, _type, name, dtype, opt_level)
+    return oss.str();
+  }
+
+private:
+  std::string _type;
+};
+
+class GlobalAvgPool1dBuilder : public GlobalPool1dBuilder {
+public:
+  GlobalAvgPool1dBuilder() : GlobalPool1dBuilder("GlobalAvgPool1d") {}
+};
+
+class GlobalMaxPool1dBuilder : public GlobalPool1dBuilder {
+public:
+  GlobalMaxPool1dBuilder() : GlobalPool1dBuilder("GlobalMaxPool1d") {}
+};
+
+} // namespace vhn
+#endif
@@ -0,0 +1,673 @@
+#pragma once
+
+#include "../opt_level.hh"
+#include "../stream.hh"
+#include "./pool.hh"
+
+namespace vhn {
+
+template <typename DType, typename HParams, typename Config = void,
+          OptLevel OPT_LEVEL = OPT_NONE, PoolType POOL_TYPE = POOL_MAX>
+class Pool2d;
+
+template <typename DType, typename HParams, typename Config = void,
+          OptLevel OPT_LEVEL = OPT_NONE>
+using MaxPool2d = Pool2d<DType, HParams, Config, OPT_LEVEL, POOL_MAX>;
+
+template <typename DType, typename HParams, typename Config = void,
+          OptLevel OPT_LEVEL = OPT_NONE>
+using AvgPool2d = Pool2d<DType, HParams, Config, OPT_LEVEL, POOL_AVG>;
+
+template <int CHANNELS, int KERNEL_SIZE, int STRIDE, int PADDING, int WIDTH,
+          int HEIGHT>
+struct Pool2dHParams {
+  static constexpr int channels = CHANNELS;
+  static constexpr int kernel_size = KERNEL_SIZE;
+  static constexpr int stride = STRIDE;
+  static constexpr int padding = PADDING;
+  static constexpr int width = WIDTH;
+  static constexpr int height = HEIGHT;
+  static constexpr int out_width =
+      (WIDTH + 2 * PADDING - KERNEL_SIZE) / STRIDE + 1;
+  static constexpr int out_height =
+      (HEIGHT + 2 * PADDING - KERNEL_SIZE) / STRIDE + 1;
+
+  static_assert(2 * PADDING <= KERNEL_SIZE,
+                "Pool2d padding must be at most half the kernel size");
+};
+
+// ============================================================================
+// Non-optimized version (OPT_NONE)
+// ============================================================================
+template <typename DType, typename HParams, PoolType POOL_TYPE>
+class Pool2d<DType, HParams, void, OPT_NONE, POOL_TYPE> {
+public:
+  using dtype = DType;
+  static constexpr int channels = HParams::channels;
+  static constexpr int kernel_size = HParams::kernel_size;
+  static constexpr int stride = HParams::stride;
+  static constexpr int padding = HParams::padding;
+  static constexpr int width = HParams::width;
+  static constexpr int height = HParams::height;
+  static constexpr int out_width = HParams::out_width;
+  static constexpr int out_height = HParams::out_height;
+  static constexpr PoolType pool_type = POOL_TYPE;
+  static constexpr OptLevel opt_level = OPT_NONE;
+
+  using impl = PoolImpl<dtype, POOL_TYPE, kernel_size * kernel_size>;
+
+  using Input_t = dtype[channels][width][height];
+  using Output_t = dtype[channels][out_width][out_height];
+
+  Pool2d() = default;
+  ~Pool2d() = default;
+
+  static void pool2d(Output_t output, const Input_t input) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+    pool2d_3d_impl(output, input);
+  }
+
+  static void pool2d(dtype output[][channels][out_width][out_height],
+                     const dtype input[][channels][width][height],
+                     const int batch_size) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 32
+#endif
+  BATCH_LOOP:
+    for (int b = 0; b < batch_size; b++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_FLATTEN off
+#endif
+      pool2d_3d_impl(output[b], input[b]);
+    }
+  }
+
+  // Row-streaming pooling over a (kernel_size - 1)-row line buffer. Pixels
+  // arrive row by row with channels innermost (same order as
+  // Conv2d::conv2d_linebuffer), outputs leave in that order as well.
+  static void pool2d(stream<dtype> &output_stream, stream<dtype> &input_stream,
+                     const int batch_size = 1) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+  BATCH_LOOP:
+    for (int b = 0; b < batch_size; b++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 32
+#endif
+      pool2d_stream_impl(output_stream, input_stream);
+    }
+  }
+
+private:
+  static void pool2d_3d_impl(dtype output[channels][out_width][out_height],
+                             const dtype input[channels][width][height]) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+  CHANNEL_LOOP:
+    for (int c = 0; c < channels; c++) {
+    OUT_POS_Y_LOOP:
+      for (int pos_y = 0; pos_y < out_width; pos_y++) {
+      OUT_POS_X_LOOP:
+        for (int pos_x = 0; pos_x < out_height; pos_x++) {
+          dtype acc = dtype(0.0f);
+          bool started = false;
+        KERNEL_Y_LOOP:
+          for (int ky = 0; ky < kernel_size; ky++) {
+          KERNEL_X_LOOP:
+            for (int kx = 0; kx < kernel_size; kx++) {
+              int in_pos_y = pos_y * stride + ky - padding;
+              int in_pos_x = pos_x * stride + kx - padding;
+              if (in_pos_y >= 0 && in_pos_y < width && in_pos_x >= 0 &&
+                  in_pos_x < height) {
+                dtype x = input[c][in_pos_y][in_pos_x];
+                acc = started ? impl::kernel(acc, x) : x;
+                started = true;
+              }
+            }
+          }
+          output[c][pos_y][pos_x] = impl::finalize(acc);
+        }
+      }
+    }
+  }
+
+  static void pool2d_stream_impl(stream<dtype> &output_stream,
+                                 stream<dtype> &input_stream) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+    constexpr int padded_width = width + 2 * padding;
+    constexpr int padded_height = height + 2 * padding;
+    constexpr int lines = (kernel_size > 1) ? kernel_size - 1 : 1;
+
+    dtype line_buffer[lines][padded_height][channels];
+    dtype window[kernel_size][kernel_size][channels];
+
+  ROW_LOOP:
+    for (int r = 0; r < padded_width; r++) {
+    COL_LOOP:
+      for (int c = 0; c < padded_height; c++) {
+        const bool inside = r >= padding && r < padding + width &&
+                            c >= padding && c < padding + height;
+
+      SHIFT_LOOP:
+        for (int ch = 0; ch < channels; ch++) {
+          dtype pixel = inside ? input_stream.read() : dtype(0.0f);
+
+          for (int wy = 0; wy < kernel_size; wy++) {
+            for (int wx = 0; wx < kernel_size - 1; wx++) {
+              window[wy][wx][ch] = window[wy][wx + 1][ch];
+            }
+          }
+          for (int wy = 0; wy < kernel_size - 1; wy++) {
+            window[wy][kernel_size - 1][ch] = line_buffer[wy][c][ch];
+          }
+          window[kernel_size - 1][kernel_size - 1][ch] = pixel;
+
+          if constexpr (kernel_size > 1) {
+            for (int wy = 0; wy < kernel_size - 2; wy++) {
+              line_buffer[wy][c][ch] = line_buffer[wy + 1][c][ch];
+            }
+            line_buffer[kernel_size - 2][c][ch] = pixel;
+          }
+        }
+
+        const int top = r - (kernel_size - 1);
+        const int left = c - (kernel_size - 1);
+        if (top < 0 || left < 0 || top % stride != 0 || left % stride != 0) {
+          continue;
+        }
+
+      OUT_CHANNEL_LOOP:
+        for (int ch = 0; ch < channels; ch++) {
+          dtype acc = dtype(0.0f);
+          bool started = false;
+          for (int ky = 0; ky < kernel_size; ky++) {
+            for (int kx = 0; kx < kernel_size; kx++) {
+              const int y = top + ky;
+              const int x = left + kx;
+              if (y >= padding && y < padding + width && x >= padding &&
+                  x < padding + height) {
+                acc = started ? impl::kernel(acc, window[ky][kx][ch])
+                              : window[ky][kx][ch];
+                started = true;
+              }
+            }
+          }
+          output_stream.write(impl::finalize(acc));
+        }
+      }
+    }
+  }
+};
+
+template <int PIPELINE_II, int UNROLL_FACTOR, int PARTITION_FACTOR>
+struct Pool2dConfig {
+  static constexpr int pipeline_ii = PIPELINE_II;
+  static constexpr int unroll_factor = UNROLL_FACTOR;
+  static constexpr int partition_factor = PARTITION_FACTOR;
+};
+
+// ============================================================================
+// Optimized version (OPT_ENABLED)
+// ============================================================================
+template <typename DType, typename HParams, typename Config,
+          PoolType POOL_TYPE>
+class Pool2d<DType, HParams, Config, OPT_ENABLED, POOL_TYPE> {
+public:
+  using dtype = DType;
+  static constexpr int channels = HParams::channels;
+  static constexpr int kernel_size = HParams::kernel_size;
+  static constexpr int stride = HParams::stride;
+  static constexpr int padding = HParams::padding;
+  static constexpr int width = HParams::width;
+  static constexpr int height = HParams::height;
+  static constexpr int out_width = HParams::out_width;
+  static constexpr int out_height = HParams::out_height;
+  static constexpr PoolType pool_type = POOL_TYPE;
+  static constexpr OptLevel opt_level = OPT_ENABLED;
+
+  static constexpr int pipeline_ii = Config::pipeline_ii;
+  static constexpr int unroll_factor = Config::unroll_factor;
+  static constexpr int partition_factor = Config::partition_factor;
+
+  using impl = PoolImpl<dtype, POOL_TYPE, kernel_size * kernel_size>;
+
+  using Input_t = dtype[channels][width][height];
+  using Output_t = dtype[channels][out_width][out_height];
+
+  Pool2d() = default;
+  ~Pool2d() = default;
+
+  static void pool2d(Output_t output, const Input_t input) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+    pool2d_3d_impl(output, input);
+  }
+
+  static void pool2d(dtype output[][channels][out_width][out_height],
+                     const dtype input[][channels][width][height],
+                     const int batch_size) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 32
+#endif
+  BATCH_LOOP:
+    for (int b = 0; b < batch_size; b++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_FLATTEN off
+#endif
+      pool2d_3d_impl(output[b], input[b]);
+    }
+  }
+
+  static void pool2d(stream<dtype> &output_stream, stream<dtype> &input_stream,
+                     const int batch_size = 1) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+  BATCH_LOOP:
+    for (int b = 0; b < batch_size; b++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 32
+#endif
+      pool2d_stream_impl(output_stream, input_stream);
+    }
+  }
+
+private:
+  static void pool2d_3d_impl(dtype output[channels][out_width][out_height],
+                             const dtype input[channels][width][height]) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+    if constexpr (partition_factor > 1 && channels <= 512) {
+#pragma HLS ARRAY_PARTITION variable = input type = cyclic factor =            \
+    partition_factor dim = 1
+#pragma HLS ARRAY_PARTITION variable = output type = cyclic factor =           \
+    partition_factor dim = 1
+    }
+#endif
+
+  OUT_POS_Y_LOOP:
+    for (int pos_y = 0; pos_y < out_width; pos_y++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 512
+#endif
+    OUT_POS_X_LOOP:
+      for (int pos_x = 0; pos_x < out_height; pos_x++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 512
+#endif
+      CHANNEL_LOOP:
+        for (int c = 0; c < channels; c++) {
+#ifdef __VITIS_HLS__
+#pragma HLS PIPELINE II = pipeline_ii
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 1024
+          if constexpr (unroll_factor > 1) {
+#pragma HLS UNROLL factor = unroll_factor
+          }
+#endif
+          dtype acc = dtype(0.0f);
+          bool started = false;
+        KERNEL_Y_LOOP:
+          for (int ky = 0; ky < kernel_size; ky++) {
+#ifdef __VITIS_HLS__
+#pragma HLS UNROLL
+#endif
+          KERNEL_X_LOOP:
+            for (int kx = 0; kx < kernel_size; kx++) {
+#ifdef __VITIS_HLS__
+#pragma HLS UNROLL
+#endif
+              int in_pos_y = pos_y * stride + ky - padding;
+              int in_pos_x = pos_x * stride + kx - padding;
+              if (in_pos_y >= 0 && in_pos_y < width && in_pos_x >= 0 &&
+                  in_pos_x < height) {
+                dtype x = input[c][in_pos_y][in_pos_x];
+                acc = started ? impl::kernel(acc, x) : x;
+                started = true;
+              }
+            }
+          }
+          output[c][pos_y][pos_x] = impl::finalize(acc);
+        }
+      }
+    }
+  }
+
+  static void pool2d_stream_impl(stream<dtype> &output_stream,
+                                 stream<dtype> &input_stream) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+    constexpr int padded_width = width + 2 * padding;
+    constexpr int padded_height = height + 2 * padding;
+    constexpr int lines = (kernel_size > 1) ? kernel_size - 1 : 1;
+
+    dtype line_buffer[lines][padded_height][channels];
+    dtype window[kernel_size][kernel_size][channels];
+#ifdef __VITIS_HLS__
+#pragma HLS ARRAY_PARTITION variable = line_buffer type = complete dim = 1
+#pragma HLS ARRAY_PARTITION variable = window type = complete dim = 1
+#pragma HLS ARRAY_PARTITION variable = window type = complete dim = 2
+#endif
+
+  ROW_LOOP:
+    for (int r = 0; r < padded_width; r++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 512
+#endif
+    COL_LOOP:
+      for (int c = 0; c < padded_height; c++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 512
+#endif
+        const bool inside = r >= padding && r < padding + width &&
+                            c >= padding && c < padding + height;
+        const int top = r - (kernel_size - 1);
+        const int left = c - (kernel_size - 1);
+        const bool emit = top >= 0 && left >= 0 && top % stride == 0 &&
+                          left % stride == 0;
+
+      CHANNEL_LOOP:
+        for (int ch = 0; ch < channels; ch++) {
+#ifdef __VITIS_HLS__
+#pragma HLS PIPELINE II = pipeline_ii
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 1024
+#endif
+          dtype pixel = inside ? input_stream.read() : dtype(0.0f);
+
+          for (int wy = 0; wy < kernel_size; wy++) {
+            for (int wx = 0; wx < kernel_size - 1; wx++) {
+              window[wy][wx][ch] = window[wy][wx + 1][ch];
+            }
+          }
+          for (int wy = 0; wy < kernel_size - 1; wy++) {
+            window[wy][kernel_size - 1][ch] = line_buffer[wy][c][ch];
+          }
+          window[kernel_size - 1][kernel_size - 1][ch] = pixel;
+
+          if constexpr (kernel_size > 1) {
+            for (int wy = 0; wy < kernel_size - 2; wy++) {
+              line_buffer[wy][c][ch] = line_buffer[wy + 1][c][ch];
+            }
+            line_buffer[kernel_size - 2][c][ch] = pixel;
+          }
+
+          // Channels are independent, so each one is reduced as soon as its
+          // window column has been shifted in.
+          if (emit) {
+            dtype acc = dtype(0.0f);
+            bool started = false;
+            for (int ky = 0; ky < kernel_size; ky++) {
+              for (int kx = 0; kx < kernel_size; kx++) {
+                const int y = top + ky;
+                const int x = left + kx;
+                if (y >= padding && y < padding + width && x >= padding &&
+                    x < padding + height) {
+                  acc = started ? impl::kernel(acc, window[ky][kx][ch])
+                                : window[ky][kx][ch];
+                  started = true;
+                }
+              }
+            }
+            output_stream.write(impl::finalize(acc));
+          }
+        }
+      }
+    }
+  }
+};
+
+// ============================================================================
+// Global pooling: one value per channel
+// ============================================================================
+template <typename DType, typename HParams, typename Config = void,
+          OptLevel OPT_LEVEL = OPT_NONE, PoolType POOL_TYPE = POOL_AVG>
+class GlobalPool2d;
+
+template <typename DType, typename HParams, typename Config = void,
+          OptLevel OPT_LEVEL = OPT_NONE>
+using GlobalAvgPool2d =
+    GlobalPool2d<DType, HParams, Config, OPT_LEVEL, POOL_AVG>;
+
+template <typename DType, typename HParams, typename Config = void,
+          OptLevel OPT_LEVEL = OPT_NONE>
+using GlobalMaxPool2d =
+    GlobalPool2d<DType, HParams, Config, OPT_LEVEL, POOL_MAX>;
+
+template <int CHANNELS, int WIDTH, int HEIGHT> struct GlobalPool2dHParams {
+  static constexpr int channels = CHANNELS;
+  static constexpr int width = WIDTH;
+  static constexpr int height = HEIGHT;
+  static constexpr int spatial_size = WIDTH * HEIGHT;
+};
+
+template <typename DType, typename HParams, PoolType POOL_TYPE>
+class GlobalPool2d<DType, HParams, void, OPT_NONE, POOL_TYPE> {
+public:
+  using dtype = DType;
+  static constexpr int channels = HParams::channels;
+  static constexpr int width = HParams::width;
+  static constexpr int height = HParams::height;
+  static constexpr int spatial_size = HParams::spatial_size;
+  static constexpr PoolType pool_type = POOL_TYPE;
+  static constexpr OptLevel opt_level = OPT_NONE;
+
+  using impl = PoolImpl<dtype, POOL_TYPE, spatial_size>;
+
+  using Input_t = dtype[channels][width][height];
+  using Output_t = dtype[channels];
+
+  GlobalPool2d() = default;
+  ~GlobalPool2d() = default;
+
+  static void pool2d(Output_t output, const Input_t input) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+    pool2d_impl(output, input);
+  }
+
+  static void pool2d(dtype output[][channels],
+                     const dtype input[][channels][width][height],
+                     const int batch_size) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+  BATCH_LOOP:
+    for (int b = 0; b < batch_size; b++) {
+      pool2d_impl(output[b], input[b]);
+    }
+  }
+
+  // Pixels arrive with channels innermost; one value per channel is written
+  // after the last pixel.
+  static void pool2d(stream<dtype> &output_stream, stream<dtype> &input_stream,
+                     const int batch_size = 1) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+  BATCH_LOOP:
+    for (int b = 0; b < batch_size; b++) {
+      dtype acc[channels];
+    PIXEL_LOOP:
+      for (int s = 0; s < spatial_size; s++) {
+      CHANNEL_LOOP:
+        for (int c = 0; c < channels; c++) {
+          dtype x = input_stream.read();
+          acc[c] = (s == 0) ? x : impl::kernel(acc[c], x);
+        }
+      }
+    WRITE_OUTPUT:
+      for (int c = 0; c < channels; c++) {
+        output_stream.write(impl::finalize(acc[c]));
+      }
+    }
+  }
+
+private:
+  static void pool2d_impl(dtype output[channels],
+                          const dtype input[channels][width][height]) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+  CHANNEL_LOOP:
+    for (int c = 0; c < channels; c++) {
+      dtype acc = input[c][0][0];
+    SPATIAL_LOOP:
+      for (int s = 1; s < spatial_size; s++) {
+        acc = impl::kernel(acc, input[c][s / height][s % height]);
+      }
+      output[c] = impl::finalize(acc);
+    }
+  }
+};
+
+template <typename DType, typename HParams, typename Config,
+          PoolType POOL_TYPE>
+class GlobalPool2d<DType, HParams, Config, OPT_ENABLED, POOL_TYPE> {
+public:
+  using dtype = DType;
+  static constexpr int channels = HParams::channels;
+  static constexpr int width = HParams::width;
+  static constexpr int height = HParams::height;
+  static constexpr int spatial_size = HParams::spatial_size;
+  static constexpr PoolType pool_type = POOL_TYPE;
+  static constexpr OptLevel opt_level = OPT_ENABLED;
+
+  static constexpr int pipeline_ii = Config::pipeline_ii;
+  static constexpr int unroll_factor = Config::unroll_factor;
+  static constexpr int partition_factor = Config::partition_factor;
+
+  using impl = PoolImpl<dtype, POOL_TYPE, spatial_size>;
+
+  using Input_t = dtype[channels][width][height];
+  using Output_t = dtype[channels];
+
+  GlobalPool2d() = default;
+  ~GlobalPool2d() = default;
+
+  static void pool2d(Output_t output, const Input_t input) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+    pool2d_impl(output, input);
+  }
+
+  static void pool2d(dtype output[][channels],
+                     const dtype input[][channels][width][height],
+                     const int batch_size) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 32
+#endif
+  BATCH_LOOP:
+    for (int b = 0; b < batch_size; b++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_FLATTEN off
+#endif
+      pool2d_impl(output[b], input[b]);
+    }
+  }
+
+  static void pool2d(stream<dtype> &output_stream, stream<dtype> &input_stream,
+                     const int batch_size = 1) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+  BATCH_LOOP:
+    for (int b = 0; b < batch_size; b++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 32
+#endif
+      dtype acc[channels];
+#ifdef __VITIS_HLS__
+      if constexpr (partition_factor > 1 && channels <= 1024) {
+#pragma HLS ARRAY_PARTITION variable = acc type = cyclic factor =              \
+    partition_factor
+      }
+#endif
+    PIXEL_LOOP:
+      for (int s = 0; s < spatial_size; s++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 262144
+#endif
+      CHANNEL_LOOP:
+        for (int c = 0; c < channels; c++) {
+#ifdef __VITIS_HLS__
+#pragma HLS PIPELINE II = pipeline_ii
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 1024
+#endif
+          dtype x = input_stream.read();
+          acc[c] = (s == 0) ? x : impl::kernel(acc[c], x);
+        }
+      }
+    WRITE_OUTPUT:
+      for (int c = 0; c < channels; c++) {
+#ifdef __VITIS_HLS__
+#pragma HLS PIPELINE II = 1
+#endif
+        output_stream.write(impl::finalize(acc[c]));
+      }
+    }
+  }
+
+private:
+  static void pool2d_impl(dtype output[channels],
+                          const dtype input[channels][width][height]) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+    if constexpr (partition_factor > 1 && channels <= 512) {
+#pragma HLS ARRAY_PARTITION variable = input type = cyclic factor =            \
+    partition_factor dim = 1
+#pragma HLS ARRAY_PARTITION variable = output type = cyclic factor =           \
+    partition_factor
+    }
+#endif
+    dtype acc[channels];
+#ifdef __VITIS_HLS__
+    if constexpr (partition_factor > 1 && channels <= 1024) {
+#pragma HLS ARRAY_PARTITION variable = acc type = cyclic factor =              \
+    partition_factor
+    }
+#endif
+
+    // Spatial-outer / channel-inner keeps one running value per channel and
+    // lets independent channels fill the accumulation pipeline.
+  PIXEL_LOOP:
+    for (int s = 0; s < spatial_size; s++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 262144
+#endif
+    CHANNEL_LOOP:
+      for (int c = 0; c < channels; c++) {
+#ifdef __VITIS_HLS__
+#pragma HLS PIPELINE II = pipeline_ii
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 1024
+        if constexpr (unroll_factor > 1) {
+#pragma HLS UNROLL factor = unroll_factor
+        }
+#endif
+        dtype x = input[c][s / height][s % height];
+        acc[c] = (s == 0) ? x : impl::kernel(acc[c], x);
+      }
+    }
+
+  WRITE_OUTPUT:
+    for (int c = 0; c < channels; c++) {
+#ifdef __VITIS_HLS__
+#pragma HLS PIPELINE II = 1
+#endif
+      output[c] = impl::finalize(acc[c]);
+    }
+  }
+};
+
+} // namespace vhn
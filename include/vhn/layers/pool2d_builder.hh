@@ -0,0 +1,167 @@
+#pragma once
+
+#ifndef __VITIS_HLS__
+#include "../builder/builder.hh"
+#include <sstream>
+
+namespace vhn {
+
+// Shared by MaxPool2d / AvgPool2d; `type` is the emitted class name.
+class Pool2dBuilder : public BaseBuilder {
+public:
+  explicit Pool2dBuilder(const std::string &type) : _type(type) {}
+
+  std::string generate_hparams(const std::string &name,
+                               const std::string &dtype,
+                               const json &hparams) const override {
+    std::ostringstream oss;
+
+    NECESSARY_HPARAMS(_type, name, "channels")
+    NECESSARY_HPARAMS(_type, name, "kernel_size")
+    NECESSARY_HPARAMS(_type, name, "width")
+    NECESSARY_HPARAMS(_type, name, "height")
+
+    auto channels = hparams["channels"].get<int>();
+    auto kernel_size = hparams["kernel_size"].get<int>();
+    auto stride = hparams.value("stride", kernel_size);
+    auto padding = hparams.value("padding", 0);
+    auto width = hparams["width"].get<int>();
+    auto height = hparams["height"].get<int>();
+
+    oss << "using " << name << "_hparams = vhn::Pool2dHParams<";
+    oss << channels << ", " << kernel_size << ", " << stride << ", "
+        << padding << ", " << width << ", " << height;
+    oss << ">;\n\n";
+
+    return oss.str();
+  }
+
+  std::string generate_config(const std::string &name,
+                              const json &hls_cfg) const override {
+    if (hls_cfg.empty() || hls_cfg.is_null()) {
+      return "";
+    }
+
+    std::ostringstream oss;
+
+    auto pipeline_ii = hls_cfg.value("pipeline_ii", 1);
+    auto unroll_factor = hls_cfg.value("unroll_factor", 1);
+    auto partition_factor = hls_cfg.value("partition_factor", 4);
+
+    oss << "using " << name << "_cfg = vhn::Pool2dConfig<";
+    oss << pipeline_ii << ", " << unroll_factor << ", " << partition_factor;
+    oss << ">;\n\n";
+
+    return oss.str();
+  }
+
+  std::string generate_type_alias(const std::string &name,
+                                  const std::string &dtype,
+                                  const json &hls_cfg) const override {
+    std::ostringstream oss;
+
+    std::string opt_level = "OPT_NONE";
+
+    if (!hls_cfg.empty() && !hls_cfg.is_null()) {
+      opt_level = "OPT_ENABLED";
+    }
+
+    std::string config_type =
+        (opt_level == "OPT_NONE") ? "void" : (name + "_cfg");
+
+    GENERATE_TYPE_ALIAS(oss, _type, name, dtype, opt_level)
+    return oss.str();
+  }
+
+private:
+  std::string _type;
+};
+
+class MaxPool2dBuilder : public Pool2dBuilder {
+public:
+  MaxPool2dBuilder() : Pool2dBuilder("MaxPool2d") {}
+};
+
+class AvgPool2dBuilder : public Pool2dBuilder {
+public:
+  AvgPool2dBuilder() : Pool2dBuilder("AvgPool2d") {}
+};
+
+// Shared by GlobalAvgPool2d / GlobalMaxPool2d.
+class GlobalPool2dBuilder : public BaseBuilder {
+public:
+  explicit GlobalPool2dBuilder(const std::string &type) : _type(type) {}
+
+  std::string generate_hparams(const std::string &name,
+                               const std::string &dtype,
+                               const json &hparams) const override {
+    std::ostringstream oss;
+
+    NECESSARY_HPARAMS(_type, name, "channels")
+    NECESSARY_HPARAMS(_type, name, "width")
+    NECESSARY_HPARAMS(_type, name, "height")
+
+    auto channels = hparams["channels"].get<int>();
+    auto width = hparams["width"].get<int>();
+    auto height = hparams["height"].get<int>();
+
+    oss << "using " << name << "_hparams = vhn::GlobalPool2dHParams<";
+    oss << channels << ", " << width << ", " << height;
+    oss << ">;\n\n";
+
+    return oss.str();
+  }
+
+  std::string generate_config(const std::string &name,
+                              const json &hls_cfg) const override {
+    if (hls_cfg.empty() || hls_cfg.is_null()) {
+      return "";
+    }
+
+    std::ostringstream oss;
+
+    auto pipeline_ii = hls_cfg.value("pipeline_ii", 1);
+    auto unroll_factor = hls_cfg.value("unroll_factor", 1);
+    auto partition_factor = hls_cfg.value("partition_factor", 4);
+
+    oss << "using " << name << "_cfg = vhn::Pool2dConfig<";
+    oss << pipeline_ii << ", " << unroll_factor << ", " << partition_factor;
+    oss << ">;\n\n";
+
+    return oss.str();
+  }
+
+  std::string generate_type_alias(const std::string &name,
+                                  const std::string &dtype,
+                                  const json &hls_cfg) const override {
+    std::ostringstream oss;
+
+    std::string opt_level = "OPT_NONE";
+
+    if (!hls_cfg.empty() && !hls_cfg.is_null()) {
+      opt_level = "OPT_ENABLED";
+    }
+
+    std::string config_type =
+        (opt_level == "OPT_NONE") ? "void" : (name + "_cfg");
+
+    GENERATE_TYPE_ALIAS(oss, _type, name, dtype, opt_level)
+    return oss.str();
+  }
+
+private:
+  std::string _type;
+};
+
+class GlobalAvgPool2dBuilder : public GlobalPool2dBuilder {
+public:
+  GlobalAvgPool2dBuilder() : GlobalPool2dBuilder("GlobalAvgPool2d") {}
+};
+
+class GlobalMaxPool2dBuilder : public GlobalPool2dBuilder {
+public:
+  GlobalMaxPool2dBuilder() : GlobalPool2dBuilder("GlobalMaxPool2d") {}
+};
+
+} // namespace vhn
+#endif
@@ -0,0 +1,268 @@
+#pragma once
+
+#include "../opt_level.hh"
+#include "../quant.hh"
+#include "./conv1d.hh"
+
+namespace vhn {
+
+template <typename DType, typename HParams, typename Config = void,
+          OptLevel OPT_LEVEL = OPT_NONE>
+class QConv1d;
+
+// int8 Conv1d: int8 activations and weights, int32 accumulation, and a
+// per-output-channel requantization (see Quant) fused with an optional ReLU.
+template <typename CONV_HPARAMS, bool RELU = false> struct QConv1dHParams {
+  using conv_hparams = CONV_HPARAMS;
+  static constexpr bool relu = RELU;
+
+  static constexpr int in_channels = CONV_HPARAMS::in_channels;
+  static constexpr int out_channels = CONV_HPARAMS::out_channels;
+  static constexpr int kernel_size = CONV_HPARAMS::kernel_size;
+  static constexpr int padding = CONV_HPARAMS::padding;
+  static constexpr int n = CONV_HPARAMS::n;
+  static constexpr int out_length = CONV_HPARAMS::out_length;
+  static constexpr int stride = CONV_HPARAMS::stride;
+  static constexpr int dilation = CONV_HPARAMS::dilation;
+  static constexpr int groups = CONV_HPARAMS::groups;
+};
+
+// ============================================================================
+// Non-optimized version (OPT_NONE)
+// ============================================================================
+template <typename DType, typename HParams>
+class QConv1d<DType, HParams, void, OPT_NONE> {
+public:
+  using dtype = DType;
+  using acc_t = qint32_t;
+  static constexpr int in_channels = HParams::in_channels;
+  static constexpr int out_channels = HParams::out_channels;
+  static constexpr int kernel_size = HParams::kernel_size;
+  static constexpr int padding = HParams::padding;
+  static constexpr int n = HParams::n;
+  static constexpr int out_length = HParams::out_length;
+  static constexpr int stride = HParams::stride;
+  static constexpr int dilation = HParams::dilation;
+  static constexpr int groups = HParams::groups;
+  static constexpr bool relu = HParams::relu;
+  static constexpr int in_channels_per_group = in_channels / groups;
+  static constexpr int out_channels_per_group = out_channels / groups;
+  static constexpr OptLevel opt_level = OPT_NONE;
+
+  using Weight_t = dtype[out_channels][in_channels_per_group][kernel_size];
+  using Bias_t = acc_t[out_channels];
+  using Multiplier_t = qint32_t[out_channels];
+  using Shift_t = int[out_channels];
+  using Input_t = dtype[in_channels][n];
+  using Output_t = dtype[out_channels][out_length];
+
+  QConv1d() = default;
+  ~QConv1d() = default;
+
+  static void conv1d(Output_t output, const Input_t input,
+                     const Weight_t weight, const Bias_t bias,
+                     const Multiplier_t multiplier, const Shift_t shift) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+    conv1d_2d_impl(output, input, weight, bias, multiplier, shift);
+  }
+
+  static void conv1d(dtype output[][out_channels][out_length],
+                     const dtype input[][in_channels][n], const Weight_t weight,
+                     const Bias_t bias, const Multiplier_t multiplier,
+                     const Shift_t shift, const int batch_size) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 32
+#endif
+  BATCH_LOOP:
+    for (int b = 0; b < batch_size; b++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_FLATTEN off
+#endif
+      conv1d_2d_impl(output[b], input[b], weight, bias, multiplier, shift);
+    }
+  }
+
+private:
+  static void conv1d_2d_impl(dtype output[out_channels][out_length],
+                             const dtype input[in_channels][n],
+                             const Weight_t weight, const Bias_t bias,
+                             const Multiplier_t multiplier,
+                             const Shift_t shift) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+  OUT_CHANNEL_LOOP:
+    for (int oc = 0; oc < out_channels; oc++) {
+      const int group_base =
+          (oc / out_channels_per_group) * in_channels_per_group;
+    OUT_POS_LOOP:
+      for (int pos = 0; pos < out_length; pos++) {
+        acc_t acc = bias[oc];
+      IN_CHANNEL_LOOP:
+        for (int icg = 0; icg < in_channels_per_group; icg++) {
+        KERNEL_LOOP:
+          for (int k = 0; k < kernel_size; k++) {
+            int in_pos = pos * stride + k * dilation - padding;
+            if (in_pos >= 0 && in_pos < n) {
+              acc += acc_t(input[group_base + icg][in_pos]) *
+                     acc_t(weight[oc][icg][k]);
+            }
+          }
+        }
+        output[oc][pos] =
+            Quant::requantize<relu>(acc, multiplier[oc], shift[oc]);
+      }
+    }
+  }
+};
+
+template <int PIPELINE_II, int UNROLL_FACTOR, int PARTITION_FACTOR>
+struct QConv1dConfig {
+  static constexpr int pipeline_ii = PIPELINE_II;
+  static constexpr int unroll_factor = UNROLL_FACTOR;
+  static constexpr int partition_factor = PARTITION_FACTOR;
+};
+
+// ============================================================================
+// Optimized version (OPT_ENABLED)
+// ============================================================================
+// Same reordering as QConv2d: each weight tap is broadcast over an int32
+// accumulator row, keeping the innermost loop unit-stride. Integer
+// accumulation is exact, so results equal the OPT_NONE version.
+template <typename DType, typename HParams, typename Config>
+class QConv1d<DType, HParams, Config, OPT_ENABLED> {
+public:
+  using dtype = DType;
+  using acc_t = qint32_t;
+  static constexpr int in_channels = HParams::in_channels;
+  static constexpr int out_channels = HParams::out_channels;
+  static constexpr int kernel_size = HParams::kernel_size;
+  static constexpr int padding = HParams::padding;
+  static constexpr int n = HParams::n;
+  static constexpr int out_length = HParams::out_length;
+  static constexpr int stride = HParams::stride;
+  static constexpr int dilation = HParams::dilation;
+  static constexpr int groups = HParams::groups;
+  static constexpr bool relu = HParams::relu;
+  static constexpr int in_channels_per_group = in_channels / groups;
+  static constexpr int out_channels_per_group = out_channels / groups;
+  static constexpr OptLevel opt_level = OPT_ENABLED;
+
+  static constexpr int pipeline_ii = Config::pipeline_ii;
+  static constexpr int unroll_factor = Config::unroll_factor;
+  static constexpr int partition_factor = Config::partition_factor;
+
+  using Weight_t = dtype[out_channels][in_channels_per_group][kernel_size];
+  using Bias_t = acc_t[out_channels];
+  using Multiplier_t = qint32_t[out_channels];
+  using Shift_t = int[out_channels];
+  using Input_t = dtype[in_channels][n];
+  using Output_t = dtype[out_channels][out_length];
+
+  QConv1d() = default;
+  ~QConv1d() = default;
+
+  static void conv1d(Output_t output, const Input_t input,
+                     const Weight_t weight, const Bias_t bias,
+                     const Multiplier_t multiplier, const Shift_t shift) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+    conv1d_2d_impl(output, input, weight, bias, multiplier, shift);
+  }
+
+  static void conv1d(dtype output[][out_channels][out_length],
+                     const dtype input[][in_channels][n], const Weight_t weight,
+                     const Bias_t bias, const Multiplier_t multiplier,
+                     const Shift_t shift, const int batch_size) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 32
+#endif
+  BATCH_LOOP:
+    for (int b = 0; b < batch_size; b++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_FLATTEN off
+#endif
+      conv1d_2d_impl(output[b], input[b], weight, bias, multiplier, shift);
+    }
+  }
+
+private:
+  static void conv1d_2d_impl(dtype output[out_channels][out_length],
+                             const dtype input[in_channels][n],
+                             const Weight_t weight, const Bias_t bias,
+                             const Multiplier_t multiplier,
+                             const Shift_t shift) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+    if constexpr (partition_factor > 1) {
+#pragma HLS ARRAY_PARTITION variable = input type = cyclic factor =            \
+    partition_factor dim = 2
+    }
+#endif
+    acc_t acc[out_length];
+#ifdef __VITIS_HLS__
+    if constexpr (partition_factor > 1) {
+#pragma HLS ARRAY_PARTITION variable = acc type = cyclic factor =              \
+    partition_factor dim = 1
+    }
+#endif
+
+  OUT_CHANNEL_LOOP:
+    for (int oc = 0; oc < out_channels; oc++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 512
+#endif
+      const int group_base =
+          (oc / out_channels_per_group) * in_channels_per_group;
+
+    ACC_INIT_LOOP:
+      for (int pos = 0; pos < out_length; pos++) {
+#ifdef __VITIS_HLS__
+#pragma HLS PIPELINE II = 1
+#endif
+        acc[pos] = bias[oc];
+      }
+
+    IN_CHANNEL_LOOP:
+      for (int icg = 0; icg < in_channels_per_group; icg++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 512
+#endif
+      KERNEL_LOOP:
+        for (int k = 0; k < kernel_size; k++) {
+          const acc_t w = weight[oc][icg][k];
+        ROW_LOOP:
+          for (int pos = 0; pos < out_length; pos++) {
+#ifdef __VITIS_HLS__
+#pragma HLS PIPELINE II = pipeline_ii
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 1024
+            if constexpr (unroll_factor > 1) {
+#pragma HLS UNROLL factor = unroll_factor
+            }
+#endif
+            const int in_pos = pos * stride + k * dilation - padding;
+            if (in_pos >= 0 && in_pos < n) {
+              acc[pos] += acc_t(input[group_base + icg][in_pos]) * w;
+            }
+          }
+        }
+      }
+
+    REQUANT_LOOP:
+      for (int pos = 0; pos < out_length; pos++) {
+#ifdef __VITIS_HLS__
+#pragma HLS PIPELINE II = 1
+#endif
+        output[oc][pos] =
+            Quant::requantize<relu>(acc[pos], multiplier[oc], shift[oc]);
+      }
+    }
+  }
+};
+
+} // namespace vhn
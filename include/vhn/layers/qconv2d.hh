@@ -0,0 +1,306 @@
+#pragma once
+
+#include "../opt_level.hh"
+#include "../quant.hh"
+#include "./conv2d.hh"
+
+namespace vhn {
+
+template <typename DType, typename HParams, typename Config = void,
+          OptLevel OPT_LEVEL = OPT_NONE>
+class QConv2d;
+
+// int8 Conv2d: int8 activations and weights, int32 accumulation, and a
+// per-output-channel requantization (see Quant) fused with an optional ReLU.
+template <typename CONV_HPARAMS, bool RELU = false> struct QConv2dHParams {
+  using conv_hparams = CONV_HPARAMS;
+  static constexpr bool relu = RELU;
+
+  static constexpr int in_channels = CONV_HPARAMS::in_channels;
+  static constexpr int out_channels = CONV_HPARAMS::out_channels;
+  static constexpr int kernel_size = CONV_HPARAMS::kernel_size;
+  static constexpr int padding = CONV_HPARAMS::padding;
+  static constexpr int width = CONV_HPARAMS::width;
+  static constexpr int height = CONV_HPARAMS::height;
+  static constexpr int out_width = CONV_HPARAMS::out_width;
+  static constexpr int out_height = CONV_HPARAMS::out_height;
+  static constexpr int stride = CONV_HPARAMS::stride;
+  static constexpr int dilation = CONV_HPARAMS::dilation;
+  static constexpr int groups = CONV_HPARAMS::groups;
+};
+
+// ============================================================================
+// Non-optimized version (OPT_NONE)
+// ============================================================================
+template <typename DType, typename HParams>
+class QConv2d<DType, HParams, void, OPT_NONE> {
+public:
+  using dtype = DType;
+  using acc_t = qint32_t;
+  static constexpr int in_channels = HParams::in_channels;
+  static constexpr int out_channels = HParams::out_channels;
+  static constexpr int kernel_size = HParams::kernel_size;
+  static constexpr int padding = HParams::padding;
+  static constexpr int width = HParams::width;
+  static constexpr int height = HParams::height;
+  static constexpr int out_width = HParams::out_width;
+  static constexpr int out_height = HParams::out_height;
+  static constexpr int stride = HParams::stride;
+  static constexpr int dilation = HParams::dilation;
+  static constexpr int groups = HParams::groups;
+  static constexpr bool relu = HParams::relu;
+  static constexpr int in_channels_per_group = in_channels / groups;
+  static constexpr int out_channels_per_group = out_channels / groups;
+  static constexpr OptLevel opt_level = OPT_NONE;
+
+  using Weight_t =
+      dtype[out_channels][in_channels_per_group][kernel_size][kernel_size];
+  using Bias_t = acc_t[out_channels];
+  using Multiplier_t = qint32_t[out_channels];
+  using Shift_t = int[out_channels];
+  using Input_t = dtype[in_channels][width][height];
+  using Output_t = dtype[out_channels][out_width][out_height];
+
+  QConv2d() = default;
+  ~QConv2d() = default;
+
+  static void conv2d(Output_t output, const Input_t input,
+                     const Weight_t weight, const Bias_t bias,
+                     const Multiplier_t multiplier, const Shift_t shift) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+    conv2d_3d_impl(output, input, weight, bias, multiplier, shift);
+  }
+
+  static void conv2d(dtype output[][out_channels][out_width][out_height],
+                     const dtype input[][in_channels][width][height],
+                     const int batch_size, const Weight_t weight,
+                     const Bias_t bias, const Multiplier_t multiplier,
+                     const Shift_t shift) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 32
+#endif
+  BATCH_LOOP:
+    for (int b = 0; b < batch_size; b++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_FLATTEN off
+#endif
+      conv2d_3d_impl(output[b], input[b], weight, bias, multiplier, shift);
+    }
+  }
+
+private:
+  static void conv2d_3d_impl(dtype output[out_channels][out_width][out_height],
+                             const dtype input[in_channels][width][height],
+                             const Weight_t weight, const Bias_t bias,
+                             const Multiplier_t multiplier,
+                             const Shift_t shift) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+  OUT_CHANNEL_LOOP:
+    for (int oc = 0; oc < out_channels; oc++) {
+      const int group_base =
+          (oc / out_channels_per_group) * in_channels_per_group;
+    OUT_POS_Y_LOOP:
+      for (int pos_y = 0; pos_y < out_width; pos_y++) {
+      OUT_POS_X_LOOP:
+        for (int pos_x = 0; pos_x < out_height; pos_x++) {
+          acc_t acc = bias[oc];
+        IN_CHANNEL_LOOP:
+          for (int icg = 0; icg < in_channels_per_group; icg++) {
+          KERNEL_Y_LOOP:
+            for (int ky = 0; ky < kernel_size; ky++) {
+            KERNEL_X_LOOP:
+              for (int kx = 0; kx < kernel_size; kx++) {
+                int in_pos_y = pos_y * stride + ky * dilation - padding;
+                int in_pos_x = pos_x * stride + kx * dilation - padding;
+                if (in_pos_y >= 0 && in_pos_y < width && in_pos_x >= 0 &&
+                    in_pos_x < height) {
+                  acc += acc_t(input[group_base + icg][in_pos_y][in_pos_x]) *
+                         acc_t(weight[oc][icg][ky][kx]);
+                }
+              }
+            }
+          }
+          output[oc][pos_y][pos_x] =
+              Quant::requantize<relu>(acc, multiplier[oc], shift[oc]);
+        }
+      }
+    }
+  }
+};
+
+template <int PIPELINE_II, int UNROLL_FACTOR, int PARTITION_FACTOR>
+struct QConv2dConfig {
+  static constexpr int pipeline_ii = PIPELINE_II;
+  static constexpr int unroll_factor = UNROLL_FACTOR;
+  static constexpr int partition_factor = PARTITION_FACTOR;
+};
+
+// ============================================================================
+// Optimized version (OPT_ENABLED)
+// ============================================================================
+// Integer accumulation is exact, so the loops are reordered freely: every
+// weight tap is broadcast over a whole output plane held in an int32
+// accumulator buffer, which keeps the innermost loop unit-stride (vectorised
+// on host, one MAC per cycle per unrolled lane under HLS). Results are
+// identical to the OPT_NONE version.
+template <typename DType, typename HParams, typename Config>
+class QConv2d<DType, HParams, Config, OPT_ENABLED> {
+public:
+  using dtype = DType;
+  using acc_t = qint32_t;
+  static constexpr int in_channels = HParams::in_channels;
+  static constexpr int out_channels = HParams::out_channels;
+  static constexpr int kernel_size = HParams::kernel_size;
+  static constexpr int padding = HParams::padding;
+  static constexpr int width = HParams::width;
+  static constexpr int height = HParams::height;
+  static constexpr int out_width = HParams::out_width;
+  static constexpr int out_height = HParams::out_height;
+  static constexpr int stride = HParams::stride;
+  static constexpr int dilation = HParams::dilation;
+  static constexpr int groups = HParams::groups;
+  static constexpr bool relu = HParams::relu;
+  static constexpr int in_channels_per_group = in_channels / groups;
+  static constexpr int out_channels_per_group = out_channels / groups;
+  static constexpr OptLevel opt_level = OPT_ENABLED;
+
+  static constexpr int pipeline_ii = Config::pipeline_ii;
+  static constexpr int unroll_factor = Config::unroll_factor;
+  static constexpr int partition_factor = Config::partition_factor;
+
+  using Weight_t =
+      dtype[out_channels][in_channels_per_group][kernel_size][kernel_size];
+  using Bias_t = acc_t[out_channels];
+  using Multiplier_t = qint32_t[out_channels];
+  using Shift_t = int[out_channels];
+  using Input_t = dtype[in_channels][width][height];
+  using Output_t = dtype[out_channels][out_width][out_height];
+
+  QConv2d() = default;
+  ~QConv2d() = default;
+
+  static void conv2d(Output_t output, const Input_t input,
+                     const Weight_t weight, const Bias_t bias,
+                     const Multiplier_t multiplier, const Shift_t shift) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+    conv2d_3d_impl(output, input, weight, bias, multiplier, shift);
+  }
+
+  static void conv2d(dtype output[][out_channels][out_width][out_height],
+                     const dtype input[][in_channels][width][height],
+                     const int batch_size, const Weight_t weight,
+                     const Bias_t bias, const Multiplier_t multiplier,
+                     const Shift_t shift) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 32
+#endif
+  BATCH_LOOP:
+    for (int b = 0; b < batch_size; b++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_FLATTEN off
+#endif
+      conv2d_3d_impl(output[b], input[b], weight, bias, multiplier, shift);
+    }
+  }
+
+private:
+  static void conv2d_3d_impl(dtype output[out_channels][out_width][out_height],
+                             const dtype input[in_channels][width][height],
+                             const Weight_t weight, const Bias_t bias,
+                             const Multiplier_t multiplier,
+                             const Shift_t shift) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+    if constexpr (partition_factor > 1) {
+#pragma HLS ARRAY_PARTITION variable = input type = cyclic factor =            \
+    partition_factor dim = 3
+    }
+#endif
+    acc_t acc[out_width][out_height];
+#ifdef __VITIS_HLS__
+    if constexpr (partition_factor > 1) {
+#pragma HLS ARRAY_PARTITION variable = acc type = cyclic factor =              \
+    partition_factor dim = 2
+    }
+#endif
+
+  OUT_CHANNEL_LOOP:
+    for (int oc = 0; oc < out_channels; oc++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 512
+#endif
+      const int group_base =
+          (oc / out_channels_per_group) * in_channels_per_group;
+
+    ACC_INIT_LOOP:
+      for (int y = 0; y < out_width; y++) {
+        for (int x = 0; x < out_height; x++) {
+#ifdef __VITIS_HLS__
+#pragma HLS PIPELINE II = 1
+#endif
+          acc[y][x] = bias[oc];
+        }
+      }
+
+    IN_CHANNEL_LOOP:
+      for (int icg = 0; icg < in_channels_per_group; icg++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 512
+#endif
+        const dtype *in_plane = &input[group_base + icg][0][0];
+      KERNEL_Y_LOOP:
+        for (int ky = 0; ky < kernel_size; ky++) {
+        KERNEL_X_LOOP:
+          for (int kx = 0; kx < kernel_size; kx++) {
+            const acc_t w = weight[oc][icg][ky][kx];
+          PLANE_Y_LOOP:
+            for (int y = 0; y < out_width; y++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 512
+#endif
+              const int in_y = y * stride + ky * dilation - padding;
+              if (in_y < 0 || in_y >= width) {
+                continue;
+              }
+            PLANE_X_LOOP:
+              for (int x = 0; x < out_height; x++) {
+#ifdef __VITIS_HLS__
+#pragma HLS PIPELINE II = pipeline_ii
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 512
+                if constexpr (unroll_factor > 1) {
+#pragma HLS UNROLL factor = unroll_factor
+                }
+#endif
+                const int in_x = x * stride + kx * dilation - padding;
+                if (in_x >= 0 && in_x < height) {
+                  acc[y][x] += acc_t(in_plane[in_y * height + in_x]) * w;
+                }
+              }
+            }
+          }
+        }
+      }
+
+    REQUANT_LOOP:
+      for (int y = 0; y < out_width; y++) {
+        for (int x = 0; x < out_height; x++) {
+#ifdef __VITIS_HLS__
+#pragma HLS PIPELINE II = 1
+#endif
+          output[oc][y][x] =
+              Quant::requantize<relu>(acc[y][x], multiplier[oc], shift[oc]);
+        }
+      }
+    }
+  }
+};
+
+} // namespace vhn
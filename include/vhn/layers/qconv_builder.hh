@@ -0,0 +1,87 @@
+#pragma once
+
+#ifndef __VITIS_HLS__
+#include "../builder/builder.hh"
+#include "./conv1d_builder.hh"
+#include "./conv2d_builder.hh"
+#include <sstream>
+
+namespace vhn {
+
+// Shared by QConv1d / QConv2d. hparams are those of the float layer plus
+// "relu" (default false); the layer always runs on vhn::qint8_t regardless
+// of the model dtype.
+template <typename ConvBuilder> class QConvBuilder : public BaseBuilder {
+public:
+  explicit QConvBuilder(const std::string &type) : _type(type) {}
+
+  std::string generate_hparams(const std::string &name,
+                               const std::string &dtype,
+                               const json &hparams) const override {
+    std::ostringstream oss;
+
+    auto relu = hparams.value("relu", false);
+
+    ConvBuilder conv_builder;
+    oss << conv_builder.generate_hparams(name + "_conv", dtype, hparams);
+
+    oss << "using " << name << "_hparams = vhn::" << _type << "HParams<";
+    oss << name << "_conv_hparams, " << (relu ? "true" : "false");
+    oss << ">;\n\n";
+
+    return oss.str();
+  }
+
+  std::string generate_config(const std::string &name,
+                              const json &hls_cfg) const override {
+    if (hls_cfg.empty() || hls_cfg.is_null()) {
+      return "";
+    }
+
+    std::ostringstream oss;
+
+    auto pipeline_ii = hls_cfg.value("pipeline_ii", 1);
+    auto unroll_factor = hls_cfg.value("unroll_factor", 1);
+    auto partition_factor = hls_cfg.value("partition_factor", 4);
+
+    oss << "using " << name << "_cfg = vhn::" << _type << "Config<";
+    oss << pipeline_ii << ", " << unroll_factor << ", " << partition_factor;
+    oss << ">;\n\n";
+
+    return oss.str();
+  }
+
+  std::string generate_type_alias(const std::string &name,
+                                  const std::string &dtype,
+                                  const json &hls_cfg) const override {
+    std::ostringstream oss;
+
+    std::string opt_level = "OPT_NONE";
+
+    if (!hls_cfg.empty() && !hls_cfg.is_null()) {
+      opt_level = "OPT_ENABLED";
+    }
+
+    std::string config_type =
+        (opt_level == "OPT_NONE") ? "void" : (name + "_cfg");
+
+    GENERATE_TYPE_ALIAS(oss, _type, name, "vhn::qint8_t", opt_level)
+    return oss.str();
+  }
+
+private:
+  std::string _type;
+};
+
+class QConv1dBuilder : public QConvBuilder<Conv1dBuilder> {
+public:
+  QConv1dBuilder() : QConvBuilder("QConv1d") {}
+};
+
+class QConv2dBuilder : public QConvBuilder<Conv2dBuilder> {
+public:
+  QConv2dBuilder() : QConvBuilder("QConv2d") {}
+};
+
+} // namespace vhn
+#endif
@@ -0,0 +1,284 @@
+#pragma once
+
+#include "../opt_level.hh"
+#include "../quant.hh"
+
+#ifdef __VITIS_HLS__
+#include <hls_stream.h>
+#endif
+
+namespace vhn {
+
+template <typename DType, typename HParams, typename Config = void,
+          OptLevel OPT_LEVEL = OPT_NONE>
+class QEmbedding;
+
+// Embedding table stored as BITS-bit (8 or 4) row-wise quantized codes with
+// a per-row scale and offset (see RowwiseQuant); rows are dequantized to
+// DType during the gather. An 8-bit table is 4x and a 4-bit table 8x smaller
+// than float, and the gather reads proportionally fewer bytes.
+template <int VOCAB_SIZE, int EMBED_SIZE, int BITS = 8>
+struct QEmbeddingHParams {
+  static constexpr int vocab_size = VOCAB_SIZE;
+  static constexpr int embed_size = EMBED_SIZE;
+  static constexpr int bits = BITS;
+  static constexpr int row_bytes = RowwiseQuant<BITS>::row_bytes(EMBED_SIZE);
+};
+
+// ============================================================================
+// Non-optimized version (OPT_NONE)
+// ============================================================================
+template <typename DType, typename HParams>
+class QEmbedding<DType, HParams, void, OPT_NONE> {
+public:
+  using dtype = DType;
+  static constexpr int vocab_size = HParams::vocab_size;
+  static constexpr int embed_size = HParams::embed_size;
+  static constexpr int bits = HParams::bits;
+  static constexpr int row_bytes = HParams::row_bytes;
+  static constexpr OptLevel opt_level = OPT_NONE;
+
+  using quant = RowwiseQuant<bits>;
+  using Weight_t = quint8_t[vocab_size][row_bytes];
+  using Scale_t = dtype[vocab_size];
+  using Offset_t = dtype[vocab_size];
+
+  QEmbedding() = default;
+  ~QEmbedding() = default;
+
+  // Host-side: quantizes a dense float [vocab_size][embed_size] table.
+  static void quantize(Weight_t weight, Scale_t scale, Offset_t offset,
+                       const float *table) {
+    for (int v = 0; v < vocab_size; v++) {
+      float s, o;
+      quant::quantize_row(weight[v], s, o, &table[v * embed_size],
+                          embed_size);
+      scale[v] = s;
+      offset[v] = o;
+    }
+  }
+
+  static void emb(dtype output[embed_size], const int input,
+                  const Weight_t weight, const Scale_t scale,
+                  const Offset_t offset) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+    emb_single(output, input, weight, scale, offset);
+  }
+
+  static void emb(dtype output[][embed_size], const int input[],
+                  const int batch_size, const Weight_t weight,
+                  const Scale_t scale, const Offset_t offset) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+  BATCH_LOOP:
+    for (int i = 0; i < batch_size; i++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_FLATTEN off
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 32
+#endif
+      emb_single(output[i], input[i], weight, scale, offset);
+    }
+  }
+
+  static void emb(dtype *output, const int *input, const int length,
+                  const Weight_t weight, const Scale_t scale,
+                  const Offset_t offset) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+  LENGTH_LOOP:
+    for (int i = 0; i < length; i++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 512
+#endif
+      emb_single(&output[i * embed_size], input[i], weight, scale, offset);
+    }
+  }
+
+#ifdef __VITIS_HLS__
+  static void emb(hls::stream<dtype> &output, hls::stream<int> &input,
+                  const int length, const Weight_t weight,
+                  const Scale_t scale, const Offset_t offset) {
+#pragma HLS INLINE off
+  LENGTH_LOOP:
+    for (int i = 0; i < length; i++) {
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 512
+      int idx = input.read();
+    OUT_LOOP:
+      for (int j = 0; j < embed_size; j++) {
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 1024
+        output.write(dtype(quant::code(weight[idx], j)) * scale[idx] +
+                     offset[idx]);
+      }
+    }
+  }
+#endif
+
+private:
+  static void emb_single(dtype output[embed_size], const int input,
+                         const Weight_t weight, const Scale_t scale,
+                         const Offset_t offset) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+  OUT_LOOP:
+    for (int j = 0; j < embed_size; j++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 1024
+#endif
+      output[j] =
+          dtype(quant::code(weight[input], j)) * scale[input] + offset[input];
+    }
+  }
+};
+
+template <int PIPELINE_II, int UNROLL_FACTOR, int PARTITION_FACTOR>
+struct QEmbeddingConfig {
+  static constexpr int pipeline_ii = PIPELINE_II;
+  static constexpr int unroll_factor = UNROLL_FACTOR;
+  static constexpr int partition_factor = PARTITION_FACTOR;
+};
+
+// ============================================================================
+// Optimized version (OPT_ENABLED)
+// ============================================================================
+// Walks the row a byte at a time: the row's scale / offset are loaded once
+// and every byte read yields 8 / BITS outputs, so the memory port moves
+// packed codes instead of dtype values.
+template <typename DType, typename HParams, typename Config>
+class QEmbedding<DType, HParams, Config, OPT_ENABLED> {
+public:
+  using dtype = DType;
+  static constexpr int vocab_size = HParams::vocab_size;
+  static constexpr int embed_size = HParams::embed_size;
+  static constexpr int bits = HParams::bits;
+  static constexpr int row_bytes = HParams::row_bytes;
+  static constexpr OptLevel opt_level = OPT_ENABLED;
+
+  static constexpr int pipeline_ii = Config::pipeline_ii;
+  static constexpr int unroll_factor = Config::unroll_factor;
+  static constexpr int partition_factor = Config::partition_factor;
+
+  using quant = RowwiseQuant<bits>;
+  static constexpr int per_byte = quant::per_byte;
+  using Weight_t = quint8_t[vocab_size][row_bytes];
+  using Scale_t = dtype[vocab_size];
+  using Offset_t = dtype[vocab_size];
+
+  QEmbedding() = default;
+  ~QEmbedding() = default;
+
+  static void quantize(Weight_t weight, Scale_t scale, Offset_t offset,
+                       const float *table) {
+    QEmbedding<DType, HParams, void, OPT_NONE>::quantize(weight, scale, offset,
+                                                         table);
+  }
+
+  static void emb(dtype output[embed_size], const int input,
+                  const Weight_t weight, const Scale_t scale,
+                  const Offset_t offset) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+    emb_row(output, weight[input], scale[input], offset[input]);
+  }
+
+  static void emb(dtype output[][embed_size], const int input[],
+                  const int batch_size, const Weight_t weight,
+                  const Scale_t scale, const Offset_t offset) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+  BATCH_LOOP:
+    for (int i = 0; i < batch_size; i++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_FLATTEN off
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 32
+#endif
+      const int idx = input[i];
+      emb_row(output[i], weight[idx], scale[idx], offset[idx]);
+    }
+  }
+
+  static void emb(dtype *output, const int *input, const int length,
+                  const Weight_t weight, const Scale_t scale,
+                  const Offset_t offset) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+  LENGTH_LOOP:
+    for (int i = 0; i < length; i++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 512
+#endif
+      const int idx = input[i];
+      emb_row(&output[i * embed_size], weight[idx], scale[idx], offset[idx]);
+    }
+  }
+
+#ifdef __VITIS_HLS__
+  static void emb(hls::stream<dtype> &output, hls::stream<int> &input,
+                  const int length, const Weight_t weight,
+                  const Scale_t scale, const Offset_t offset) {
+#pragma HLS INLINE off
+  LENGTH_LOOP:
+    for (int i = 0; i < length; i++) {
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 512
+      const int idx = input.read();
+      const dtype s = scale[idx];
+      const dtype o = offset[idx];
+    BYTE_LOOP:
+      for (int b = 0; b < row_bytes; b++) {
+#pragma HLS PIPELINE II = pipeline_ii
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 2048
+        const quint8_t byte = weight[idx][b];
+      NIBBLE_LOOP:
+        for (int p = 0; p < per_byte; p++) {
+#pragma HLS UNROLL
+          if (b * per_byte + p < embed_size) {
+            output.write(dtype(quant::code(&byte, p)) * s + o);
+          }
+        }
+      }
+    }
+  }
+#endif
+
+private:
+  static void emb_row(dtype *output, const quint8_t row[row_bytes],
+                      const dtype scale, const dtype offset) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+    if constexpr (partition_factor > 1 && row_bytes <= 2048) {
+#pragma HLS ARRAY_PARTITION variable = row type = cyclic factor =              \
+    partition_factor
+    }
+#endif
+  BYTE_LOOP:
+    for (int b = 0; b < row_bytes; b++) {
+#ifdef __VITIS_HLS__
+#pragma HLS PIPELINE II = pipeline_ii
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 2048
+      if constexpr (unroll_factor > 1) {
+#pragma HLS UNROLL factor = unroll_factor
+      }
+#endif
+      const quint8_t byte = row[b];
+    NIBBLE_LOOP:
+      for (int p = 0; p < per_byte; p++) {
+#ifdef __VITIS_HLS__
+#pragma HLS UNROLL
+#endif
+        const int j = b * per_byte + p;
+        if (j < embed_size) {
+          output[j] = dtype(quant::code(&byte, p)) * scale + offset;
+        }
+      }
+    }
+  }
+};
+
+} // namespace vhn
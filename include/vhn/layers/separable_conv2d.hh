@@ -0,0 +1,263 @@
+#pragma once
+
+#include "../opt_level.hh"
+#include "./conv2d.hh"
+
+namespace vhn {
+
+template <typename DType, typename HParams, typename Config = void,
+          OptLevel OPT_LEVEL = OPT_NONE>
+class SeparableConv2d;
+
+// Depthwise k x k convolution (one filter per input channel) followed by a
+// pointwise 1 x 1 convolution.
+template <int IN_CHANNELS, int OUT_CHANNELS, int KERNEL_SIZE, int PADDING,
+          int WIDTH, int HEIGHT, int STRIDE = 1, int DILATION = 1>
+struct SeparableConv2dHParams {
+  using depthwise_hparams =
+      Conv2dHParams<IN_CHANNELS, IN_CHANNELS, KERNEL_SIZE, PADDING, WIDTH,
+                    HEIGHT, STRIDE, DILATION, IN_CHANNELS>;
+  using pointwise_hparams =
+      Conv2dHParams<IN_CHANNELS, OUT_CHANNELS, 1, 0,
+                    depthwise_hparams::out_width,
+                    depthwise_hparams::out_height>;
+
+  static constexpr int in_channels = IN_CHANNELS;
+  static constexpr int out_channels = OUT_CHANNELS;
+  static constexpr int kernel_size = KERNEL_SIZE;
+  static constexpr int padding = PADDING;
+  static constexpr int width = WIDTH;
+  static constexpr int height = HEIGHT;
+  static constexpr int stride = STRIDE;
+  static constexpr int dilation = DILATION;
+  static constexpr int out_width = depthwise_hparams::out_width;
+  static constexpr int out_height = depthwise_hparams::out_height;
+};
+
+// ============================================================================
+// Non-optimized version (OPT_NONE)
+// ============================================================================
+template <typename DType, typename HParams>
+class SeparableConv2d<DType, HParams, void, OPT_NONE> {
+public:
+  using dtype = DType;
+  static constexpr int in_channels = HParams::in_channels;
+  static constexpr int out_channels = HParams::out_channels;
+  static constexpr int kernel_size = HParams::kernel_size;
+  static constexpr int width = HParams::width;
+  static constexpr int height = HParams::height;
+  static constexpr int out_width = HParams::out_width;
+  static constexpr int out_height = HParams::out_height;
+  static constexpr OptLevel opt_level = OPT_NONE;
+
+  using depthwise =
+      Conv2d<DType, typename HParams::depthwise_hparams, void, OPT_NONE>;
+  using pointwise =
+      Conv2d<DType, typename HParams::pointwise_hparams, void, OPT_NONE>;
+
+  using DWWeight_t = typename depthwise::Weight_t;
+  using DWBias_t = typename depthwise::Bias_t;
+  using PWWeight_t = typename pointwise::Weight_t;
+  using PWBias_t = typename pointwise::Bias_t;
+  using Input_t = dtype[in_channels][width][height];
+  using Output_t = dtype[out_channels][out_width][out_height];
+
+  SeparableConv2d() = default;
+  ~SeparableConv2d() = default;
+
+  static void sepconv2d(Output_t output, const Input_t input,
+                        const DWWeight_t dw_weight, const DWBias_t dw_bias,
+                        const PWWeight_t pw_weight, const PWBias_t pw_bias) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+    sepconv2d_3d_impl(output, input, dw_weight, dw_bias, pw_weight, pw_bias);
+  }
+
+  static void sepconv2d(dtype output[][out_channels][out_width][out_height],
+                        const dtype input[][in_channels][width][height],
+                        const int batch_size, const DWWeight_t dw_weight,
+                        const DWBias_t dw_bias, const PWWeight_t pw_weight,
+                        const PWBias_t pw_bias) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 32
+#endif
+  BATCH_LOOP:
+    for (int b = 0; b < batch_size; b++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_FLATTEN off
+#endif
+      sepconv2d_3d_impl(output[b], input[b], dw_weight, dw_bias, pw_weight,
+                        pw_bias);
+    }
+  }
+
+private:
+  static void
+  sepconv2d_3d_impl(dtype output[out_channels][out_width][out_height],
+                    const dtype input[in_channels][width][height],
+                    const DWWeight_t dw_weight, const DWBias_t dw_bias,
+                    const PWWeight_t pw_weight, const PWBias_t pw_bias) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+    typename depthwise::Output_t dw_output;
+    depthwise::conv2d(dw_output, input, dw_weight, dw_bias);
+    pointwise::conv2d(output, dw_output, pw_weight, pw_bias);
+  }
+};
+
+template <int PIPELINE_II, int UNROLL_FACTOR, int PARTITION_FACTOR>
+struct SeparableConv2dConfig {
+  static constexpr int pipeline_ii = PIPELINE_II;
+  static constexpr int unroll_factor = UNROLL_FACTOR;
+  static constexpr int partition_factor = PARTITION_FACTOR;
+};
+
+// ============================================================================
+// Optimized version (OPT_ENABLED)
+// ============================================================================
+// Depthwise and pointwise stages are fused per output pixel: the in_channels
+// depthwise results live in registers and are consumed by the 1 x 1 stage
+// immediately, so the intermediate feature map is never materialised.
+template <typename DType, typename HParams, typename Config>
+class SeparableConv2d<DType, HParams, Config, OPT_ENABLED> {
+public:
+  using dtype = DType;
+  static constexpr int in_channels = HParams::in_channels;
+  static constexpr int out_channels = HParams::out_channels;
+  static constexpr int kernel_size = HParams::kernel_size;
+  static constexpr int padding = HParams::padding;
+  static constexpr int width = HParams::width;
+  static constexpr int height = HParams::height;
+  static constexpr int stride = HParams::stride;
+  static constexpr int dilation = HParams::dilation;
+  static constexpr int out_width = HParams::out_width;
+  static constexpr int out_height = HParams::out_height;
+  static constexpr OptLevel opt_level = OPT_ENABLED;
+
+  static constexpr int pipeline_ii = Config::pipeline_ii;
+  static constexpr int unroll_factor = Config::unroll_factor;
+  static constexpr int partition_factor = Config::partition_factor;
+
+  using depthwise =
+      Conv2d<DType, typename HParams::depthwise_hparams, void, OPT_NONE>;
+  using pointwise =
+      Conv2d<DType, typename HParams::pointwise_hparams, void, OPT_NONE>;
+
+  using DWWeight_t = typename depthwise::Weight_t;
+  using DWBias_t = typename depthwise::Bias_t;
+  using PWWeight_t = typename pointwise::Weight_t;
+  using PWBias_t = typename pointwise::Bias_t;
+  using Input_t = dtype[in_channels][width][height];
+  using Output_t = dtype[out_channels][out_width][out_height];
+
+  SeparableConv2d() = default;
+  ~SeparableConv2d() = default;
+
+  static void sepconv2d(Output_t output, const Input_t input,
+                        const DWWeight_t dw_weight, const DWBias_t dw_bias,
+                        const PWWeight_t pw_weight, const PWBias_t pw_bias) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+    sepconv2d_3d_impl(output, input, dw_weight, dw_bias, pw_weight, pw_bias);
+  }
+
+  static void sepconv2d(dtype output[][out_channels][out_width][out_height],
+                        const dtype input[][in_channels][width][height],
+                        const int batch_size, const DWWeight_t dw_weight,
+                        const DWBias_t dw_bias, const PWWeight_t pw_weight,
+                        const PWBias_t pw_bias) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 32
+#endif
+  BATCH_LOOP:
+    for (int b = 0; b < batch_size; b++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_FLATTEN off
+#endif
+      sepconv2d_3d_impl(output[b], input[b], dw_weight, dw_bias, pw_weight,
+                        pw_bias);
+    }
+  }
+
+private:
+  static void
+  sepconv2d_3d_impl(dtype output[out_channels][out_width][out_height],
+                    const dtype input[in_channels][width][height],
+                    const DWWeight_t dw_weight, const DWBias_t dw_bias,
+                    const PWWeight_t pw_weight, const PWBias_t pw_bias) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+    if constexpr (partition_factor > 1 && in_channels <= 512) {
+#pragma HLS ARRAY_PARTITION variable = pw_weight type = cyclic factor =        \
+    partition_factor dim = 2
+    }
+#pragma HLS ARRAY_PARTITION variable = dw_weight type = complete dim = 3
+#pragma HLS ARRAY_PARTITION variable = dw_weight type = complete dim = 4
+#endif
+
+  OUT_POS_Y_LOOP:
+    for (int pos_y = 0; pos_y < out_width; pos_y++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 512
+#endif
+    OUT_POS_X_LOOP:
+      for (int pos_x = 0; pos_x < out_height; pos_x++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 512
+#endif
+        dtype dw[in_channels];
+#ifdef __VITIS_HLS__
+        if constexpr (partition_factor > 1 && in_channels <= 512) {
+#pragma HLS ARRAY_PARTITION variable = dw type = cyclic factor =               \
+    partition_factor
+        }
+#endif
+
+      DEPTHWISE_LOOP:
+        for (int ic = 0; ic < in_channels; ic++) {
+#ifdef __VITIS_HLS__
+#pragma HLS PIPELINE II = pipeline_ii
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 1024
+#endif
+          dtype acc = dw_bias[ic];
+          for (int ky = 0; ky < kernel_size; ky++) {
+            for (int kx = 0; kx < kernel_size; kx++) {
+              int in_pos_y = pos_y * stride + ky * dilation - padding;
+              int in_pos_x = pos_x * stride + kx * dilation - padding;
+              if (in_pos_y >= 0 && in_pos_y < width && in_pos_x >= 0 &&
+                  in_pos_x < height) {
+                acc += input[ic][in_pos_y][in_pos_x] * dw_weight[ic][0][ky][kx];
+              }
+            }
+          }
+          dw[ic] = acc;
+        }
+
+      POINTWISE_LOOP:
+        for (int oc = 0; oc < out_channels; oc++) {
+#ifdef __VITIS_HLS__
+#pragma HLS PIPELINE II = pipeline_ii
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 1024
+#endif
+          dtype acc = pw_bias[oc];
+          for (int ic = 0; ic < in_channels; ic++) {
+#ifdef __VITIS_HLS__
+            if constexpr (unroll_factor > 1) {
+#pragma HLS UNROLL factor = unroll_factor
+            }
+#endif
+            acc += dw[ic] * pw_weight[oc][ic][0][0];
+          }
+          output[oc][pos_y][pos_x] = acc;
+        }
+      }
+    }
+  }
+};
+
+} // namespace vhn
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "../operators/multi_reduce.hh"
 #include "../opt_level.hh"
 #include <cmath>
 
@@ -234,81 +235,34 @@ public:
 #endif
 
 private:
+  // Online softmax: one sweep yields the row maximum and the sum of
+  // exp(x - max) (MaxSumExpImpl), and a second sweep writes the normalized
+  // outputs, instead of separate max, exp-sum and normalize passes.
+  using stats_impl = MaxSumExpImpl<dtype, n>;
+  using stats_reduce =
+      MultiReduce<dtype, ReduceHParams<stats_impl, n>, Config, OPT_ENABLED>;
+
   static void sm_1d_impl(dtype *output, const dtype *input) {
 #ifdef __VITIS_HLS__
 #pragma HLS INLINE off
-#pragma HLS ALLOCATION operation instances = fadd limit = 1
-#pragma HLS ALLOCATION operation instances = fmul limit = 1
 #pragma HLS ALLOCATION operation instances = fdiv limit = 1
 #endif
-
-    constexpr bool use_partition = (n <= 64) && (partition_factor > 1);
-
-    dtype max_val;
-
-#ifdef __VITIS_HLS__
-    if constexpr (use_partition) {
-      dtype max_buffer[n];
-#pragma HLS ARRAY_PARTITION variable = max_buffer cyclic factor =              \
-    partition_factor
-
-      for (int i = 0; i < n; i++) {
-#pragma HLS UNROLL factor = unroll_factor
-        max_buffer[i] = input[i];
-      }
-
-      max_val = max_buffer[0];
-      for (int i = 1; i < n; i++) {
-#pragma HLS UNROLL factor = unroll_factor
-        if (max_buffer[i] > max_val)
-          max_val = max_buffer[i];
-      }
-    } else {
-#endif
-      max_val = input[0];
-    FIND_MAX:
-      for (int i = 1; i < n; i++) {
-#ifdef __VITIS_HLS__
-#pragma HLS LOOP_TRIPCOUNT min = 1 max = 256
-#pragma HLS PIPELINE II = 1
-#endif
-        if (input[i] > max_val)
-          max_val = input[i];
-      }
-#ifdef __VITIS_HLS__
-    }
-#endif
-
-    dtype sum = dtype(0.0f);
-
-  CALC_EXP:
-    for (int i = 0; i < n; i++) {
-#ifdef __VITIS_HLS__
-#pragma HLS LOOP_TRIPCOUNT min = 1 max = 256
-#pragma HLS PIPELINE II = 4
-#pragma HLS BIND_OP variable = sum op = fadd impl = fabric latency = 4
-      dtype exp_val = hls::exp(input[i] - max_val);
-#else
-      dtype exp_val = std::exp(input[i] - max_val);
-#endif
-      output[i] = exp_val;
-      sum += exp_val;
-    }
+    const MaxSumExp<dtype> stats = stats_reduce::reduce(input);
 
     dtype inv_sum;
 #ifdef __VITIS_HLS__
 #pragma HLS BIND_OP variable = inv_sum op = fdiv impl = fabric latency = 16
 #endif
-    inv_sum = dtype(1.0) / sum;
+    inv_sum = dtype(1.0) / stats.sum;
 
   NORMALIZE:
     for (int i = 0; i < n; i++) {
 #ifdef __VITIS_HLS__
 #pragma HLS LOOP_TRIPCOUNT min = 1 max = 256
-#pragma HLS PIPELINE II = 2
+#pragma HLS PIPELINE II = pipeline_ii
 #pragma HLS BIND_OP variable = output op = fmul impl = dsp latency = 3
 #endif
-      output[i] = output[i] * inv_sum;
+      output[i] = stats_impl::exp(input[i] - stats.max) * inv_sum;
     }
   }
 
@@ -318,45 +272,29 @@ private:
 #pragma HLS INLINE off
 #pragma HLS PIPELINE off
 
-    dtype max_val = -1e9;
     dtype buffer[n];
-
 #pragma HLS ARRAY_PARTITION variable = buffer cyclic factor = partition_factor
 
-  READ_MAX_STREAM:
+    typename stats_impl::State state;
+  READ_STATS_STREAM:
     for (int i = 0; i < n; i++) {
 #pragma HLS LOOP_TRIPCOUNT min = 1 max = 256
-#pragma HLS PIPELINE II = 1
+#pragma HLS PIPELINE II = pipeline_ii
       dtype val = input_stream.read();
       buffer[i] = val;
-      if (val > max_val) {
-        max_val = val;
-      }
-    }
-
-    dtype sum = dtype(0.0f);
-
-  CALC_EXP_OPT_STREAM:
-    for (int i = 0; i < n; i++) {
-#pragma HLS LOOP_TRIPCOUNT min = 1 max = 256
-#pragma HLS PIPELINE II = pipeline_ii
-#pragma HLS BIND_OP variable = sum op = fadd impl = fabric latency = 4
-      dtype exp_val = hls::exp(buffer[i] - max_val);
-      buffer[i] = exp_val;
-      sum += exp_val;
+      stats_impl::update(state, val, i);
     }
+    const MaxSumExp<dtype> stats = stats_impl::finalize(state);
 
     dtype inv_sum;
 #pragma HLS BIND_OP variable = inv_sum op = fdiv impl = fabric latency = 16
-    inv_sum = dtype(1.0) / sum;
+    inv_sum = dtype(1.0) / stats.sum;
 
   NORMALIZE_OPT_STREAM:
     for (int i = 0; i < n; i++) {
 #pragma HLS LOOP_TRIPCOUNT min = 1 max = 256
-#pragma HLS PIPELINE II = 2
-#pragma HLS BIND_OP variable = output_stream op = write
-      dtype normalized = buffer[i] * inv_sum;
-      output_stream.write(normalized);
+#pragma HLS PIPELINE II = pipeline_ii
+      output_stream.write(hls::exp(buffer[i] - stats.max) * inv_sum);
     }
   }
 #endif
@@ -0,0 +1,517 @@
+#pragma once
+
+#include "../opt_level.hh"
+#include "./conv2d.hh"
+
+namespace vhn {
+
+enum UpsampleMode { UPSAMPLE_NEAREST, UPSAMPLE_BILINEAR };
+
+template <typename DType, typename HParams, typename Config = void,
+          OptLevel OPT_LEVEL = OPT_NONE>
+class UpsampleConv2d;
+
+// Integer-factor upsampling followed by a stride-1 Conv2d. CONV_HPARAMS
+// describes the convolution on the upsampled grid; the layer input is
+// SCALE times smaller along both spatial axes.
+template <typename CONV_HPARAMS, int SCALE,
+          UpsampleMode MODE = UPSAMPLE_NEAREST>
+struct UpsampleConv2dHParams {
+  using conv_hparams = CONV_HPARAMS;
+  static constexpr int scale = SCALE;
+  static constexpr UpsampleMode mode = MODE;
+
+  static constexpr int in_channels = CONV_HPARAMS::in_channels;
+  static constexpr int out_channels = CONV_HPARAMS::out_channels;
+  static constexpr int kernel_size = CONV_HPARAMS::kernel_size;
+  static constexpr int padding = CONV_HPARAMS::padding;
+  static constexpr int groups = CONV_HPARAMS::groups;
+  static constexpr int up_width = CONV_HPARAMS::width;
+  static constexpr int up_height = CONV_HPARAMS::height;
+  static constexpr int width = up_width / SCALE;
+  static constexpr int height = up_height / SCALE;
+  static constexpr int out_width = CONV_HPARAMS::out_width;
+  static constexpr int out_height = CONV_HPARAMS::out_height;
+
+  static_assert(SCALE >= 1, "UpsampleConv2d scale must be positive");
+  static_assert(up_width % SCALE == 0 && up_height % SCALE == 0,
+                "UpsampleConv2d conv width/height must be multiples of scale");
+  static_assert(CONV_HPARAMS::stride == 1 && CONV_HPARAMS::dilation == 1,
+                "UpsampleConv2d requires a stride-1, undilated Conv2d");
+};
+
+// Source coordinates shared by every UpsampleConv2d variant, so the fused
+// kernels sample exactly the values the reference upsample produces.
+// Bilinear follows align_corners = false: src = (dst + 0.5) / SCALE - 0.5,
+// clamped to the input.
+template <int SCALE> struct UpsampleCoord {
+  static void bilinear(const int dst, const int size, int &i0, int &i1,
+                       float &lambda) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE
+#endif
+    float src = (dst + 0.5f) / SCALE - 0.5f;
+    src = src < 0.0f ? 0.0f : src;
+    i0 = static_cast<int>(src);
+    i1 = i0 + 1 < size ? i0 + 1 : size - 1;
+    lambda = src - i0;
+  }
+
+  template <typename T>
+  static T lerp2(const T a00, const T a01, const T a10, const T a11,
+                 const float ly, const float lx) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE
+#endif
+    const T top = T(1.0f - lx) * a00 + T(lx) * a01;
+    const T bottom = T(1.0f - lx) * a10 + T(lx) * a11;
+    return T(1.0f - ly) * top + T(ly) * bottom;
+  }
+
+  // floor(t / SCALE) for possibly negative t.
+  static int floor_div(const int t) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE
+#endif
+    return (t >= 0 ? t : t - SCALE + 1) / SCALE;
+  }
+};
+
+// ============================================================================
+// Non-optimized version (OPT_NONE)
+// ============================================================================
+// Materialises the upsampled tensor and runs the reference Conv2d on it.
+template <typename DType, typename HParams>
+class UpsampleConv2d<DType, HParams, void, OPT_NONE> {
+public:
+  using dtype = DType;
+  static constexpr int in_channels = HParams::in_channels;
+  static constexpr int out_channels = HParams::out_channels;
+  static constexpr int scale = HParams::scale;
+  static constexpr UpsampleMode mode = HParams::mode;
+  static constexpr int width = HParams::width;
+  static constexpr int height = HParams::height;
+  static constexpr int up_width = HParams::up_width;
+  static constexpr int up_height = HParams::up_height;
+  static constexpr int out_width = HParams::out_width;
+  static constexpr int out_height = HParams::out_height;
+  static constexpr OptLevel opt_level = OPT_NONE;
+
+  using conv = Conv2d<DType, typename HParams::conv_hparams, void, OPT_NONE>;
+  using coord = UpsampleCoord<scale>;
+
+  using Weight_t = typename conv::Weight_t;
+  using Bias_t = typename conv::Bias_t;
+  using Input_t = dtype[in_channels][width][height];
+  using Upsampled_t = dtype[in_channels][up_width][up_height];
+  using Output_t = dtype[out_channels][out_width][out_height];
+
+  UpsampleConv2d() = default;
+  ~UpsampleConv2d() = default;
+
+  static void upsample_conv2d(Output_t output, const Input_t input,
+                              const Weight_t weight, const Bias_t bias) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+    upsample_conv2d_3d_impl(output, input, weight, bias);
+  }
+
+  static void
+  upsample_conv2d(dtype output[][out_channels][out_width][out_height],
+                  const dtype input[][in_channels][width][height],
+                  const int batch_size, const Weight_t weight,
+                  const Bias_t bias) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 32
+#endif
+  BATCH_LOOP:
+    for (int b = 0; b < batch_size; b++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_FLATTEN off
+#endif
+      upsample_conv2d_3d_impl(output[b], input[b], weight, bias);
+    }
+  }
+
+  static void upsample(Upsampled_t upsampled, const Input_t input) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+  UPSAMPLE_CHANNEL_LOOP:
+    for (int c = 0; c < in_channels; c++) {
+    UPSAMPLE_Y_LOOP:
+      for (int y = 0; y < up_width; y++) {
+      UPSAMPLE_X_LOOP:
+        for (int x = 0; x < up_height; x++) {
+          if constexpr (mode == UPSAMPLE_NEAREST) {
+            upsampled[c][y][x] = input[c][y / scale][x / scale];
+          } else {
+            int y0, y1, x0, x1;
+            float ly, lx;
+            coord::bilinear(y, width, y0, y1, ly);
+            coord::bilinear(x, height, x0, x1, lx);
+            upsampled[c][y][x] =
+                coord::lerp2(input[c][y0][x0], input[c][y0][x1],
+                             input[c][y1][x0], input[c][y1][x1], ly, lx);
+          }
+        }
+      }
+    }
+  }
+
+private:
+  static void
+  upsample_conv2d_3d_impl(dtype output[out_channels][out_width][out_height],
+                          const dtype input[in_channels][width][height],
+                          const Weight_t weight, const Bias_t bias) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+    static Upsampled_t upsampled;
+    upsample(upsampled, input);
+    conv::conv2d(output, upsampled, weight, bias);
+  }
+};
+
+template <int PIPELINE_II, int UNROLL_FACTOR, int PARTITION_FACTOR>
+struct UpsampleConv2dConfig {
+  static constexpr int pipeline_ii = PIPELINE_II;
+  static constexpr int unroll_factor = UNROLL_FACTOR;
+  static constexpr int partition_factor = PARTITION_FACTOR;
+};
+
+// ============================================================================
+// Optimized version (OPT_ENABLED)
+// ============================================================================
+// The upsampled tensor is never stored.
+//
+// Nearest: every output pixel whose offset inside a SCALE x SCALE cell is
+// (ry, rx) sees the same pattern of repeated input pixels, so the K x K
+// kernel collapses into a TAPS x TAPS kernel per phase, TAPS =
+// (SCALE + K - 2) / SCALE + 1 (2 x 2 instead of 3 x 3 for K = 3, SCALE = 2).
+// transform_weight builds these phase kernels once.
+//
+// Bilinear: a K-row ring of upsampled rows is filled one row per output row,
+// so each upsampled value is interpolated once and the conv reads it from
+// on-chip memory.
+template <typename DType, typename HParams, typename Config>
+class UpsampleConv2d<DType, HParams, Config, OPT_ENABLED> {
+public:
+  using dtype = DType;
+  static constexpr int in_channels = HParams::in_channels;
+  static constexpr int out_channels = HParams::out_channels;
+  static constexpr int kernel_size = HParams::kernel_size;
+  static constexpr int padding = HParams::padding;
+  static constexpr int groups = HParams::groups;
+  static constexpr int scale = HParams::scale;
+  static constexpr UpsampleMode mode = HParams::mode;
+  static constexpr int width = HParams::width;
+  static constexpr int height = HParams::height;
+  static constexpr int up_width = HParams::up_width;
+  static constexpr int up_height = HParams::up_height;
+  static constexpr int out_width = HParams::out_width;
+  static constexpr int out_height = HParams::out_height;
+  static constexpr int in_channels_per_group = in_channels / groups;
+  static constexpr int out_channels_per_group = out_channels / groups;
+  static constexpr int taps = (scale + kernel_size - 2) / scale + 1;
+  static constexpr OptLevel opt_level = OPT_ENABLED;
+
+  static constexpr int pipeline_ii = Config::pipeline_ii;
+  static constexpr int unroll_factor = Config::unroll_factor;
+  static constexpr int partition_factor = Config::partition_factor;
+
+  using coord = UpsampleCoord<scale>;
+
+  using Weight_t =
+      dtype[out_channels][in_channels_per_group][kernel_size][kernel_size];
+  using TransformedWeight_t =
+      dtype[out_channels][in_channels_per_group][scale][scale][taps][taps];
+  using Bias_t = dtype[out_channels];
+  using Input_t = dtype[in_channels][width][height];
+  using Output_t = dtype[out_channels][out_width][out_height];
+
+  UpsampleConv2d() = default;
+  ~UpsampleConv2d() = default;
+
+  // Phase kernels of the nearest mode. Run once per weight set and feed the
+  // result to upsample_conv2d_transformed; the plain entry points redo it on
+  // every call.
+  static void transform_weight(TransformedWeight_t tweight,
+                               const Weight_t weight) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+    static_assert(mode == UPSAMPLE_NEAREST,
+                  "transform_weight requires UPSAMPLE_NEAREST");
+  TRANSFORM_OC_LOOP:
+    for (int oc = 0; oc < out_channels; oc++) {
+    TRANSFORM_IC_LOOP:
+      for (int icg = 0; icg < in_channels_per_group; icg++) {
+      TRANSFORM_PHASE_LOOP:
+        for (int ry = 0; ry < scale; ry++) {
+          for (int rx = 0; rx < scale; rx++) {
+            for (int dy = 0; dy < taps; dy++) {
+              for (int dx = 0; dx < taps; dx++) {
+                tweight[oc][icg][ry][rx][dy][dx] = dtype(0);
+              }
+            }
+          TRANSFORM_KERNEL_LOOP:
+            for (int ky = 0; ky < kernel_size; ky++) {
+              for (int kx = 0; kx < kernel_size; kx++) {
+                tweight[oc][icg][ry][rx][(ry + ky) / scale]
+                       [(rx + kx) / scale] += weight[oc][icg][ky][kx];
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+
+  static void upsample_conv2d_transformed(Output_t output, const Input_t input,
+                                          const TransformedWeight_t tweight,
+                                          const Bias_t bias) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+    static_assert(mode == UPSAMPLE_NEAREST,
+                  "upsample_conv2d_transformed requires UPSAMPLE_NEAREST");
+    nearest_3d_impl(output, input, tweight, bias);
+  }
+
+  static void upsample_conv2d(Output_t output, const Input_t input,
+                              const Weight_t weight, const Bias_t bias) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+    upsample_conv2d_3d_impl(output, input, weight, bias);
+  }
+
+  static void
+  upsample_conv2d(dtype output[][out_channels][out_width][out_height],
+                  const dtype input[][in_channels][width][height],
+                  const int batch_size, const Weight_t weight,
+                  const Bias_t bias) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 32
+#endif
+    if constexpr (mode == UPSAMPLE_NEAREST) {
+      static TransformedWeight_t tweight;
+      transform_weight(tweight, weight);
+    BATCH_LOOP:
+      for (int b = 0; b < batch_size; b++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_FLATTEN off
+#endif
+        nearest_3d_impl(output[b], input[b], tweight, bias);
+      }
+    } else {
+    BILINEAR_BATCH_LOOP:
+      for (int b = 0; b < batch_size; b++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_FLATTEN off
+#endif
+        bilinear_3d_impl(output[b], input[b], weight, bias);
+      }
+    }
+  }
+
+private:
+  static void
+  upsample_conv2d_3d_impl(dtype output[out_channels][out_width][out_height],
+                          const dtype input[in_channels][width][height],
+                          const Weight_t weight, const Bias_t bias) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE
+#endif
+    if constexpr (mode == UPSAMPLE_NEAREST) {
+      static TransformedWeight_t tweight;
+      transform_weight(tweight, weight);
+      nearest_3d_impl(output, input, tweight, bias);
+    } else {
+      bilinear_3d_impl(output, input, weight, bias);
+    }
+  }
+
+  static void
+  nearest_3d_impl(dtype output[out_channels][out_width][out_height],
+                  const dtype input[in_channels][width][height],
+                  const TransformedWeight_t tweight, const Bias_t bias) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+    if constexpr (partition_factor > 1 && in_channels <= 512) {
+#pragma HLS ARRAY_PARTITION variable = input type = cyclic factor =            \
+    partition_factor dim = 1
+    }
+#endif
+  OUT_CHANNEL_LOOP:
+    for (int oc = 0; oc < out_channels; oc++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 512
+#endif
+      const int group_base =
+          (oc / out_channels_per_group) * in_channels_per_group;
+
+    OUT_POS_Y_LOOP:
+      for (int pos_y = 0; pos_y < out_width; pos_y++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 512
+#endif
+        const int qy = coord::floor_div(pos_y - padding);
+        const int ry = pos_y - padding - qy * scale;
+
+      OUT_POS_X_LOOP:
+        for (int pos_x = 0; pos_x < out_height; pos_x++) {
+#ifdef __VITIS_HLS__
+#pragma HLS PIPELINE II = pipeline_ii
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 512
+#endif
+          const int qx = coord::floor_div(pos_x - padding);
+          const int rx = pos_x - padding - qx * scale;
+          dtype acc = bias[oc];
+
+        IN_CHANNEL_LOOP:
+          for (int icg = 0; icg < in_channels_per_group; icg++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 512
+            if constexpr (unroll_factor > 1) {
+#pragma HLS UNROLL factor = unroll_factor
+            }
+#endif
+          TAP_Y_LOOP:
+            for (int dy = 0; dy < taps; dy++) {
+              const int in_y = qy + dy;
+            TAP_X_LOOP:
+              for (int dx = 0; dx < taps; dx++) {
+                const int in_x = qx + dx;
+                if (in_y >= 0 && in_y < width && in_x >= 0 && in_x < height) {
+                  acc += input[group_base + icg][in_y][in_x] *
+                         tweight[oc][icg][ry][rx][dy][dx];
+                }
+              }
+            }
+          }
+          output[oc][pos_y][pos_x] = acc;
+        }
+      }
+    }
+  }
+
+  // Interpolates upsampled row `row` of every channel into band slot `slot`;
+  // rows outside the upsampled grid are the conv's zero padding.
+  static void fill_band_row(dtype band[in_channels][kernel_size][up_height],
+                            const dtype input[in_channels][width][height],
+                            const int slot, const int row,
+                            const int col_x0[up_height],
+                            const int col_x1[up_height],
+                            const float col_lx[up_height]) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE
+#endif
+    int y0 = 0, y1 = 0;
+    float ly = 0.0f;
+    const bool inside = row >= 0 && row < up_width;
+    if (inside) {
+      coord::bilinear(row, width, y0, y1, ly);
+    }
+  BAND_CHANNEL_LOOP:
+    for (int c = 0; c < in_channels; c++) {
+    BAND_X_LOOP:
+      for (int x = 0; x < up_height; x++) {
+#ifdef __VITIS_HLS__
+#pragma HLS PIPELINE II = 1
+#endif
+        band[c][slot][x] =
+            inside ? coord::lerp2(input[c][y0][col_x0[x]],
+                                  input[c][y0][col_x1[x]],
+                                  input[c][y1][col_x0[x]],
+                                  input[c][y1][col_x1[x]], ly, col_lx[x])
+                   : dtype(0);
+      }
+    }
+  }
+
+  static void
+  bilinear_3d_impl(dtype output[out_channels][out_width][out_height],
+                   const dtype input[in_channels][width][height],
+                   const Weight_t weight, const Bias_t bias) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+    dtype band[in_channels][kernel_size][up_height];
+    int col_x0[up_height], col_x1[up_height];
+    float col_lx[up_height];
+#ifdef __VITIS_HLS__
+#pragma HLS ARRAY_PARTITION variable = band type = complete dim = 2
+#endif
+
+  COLUMN_COORD_LOOP:
+    for (int x = 0; x < up_height; x++) {
+      coord::bilinear(x, height, col_x0[x], col_x1[x], col_lx[x]);
+    }
+
+  BAND_PRIME_LOOP:
+    for (int k = 0; k < kernel_size - 1; k++) {
+      const int row = k - padding;
+      fill_band_row(band, input,
+                    (row % kernel_size + kernel_size) % kernel_size, row,
+                    col_x0, col_x1, col_lx);
+    }
+
+  OUT_POS_Y_LOOP:
+    for (int pos_y = 0; pos_y < out_width; pos_y++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 512
+#endif
+      const int new_row = pos_y - padding + kernel_size - 1;
+      fill_band_row(band, input,
+                    (new_row % kernel_size + kernel_size) % kernel_size,
+                    new_row, col_x0, col_x1, col_lx);
+
+    OUT_CHANNEL_LOOP:
+      for (int oc = 0; oc < out_channels; oc++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 512
+#endif
+        const int group_base =
+            (oc / out_channels_per_group) * in_channels_per_group;
+
+      OUT_POS_X_LOOP:
+        for (int pos_x = 0; pos_x < out_height; pos_x++) {
+#ifdef __VITIS_HLS__
+#pragma HLS PIPELINE II = pipeline_ii
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 512
+#endif
+          dtype acc = bias[oc];
+        IN_CHANNEL_LOOP:
+          for (int icg = 0; icg < in_channels_per_group; icg++) {
+#ifdef __VITIS_HLS__
+            if constexpr (unroll_factor > 1) {
+#pragma HLS UNROLL factor = unroll_factor
+            }
+#endif
+          KERNEL_Y_LOOP:
+            for (int ky = 0; ky < kernel_size; ky++) {
+              const int row = pos_y - padding + ky;
+              const int slot = (row % kernel_size + kernel_size) % kernel_size;
+            KERNEL_X_LOOP:
+              for (int kx = 0; kx < kernel_size; kx++) {
+                const int in_x = pos_x - padding + kx;
+                if (in_x >= 0 && in_x < up_height) {
+                  acc += band[group_base + icg][slot][in_x] *
+                         weight[oc][icg][ky][kx];
+                }
+              }
+            }
+          }
+          output[oc][pos_y][pos_x] = acc;
+        }
+      }
+    }
+  }
+};
+
+} // namespace vhn
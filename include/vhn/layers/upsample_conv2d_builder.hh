@@ -0,0 +1,87 @@
+#pragma once
+
+#ifndef __VITIS_HLS__
+#include "../builder/builder.hh"
+#include "./conv2d_builder.hh"
+#include <sstream>
+
+namespace vhn {
+
+// hparams are those of Conv2d with "width" / "height" giving the layer input
+// (before upsampling), plus "scale" (default 2) and "mode" ("nearest" or
+// "bilinear", default "nearest").
+class UpsampleConv2dBuilder : public BaseBuilder {
+public:
+  std::string generate_hparams(const std::string &name,
+                               const std::string &dtype,
+                               const json &hparams) const override {
+    std::ostringstream oss;
+
+    NECESSARY_HPARAMS("UpsampleConv2d", name, "width")
+    NECESSARY_HPARAMS("UpsampleConv2d", name, "height")
+
+    auto scale = hparams.value("scale", 2);
+    auto mode = hparams.value("mode", std::string("nearest"));
+    std::string mode_enum;
+    if (mode == "nearest") {
+      mode_enum = "vhn::UPSAMPLE_NEAREST";
+    } else if (mode == "bilinear") {
+      mode_enum = "vhn::UPSAMPLE_BILINEAR";
+    } else {
+      throw std::runtime_error("Unsupported UpsampleConv2d mode: " + mode);
+    }
+
+    json conv_hparams = hparams;
+    conv_hparams["width"] = hparams["width"].get<int>() * scale;
+    conv_hparams["height"] = hparams["height"].get<int>() * scale;
+
+    Conv2dBuilder conv_builder;
+    oss << conv_builder.generate_hparams(name + "_conv", dtype, conv_hparams);
+
+    oss << "using " << name << "_hparams = vhn::UpsampleConv2dHParams<";
+    oss << name << "_conv_hparams, " << scale << ", " << mode_enum;
+    oss << ">;\n\n";
+
+    return oss.str();
+  }
+
+  std::string generate_config(const std::string &name,
+                              const json &hls_cfg) const override {
+    if (hls_cfg.empty() || hls_cfg.is_null()) {
+      return "";
+    }
+
+    std::ostringstream oss;
+
+    auto pipeline_ii = hls_cfg.value("pipeline_ii", 1);
+    auto unroll_factor = hls_cfg.value("unroll_factor", 1);
+    auto partition_factor = hls_cfg.value("partition_factor", 4);
+
+    oss << "using " << name << "_cfg = vhn::UpsampleConv2dConfig<";
+    oss << pipeline_ii << ", " << unroll_factor << ", " << partition_factor;
+    oss << ">;\n\n";
+
+    return oss.str();
+  }
+
+  std::string generate_type_alias(const std::string &name,
+                                  const std::string &dtype,
+                                  const json &hls_cfg) const override {
+    std::ostringstream oss;
+
+    std::string opt_level = "OPT_NONE";
+
+    if (!hls_cfg.empty() && !hls_cfg.is_null()) {
+      opt_level = "OPT_ENABLED";
+    }
+
+    std::string config_type =
+        (opt_level == "OPT_NONE") ? "void" : (name + "_cfg");
+
+    GENERATE_TYPE_ALIAS(oss, "UpsampleConv2d", name, dtype, opt_level)
+    return oss.str();
+  }
+};
+
+} // namespace vhn
+#endif
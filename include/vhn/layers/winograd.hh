@@ -0,0 +1,198 @@
+#pragma once
+
+namespace vhn {
+
+// ============================================================================
+// Winograd F(m x m, 3 x 3) transforms
+// ============================================================================
+// A 3x3 correlation over an alpha x alpha input tile (alpha = m + 2) is
+//
+//   Y = A^T [ (G g G^T) .* (B^T d B) ] A
+//
+// which needs alpha^2 multiplies per tile instead of 9 m^2. Matrices follow
+// Lavin & Gray, "Fast Algorithms for Convolutional Neural Networks".
+template <typename DType, int M> struct Winograd;
+
+template <typename DType> struct Winograd<DType, 2> {
+  using dtype = DType;
+  static constexpr int m = 2;
+  static constexpr int r = 3;
+  static constexpr int alpha = m + r - 1;
+
+  static constexpr float BT[alpha][alpha] = {
+      {1.0f, 0.0f, -1.0f, 0.0f},
+      {0.0f, 1.0f, 1.0f, 0.0f},
+      {0.0f, -1.0f, 1.0f, 0.0f},
+      {0.0f, 1.0f, 0.0f, -1.0f},
+  };
+
+  static constexpr float G[alpha][r] = {
+      {1.0f, 0.0f, 0.0f},
+      {0.5f, 0.5f, 0.5f},
+      {0.5f, -0.5f, 0.5f},
+      {0.0f, 0.0f, 1.0f},
+  };
+
+  static constexpr float AT[m][alpha] = {
+      {1.0f, 1.0f, 1.0f, 0.0f},
+      {0.0f, 1.0f, -1.0f, -1.0f},
+  };
+};
+
+template <typename DType> struct Winograd<DType, 4> {
+  using dtype = DType;
+  static constexpr int m = 4;
+  static constexpr int r = 3;
+  static constexpr int alpha = m + r - 1;
+
+  static constexpr float BT[alpha][alpha] = {
+      {4.0f, 0.0f, -5.0f, 0.0f, 1.0f, 0.0f},
+      {0.0f, -4.0f, -4.0f, 1.0f, 1.0f, 0.0f},
+      {0.0f, 4.0f, -4.0f, -1.0f, 1.0f, 0.0f},
+      {0.0f, -2.0f, -1.0f, 2.0f, 1.0f, 0.0f},
+      {0.0f, 2.0f, -1.0f, -2.0f, 1.0f, 0.0f},
+      {0.0f, 4.0f, 0.0f, -5.0f, 0.0f, 1.0f},
+  };
+
+  static constexpr float G[alpha][r] = {
+      {1.0f / 4, 0.0f, 0.0f},
+      {-1.0f / 6, -1.0f / 6, -1.0f / 6},
+      {-1.0f / 6, 1.0f / 6, -1.0f / 6},
+      {1.0f / 24, 1.0f / 12, 1.0f / 6},
+      {1.0f / 24, -1.0f / 12, 1.0f / 6},
+      {0.0f, 0.0f, 1.0f},
+  };
+
+  static constexpr float AT[m][alpha] = {
+      {1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 0.0f},
+      {0.0f, 1.0f, -1.0f, 2.0f, -2.0f, 0.0f},
+      {0.0f, 1.0f, 1.0f, 4.0f, 4.0f, 0.0f},
+      {0.0f, 1.0f, -1.0f, 8.0f, -8.0f, 1.0f},
+  };
+};
+
+template <typename DType, int M> struct WinogradTransform {
+  using dtype = DType;
+  using mat = Winograd<DType, M>;
+  static constexpr int m = mat::m;
+  static constexpr int r = mat::r;
+  static constexpr int alpha = mat::alpha;
+
+  // U = G g G^T
+  static void filter(dtype u[alpha][alpha], const dtype g[r][r]) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE
+#endif
+    dtype tmp[alpha][r];
+
+  FILTER_LEFT:
+    for (int i = 0; i < alpha; i++) {
+      for (int j = 0; j < r; j++) {
+#ifdef __VITIS_HLS__
+#pragma HLS UNROLL
+#endif
+        dtype acc = dtype(0);
+        for (int k = 0; k < r; k++) {
+          acc += dtype(mat::G[i][k]) * g[k][j];
+        }
+        tmp[i][j] = acc;
+      }
+    }
+
+  FILTER_RIGHT:
+    for (int i = 0; i < alpha; i++) {
+      for (int j = 0; j < alpha; j++) {
+#ifdef __VITIS_HLS__
+#pragma HLS UNROLL
+#endif
+        dtype acc = dtype(0);
+        for (int k = 0; k < r; k++) {
+          acc += tmp[i][k] * dtype(mat::G[j][k]);
+        }
+        u[i][j] = acc;
+      }
+    }
+  }
+
+  // V = B^T d B
+  static void input(dtype v[alpha][alpha], const dtype d[alpha][alpha]) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE
+#endif
+    dtype tmp[alpha][alpha];
+
+  INPUT_LEFT:
+    for (int i = 0; i < alpha; i++) {
+      for (int j = 0; j < alpha; j++) {
+#ifdef __VITIS_HLS__
+#pragma HLS UNROLL
+#endif
+        dtype acc = dtype(0);
+        for (int k = 0; k < alpha; k++) {
+          if (mat::BT[i][k] != 0.0f) {
+            acc += dtype(mat::BT[i][k]) * d[k][j];
+          }
+        }
+        tmp[i][j] = acc;
+      }
+    }
+
+  INPUT_RIGHT:
+    for (int i = 0; i < alpha; i++) {
+      for (int j = 0; j < alpha; j++) {
+#ifdef __VITIS_HLS__
+#pragma HLS UNROLL
+#endif
+        dtype acc = dtype(0);
+        for (int k = 0; k < alpha; k++) {
+          if (mat::BT[j][k] != 0.0f) {
+            acc += tmp[i][k] * dtype(mat::BT[j][k]);
+          }
+        }
+        v[i][j] = acc;
+      }
+    }
+  }
+
+  // Y = A^T p A
+  static void output(dtype y[m][m], const dtype p[alpha][alpha]) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE
+#endif
+    dtype tmp[m][alpha];
+
+  OUTPUT_LEFT:
+    for (int i = 0; i < m; i++) {
+      for (int j = 0; j < alpha; j++) {
+#ifdef __VITIS_HLS__
+#pragma HLS UNROLL
+#endif
+        dtype acc = dtype(0);
+        for (int k = 0; k < alpha; k++) {
+          if (mat::AT[i][k] != 0.0f) {
+            acc += dtype(mat::AT[i][k]) * p[k][j];
+          }
+        }
+        tmp[i][j] = acc;
+      }
+    }
+
+  OUTPUT_RIGHT:
+    for (int i = 0; i < m; i++) {
+      for (int j = 0; j < m; j++) {
+#ifdef __VITIS_HLS__
+#pragma HLS UNROLL
+#endif
+        dtype acc = dtype(0);
+        for (int k = 0; k < alpha; k++) {
+          if (mat::AT[j][k] != 0.0f) {
+            acc += tmp[i][k] * dtype(mat::AT[j][k]);
+          }
+        }
+        y[i][j] = acc;
+      }
+    }
+  }
+};
+
+} // namespace vhn
@@ -0,0 +1,107 @@
+#pragma once
+
+namespace vhn {
+
+// Memory layout of a [channels x spatial] feature map. LAYOUT_NCHW is
+// dtype[C][W][H] (the default everywhere); LAYOUT_NHWC is dtype[W][H][C], so
+// the channel reduction of a convolution walks contiguous memory.
+enum TensorLayout { LAYOUT_NCHW, LAYOUT_NHWC };
+
+// Conversions between the two layouts. Also usable for conv weights: an
+// [out][in][k][k] tensor is a batch of out_channels NCHW maps with
+// CHANNELS = in, WIDTH = HEIGHT = k, and to_nhwc turns it into the
+// [out][k][k][in] order channels-last Conv2d expects.
+template <typename DType, int CHANNELS, int WIDTH, int HEIGHT>
+struct LayoutTransform {
+  using dtype = DType;
+  static constexpr int channels = CHANNELS;
+  static constexpr int width = WIDTH;
+  static constexpr int height = HEIGHT;
+
+  using NCHW_t = dtype[CHANNELS][WIDTH][HEIGHT];
+  using NHWC_t = dtype[WIDTH][HEIGHT][CHANNELS];
+
+  static void to_nhwc(NHWC_t output, const NCHW_t input) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+  TO_NHWC_W_LOOP:
+    for (int w = 0; w < width; w++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 512
+#endif
+    TO_NHWC_H_LOOP:
+      for (int h = 0; h < height; h++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 512
+#endif
+      TO_NHWC_C_LOOP:
+        for (int c = 0; c < channels; c++) {
+#ifdef __VITIS_HLS__
+#pragma HLS PIPELINE II = 1
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 1024
+#endif
+          output[w][h][c] = input[c][w][h];
+        }
+      }
+    }
+  }
+
+  static void to_nchw(NCHW_t output, const NHWC_t input) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+  TO_NCHW_C_LOOP:
+    for (int c = 0; c < channels; c++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 1024
+#endif
+    TO_NCHW_W_LOOP:
+      for (int w = 0; w < width; w++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 512
+#endif
+      TO_NCHW_H_LOOP:
+        for (int h = 0; h < height; h++) {
+#ifdef __VITIS_HLS__
+#pragma HLS PIPELINE II = 1
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 512
+#endif
+          output[c][w][h] = input[w][h][c];
+        }
+      }
+    }
+  }
+
+  static void to_nhwc(dtype output[][WIDTH][HEIGHT][CHANNELS],
+                      const dtype input[][CHANNELS][WIDTH][HEIGHT],
+                      const int batch_size) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+  BATCH_LOOP:
+    for (int b = 0; b < batch_size; b++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 512
+#endif
+      to_nhwc(output[b], input[b]);
+    }
+  }
+
+  static void to_nchw(dtype output[][CHANNELS][WIDTH][HEIGHT],
+                      const dtype input[][WIDTH][HEIGHT][CHANNELS],
+                      const int batch_size) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+  BATCH_LOOP:
+    for (int b = 0; b < batch_size; b++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 512
+#endif
+      to_nchw(output[b], input[b]);
+    }
+  }
+};
+
+} // namespace vhn
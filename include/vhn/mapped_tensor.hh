@@ -0,0 +1,190 @@
+#pragma once
+
+#if !defined(__VITIS_HLS__) && (defined(__unix__) || defined(__APPLE__))
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <fcntl.h>
+#include <stdexcept>
+#include <string>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <type_traits>
+#include <unistd.h>
+#include <utility>
+
+namespace vhn {
+
+// Paging hint passed to madvise for the whole mapping.
+enum MapAdvice {
+  MAP_ADVICE_NORMAL,
+  MAP_ADVICE_RANDOM,     // lookup tables: no readahead around touched rows
+  MAP_ADVICE_SEQUENTIAL, // dense weights streamed front to back
+  MAP_ADVICE_WILLNEED    // start paging everything in now
+};
+
+// ============================================================================
+// Memory-mapped weight tensor (host only)
+// ============================================================================
+// Maps a raw little-endian dump of T (a kernel's Weight_t, e.g.
+// float[vocab_size][embed_size]) read-only from `path`, starting `offset`
+// bytes in, and exposes it as `const T &` so it can be passed straight to
+// any kernel. Nothing is read at construction: pages are faulted in on
+// first touch, so a gather only ever loads the rows it indexes.
+//
+// The data pointer is aligned to ALIGNMENT bytes (at least alignof the
+// element type); since mappings start on a page boundary this requires
+// `offset` to be a multiple of ALIGNMENT, which is checked.
+template <typename T, std::size_t ALIGNMENT = 64> class MappedTensor {
+public:
+  using element_t = std::remove_all_extents_t<T>;
+  static constexpr std::size_t alignment =
+      ALIGNMENT > alignof(element_t) ? ALIGNMENT : alignof(element_t);
+  static constexpr std::size_t size_bytes = sizeof(T);
+
+  static_assert(std::is_trivially_copyable<element_t>::value,
+                "MappedTensor element type must be trivially copyable");
+  static_assert((alignment & (alignment - 1)) == 0,
+                "MappedTensor alignment must be a power of two");
+
+  MappedTensor() = default;
+
+  explicit MappedTensor(const std::string &path, const std::size_t offset = 0,
+                        const MapAdvice advice = MAP_ADVICE_NORMAL) {
+    open(path, offset, advice);
+  }
+
+  MappedTensor(const MappedTensor &) = delete;
+  MappedTensor &operator=(const MappedTensor &) = delete;
+
+  MappedTensor(MappedTensor &&other) noexcept { swap(other); }
+  MappedTensor &operator=(MappedTensor &&other) noexcept {
+    if (this != &other) {
+      close();
+      swap(other);
+    }
+    return *this;
+  }
+
+  ~MappedTensor() { close(); }
+
+  void open(const std::string &path, const std::size_t offset = 0,
+            const MapAdvice advice = MAP_ADVICE_NORMAL) {
+    close();
+    if (offset % alignment != 0) {
+      throw std::runtime_error("MappedTensor: offset " +
+                               std::to_string(offset) + " of '" + path +
+                               "' is not a multiple of " +
+                               std::to_string(alignment));
+    }
+
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+      throw std::runtime_error("MappedTensor: cannot open '" + path + "'");
+    }
+    struct stat st;
+    if (::fstat(fd, &st) != 0 ||
+        static_cast<std::size_t>(st.st_size) < offset + size_bytes) {
+      ::close(fd);
+      throw std::runtime_error("MappedTensor: '" + path +
+                               "' holds fewer than " +
+                               std::to_string(offset + size_bytes) + " bytes");
+    }
+
+    // Map from the page containing `offset`; the mapping is page aligned,
+    // so the data pointer inherits the alignment of `offset`.
+    const std::size_t page = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+    const std::size_t map_offset = offset - offset % page;
+    const std::size_t map_length = offset - map_offset + size_bytes;
+    void *base = ::mmap(nullptr, map_length, PROT_READ, MAP_PRIVATE, fd,
+                        static_cast<off_t>(map_offset));
+    ::close(fd);
+    if (base == MAP_FAILED) {
+      throw std::runtime_error("MappedTensor: mmap of '" + path + "' failed");
+    }
+
+    _base = base;
+    _length = map_length;
+    _data = static_cast<const unsigned char *>(base) + (offset - map_offset);
+    advise(advice);
+  }
+
+  void close() {
+    if (_base != nullptr) {
+      ::munmap(_base, _length);
+    }
+    _base = nullptr;
+    _data = nullptr;
+    _length = 0;
+  }
+
+  void advise(const MapAdvice advice) const {
+    if (_base == nullptr) {
+      return;
+    }
+    int flag = MADV_NORMAL;
+    switch (advice) {
+    case MAP_ADVICE_RANDOM:
+      flag = MADV_RANDOM;
+      break;
+    case MAP_ADVICE_SEQUENTIAL:
+      flag = MADV_SEQUENTIAL;
+      break;
+    case MAP_ADVICE_WILLNEED:
+      flag = MADV_WILLNEED;
+      break;
+    default:
+      break;
+    }
+    ::madvise(_base, _length, flag);
+  }
+
+  bool is_open() const { return _data != nullptr; }
+  const void *data() const { return _data; }
+
+  const T &get() const {
+    if (_data == nullptr) {
+      throw std::runtime_error("MappedTensor: tensor is not mapped");
+    }
+    return *reinterpret_cast<const T *>(_data);
+  }
+
+  operator const T &() const { return get(); }
+
+  // Writes `value` in the layout open() expects, zero-padding the file up to
+  // `offset` if it is shorter.
+  static void save(const std::string &path, const T &value,
+                   const std::size_t offset = 0) {
+    std::FILE *file = std::fopen(path.c_str(), offset == 0 ? "wb" : "r+b");
+    if (file == nullptr && offset != 0) {
+      file = std::fopen(path.c_str(), "w+b");
+    }
+    if (file == nullptr) {
+      throw std::runtime_error("MappedTensor: cannot write '" + path + "'");
+    }
+    std::fseek(file, 0, SEEK_END);
+    for (long pos = std::ftell(file); pos < static_cast<long>(offset); pos++) {
+      std::fputc(0, file);
+    }
+    std::fseek(file, static_cast<long>(offset), SEEK_SET);
+    const bool ok = std::fwrite(&value, 1, size_bytes, file) == size_bytes;
+    std::fclose(file);
+    if (!ok) {
+      throw std::runtime_error("MappedTensor: short write to '" + path + "'");
+    }
+  }
+
+private:
+  void swap(MappedTensor &other) noexcept {
+    std::swap(_base, other._base);
+    std::swap(_data, other._data);
+    std::swap(_length, other._length);
+  }
+
+  void *_base = nullptr;
+  const unsigned char *_data = nullptr;
+  std::size_t _length = 0;
+};
+
+} // namespace vhn
+#endif
@@ -68,14 +68,37 @@ public:
 #endif
     addnorm::addnorm(output, input, residual, actual_len, gamma, beta);
   }
+
+#ifdef __VITIS_HLS__
+  static void forward(hls::stream<dtype> &output_stream,
+                      hls::stream<dtype> &input_stream,
+                      hls::stream<dtype> &residual_stream, const gamma_t gamma,
+                      const beta_t beta) {
+#pragma HLS INLINE off
+    addnorm::addnorm(output_stream, input_stream, residual_stream, gamma, beta);
+  }
+
+  static void forward(hls::stream<dtype> &output_stream,
+                      hls::stream<dtype> &input_stream,
+                      hls::stream<dtype> &residual_stream, const int actual_len,
+                      const gamma_t gamma, const beta_t beta) {
+#pragma HLS INLINE off
+    addnorm::addnorm(output_stream, input_stream, residual_stream, actual_len,
+                     gamma, beta);
+  }
+#endif
 };
 
-template <typename NORM_CONFIG, typename ADD_CONFIG, int MEMORY_PARTITION>
+// FUSED selects the single-sweep add + LayerNorm kernels; when false the
+// residual add and the norm run as two separate passes.
+template <typename NORM_CONFIG, typename ADD_CONFIG, int MEMORY_PARTITION,
+          bool FUSED = true>
 struct AddNormConfig {
   using norm_config = NORM_CONFIG;
   using add_config = ADD_CONFIG;
 
   static constexpr int memory_partition = MEMORY_PARTITION;
+  static constexpr bool fused = FUSED;
 };
 
 // ============================================================================
@@ -166,6 +189,25 @@ public:
                        &residual[i * d_model], gamma, beta);
     }
   }
+
+#ifdef __VITIS_HLS__
+  static void forward(hls::stream<dtype> &output_stream,
+                      hls::stream<dtype> &input_stream,
+                      hls::stream<dtype> &residual_stream, const gamma_t gamma,
+                      const beta_t beta) {
+#pragma HLS INLINE off
+    addnorm::addnorm(output_stream, input_stream, residual_stream, gamma, beta);
+  }
+
+  static void forward(hls::stream<dtype> &output_stream,
+                      hls::stream<dtype> &input_stream,
+                      hls::stream<dtype> &residual_stream, const int actual_len,
+                      const gamma_t gamma, const beta_t beta) {
+#pragma HLS INLINE off
+    addnorm::addnorm(output_stream, input_stream, residual_stream, actual_len,
+                     gamma, beta);
+  }
+#endif
 };
 
 } // namespace vhn
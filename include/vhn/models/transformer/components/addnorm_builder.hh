@@ -45,6 +45,7 @@ public:
     auto add_cfg = hls_cfg.value("add", json::object());
 
     auto memory_partition = hls_cfg.value("memory_partition", 4);
+    auto fused = hls_cfg.value("fused", true);
 
     LayerNormBuilder layernorm_builder;
     ElementwiseBuilder elementwise_builder;
@@ -63,7 +64,8 @@ public:
       oss << name << "_add_cfg, ";
     else
       oss << "void, ";
-    oss << memory_partition;
+    oss << memory_partition << ", ";
+    oss << (fused ? "true" : "false");
     oss << ">;\n\n";
 
     return oss.str();
@@ -87,6 +87,25 @@ public:
       norm::ln(output + i * d_model, sum, gamma, beta);
     }
   }
+
+#ifdef __VITIS_HLS__
+  static void addnorm(hls::stream<dtype> &output_stream,
+                      hls::stream<dtype> &input_stream,
+                      hls::stream<dtype> &residual_stream, const gamma_t gamma,
+                      const beta_t beta) {
+#pragma HLS INLINE off
+    norm::add_ln(output_stream, input_stream, residual_stream, gamma, beta);
+  }
+
+  static void addnorm(hls::stream<dtype> &output_stream,
+                      hls::stream<dtype> &input_stream,
+                      hls::stream<dtype> &residual_stream, const int actual_len,
+                      const gamma_t gamma, const beta_t beta) {
+#pragma HLS INLINE off
+    norm::add_ln_2d(output_stream, input_stream, residual_stream, actual_len,
+                  gamma, beta);
+  }
+#endif
 };
 
 // ============================================================================
@@ -99,6 +118,7 @@ public:
   static constexpr int d_model = HParams::d_model;
   static constexpr OptLevel opt_level = OPT_ENABLED;
   static constexpr int memory_partition = Config::memory_partition;
+  static constexpr bool fused = Config::fused;
 
   using gamma_t = dtype[d_model];
   using beta_t = dtype[d_model];
@@ -127,9 +147,13 @@ public:
 #pragma HLS INLINE off
 #pragma HLS PIPELINE II = 1
 #endif
-    dtype sum[d_model];
-    add::elem(sum, input, residual);
-    norm::ln(output, sum, gamma, beta);
+    if constexpr (fused) {
+      norm::add_ln(output, input, residual, gamma, beta);
+    } else {
+      dtype sum[d_model];
+      add::elem(sum, input, residual);
+      norm::ln(output, sum, gamma, beta);
+    }
   }
 
   static void addnorm(dtype output[][d_model], const dtype input[][d_model],
@@ -159,8 +183,12 @@ public:
 #pragma HLS PIPELINE II = 1
 #pragma HLS LOOP_TRIPCOUNT min = 1 max = 512
 #endif
-      add::elem(sum, input[i], residual[i]);
-      norm::ln(output[i], sum, gamma, beta);
+      if constexpr (fused) {
+        norm::add_ln(output[i], input[i], residual[i], gamma, beta);
+      } else {
+        add::elem(sum, input[i], residual[i]);
+        norm::ln(output[i], sum, gamma, beta);
+      }
     }
   }
 
@@ -191,10 +219,34 @@ public:
 #pragma HLS PIPELINE II = 1
 #pragma HLS LOOP_TRIPCOUNT min = 1 max = 512
 #endif
-      add::elem(sum, input + i * d_model, residual + i * d_model);
-      norm::ln(output + i * d_model, sum, gamma, beta);
+      if constexpr (fused) {
+        norm::add_ln(output + i * d_model, input + i * d_model,
+                     residual + i * d_model, gamma, beta);
+      } else {
+        add::elem(sum, input + i * d_model, residual + i * d_model);
+        norm::ln(output + i * d_model, sum, gamma, beta);
+      }
     }
   }
+
+#ifdef __VITIS_HLS__
+  static void addnorm(hls::stream<dtype> &output_stream,
+                      hls::stream<dtype> &input_stream,
+                      hls::stream<dtype> &residual_stream, const gamma_t gamma,
+                      const beta_t beta) {
+#pragma HLS INLINE off
+    norm::add_ln(output_stream, input_stream, residual_stream, gamma, beta);
+  }
+
+  static void addnorm(hls::stream<dtype> &output_stream,
+                      hls::stream<dtype> &input_stream,
+                      hls::stream<dtype> &residual_stream, const int actual_len,
+                      const gamma_t gamma, const beta_t beta) {
+#pragma HLS INLINE off
+    norm::add_ln_2d(output_stream, input_stream, residual_stream, actual_len,
+                  gamma, beta);
+  }
+#endif
 };
 
 } // namespace vhn
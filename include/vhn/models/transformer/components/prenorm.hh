@@ -87,6 +87,25 @@ public:
       add::elem(output + i * d_model, residual + i * d_model, normed);
     }
   }
+
+#ifdef __VITIS_HLS__
+  static void addnorm(hls::stream<dtype> &output_stream,
+                      hls::stream<dtype> &input_stream,
+                      hls::stream<dtype> &residual_stream, const gamma_t gamma,
+                      const beta_t beta) {
+#pragma HLS INLINE off
+    norm::ln_add(output_stream, input_stream, residual_stream, gamma, beta);
+  }
+
+  static void addnorm(hls::stream<dtype> &output_stream,
+                      hls::stream<dtype> &input_stream,
+                      hls::stream<dtype> &residual_stream, const int actual_len,
+                      const gamma_t gamma, const beta_t beta) {
+#pragma HLS INLINE off
+    norm::ln_add_2d(output_stream, input_stream, residual_stream, actual_len,
+                  gamma, beta);
+  }
+#endif
 };
 
 // ============================================================================
@@ -99,6 +118,7 @@ public:
   static constexpr int d_model = HParams::d_model;
   static constexpr OptLevel opt_level = OPT_ENABLED;
   static constexpr int memory_partition = Config::memory_partition;
+  static constexpr bool fused = Config::fused;
 
   using gamma_t = dtype[d_model];
   using beta_t = dtype[d_model];
@@ -127,9 +147,13 @@ public:
 #pragma HLS INLINE off
 #pragma HLS PIPELINE II = 1
 #endif
-    dtype normed[d_model];
-    norm::ln(normed, input, gamma, beta);
-    add::elem(output, residual, normed);
+    if constexpr (fused) {
+      norm::ln_add(output, input, residual, gamma, beta);
+    } else {
+      dtype normed[d_model];
+      norm::ln(normed, input, gamma, beta);
+      add::elem(output, residual, normed);
+    }
   }
 
   static void addnorm(dtype output[][d_model], const dtype input[][d_model],
@@ -159,8 +183,12 @@ public:
 #pragma HLS PIPELINE II = 1
 #pragma HLS LOOP_TRIPCOUNT min = 1 max = 512
 #endif
-      norm::ln(normed, input[i], gamma, beta);
-      add::elem(output[i], residual[i], normed);
+      if constexpr (fused) {
+        norm::ln_add(output[i], input[i], residual[i], gamma, beta);
+      } else {
+        norm::ln(normed, input[i], gamma, beta);
+        add::elem(output[i], residual[i], normed);
+      }
     }
   }
 
@@ -191,10 +219,34 @@ public:
 #pragma HLS PIPELINE II = 1
 #pragma HLS LOOP_TRIPCOUNT min = 1 max = 512
 #endif
-      norm::ln(normed, input + i * d_model, gamma, beta);
-      add::elem(output + i * d_model, residual + i * d_model, normed);
+      if constexpr (fused) {
+        norm::ln_add(output + i * d_model, input + i * d_model,
+                     residual + i * d_model, gamma, beta);
+      } else {
+        norm::ln(normed, input + i * d_model, gamma, beta);
+        add::elem(output + i * d_model, residual + i * d_model, normed);
+      }
     }
   }
+
+#ifdef __VITIS_HLS__
+  static void addnorm(hls::stream<dtype> &output_stream,
+                      hls::stream<dtype> &input_stream,
+                      hls::stream<dtype> &residual_stream, const gamma_t gamma,
+                      const beta_t beta) {
+#pragma HLS INLINE off
+    norm::ln_add(output_stream, input_stream, residual_stream, gamma, beta);
+  }
+
+  static void addnorm(hls::stream<dtype> &output_stream,
+                      hls::stream<dtype> &input_stream,
+                      hls::stream<dtype> &residual_stream, const int actual_len,
+                      const gamma_t gamma, const beta_t beta) {
+#pragma HLS INLINE off
+    norm::ln_add_2d(output_stream, input_stream, residual_stream, actual_len,
+                  gamma, beta);
+  }
+#endif
 };
 
 } // namespace vhn
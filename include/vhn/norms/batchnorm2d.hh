@@ -1,7 +1,9 @@
 #pragma once
 
+#include "../layout.hh"
 #include "../opt_level.hh"
 #include <cmath>
+#include <type_traits>
 
 #ifdef __VITIS_HLS__
 #include <hls_math.h>
@@ -189,11 +191,16 @@ private:
 #endif
 };
 
-template <int PIPELINE_II, int UNROLL_FACTOR, int PARTITION_FACTOR>
+// LAYOUT_NHWC switches the optimized tensors to channels-last
+// ([HEIGHT][WIDTH][CHANNELS] and [spatial_size][CHANNELS]); the per-channel
+// scale and shift are then applied across each contiguous pixel vector.
+template <int PIPELINE_II, int UNROLL_FACTOR, int PARTITION_FACTOR,
+          TensorLayout LAYOUT = LAYOUT_NCHW>
 struct BatchNorm2dConfig {
   static constexpr int pipeline_ii = PIPELINE_II;
   static constexpr int unroll_factor = UNROLL_FACTOR;
   static constexpr int partition_factor = PARTITION_FACTOR;
+  static constexpr TensorLayout layout = LAYOUT;
 };
 
 // ============================================================================
@@ -213,9 +220,15 @@ public:
   static constexpr int pipeline_ii = Config::pipeline_ii;
   static constexpr int unroll_factor = Config::unroll_factor;
   static constexpr int partition_factor = Config::partition_factor;
-
-  using Tensor_2d_t = dtype[CHANNELS][spatial_size];
-  using Tensor_3d_t = dtype[CHANNELS][HEIGHT][WIDTH];
+  static constexpr TensorLayout layout = Config::layout;
+  static constexpr bool channels_last = layout == LAYOUT_NHWC;
+
+  using Tensor_2d_t =
+      std::conditional_t<channels_last, dtype[spatial_size][CHANNELS],
+                         dtype[CHANNELS][spatial_size]>;
+  using Tensor_3d_t =
+      std::conditional_t<channels_last, dtype[HEIGHT][WIDTH][CHANNELS],
+                         dtype[CHANNELS][HEIGHT][WIDTH]>;
   using Weight_t = dtype[CHANNELS];
   using Bias_t = dtype[CHANNELS];
   using RunningMean_t = dtype[CHANNELS];
@@ -246,8 +259,7 @@ public:
                  epsilon);
   }
 
-  static void bn2d(dtype output[][CHANNELS][HEIGHT][WIDTH],
-                   const dtype input[][CHANNELS][HEIGHT][WIDTH],
+  static void bn2d(Tensor_3d_t output[], const Tensor_3d_t input[],
                    const int batch_size, const Weight_t weight,
                    const Bias_t bias, const RunningMean_t running_mean,
                    const RunningVar_t running_var, const float epsilon = 1e-5) {
@@ -264,8 +276,7 @@ public:
     }
   }
 
-  static void bn2d(dtype output[][CHANNELS][spatial_size],
-                   const dtype input[][CHANNELS][spatial_size],
+  static void bn2d(Tensor_2d_t output[], const Tensor_2d_t input[],
                    const int batch_size, const Weight_t weight,
                    const Bias_t bias, const RunningMean_t running_mean,
                    const RunningVar_t running_var, const float epsilon = 1e-5) {
@@ -302,10 +313,12 @@ private:
                            const float epsilon) {
 #ifdef __VITIS_HLS__
 #pragma HLS INLINE off
+    if constexpr (!channels_last) {
 #pragma HLS ARRAY_PARTITION variable = input cyclic factor =                   \
     partition_factor dim = 1
 #pragma HLS ARRAY_PARTITION variable = output cyclic factor =                  \
     partition_factor dim = 1
+    }
 #pragma HLS ARRAY_PARTITION variable = weight cyclic factor = partition_factor
 #pragma HLS ARRAY_PARTITION variable = bias cyclic factor = partition_factor
 #pragma HLS ARRAY_PARTITION variable = running_mean cyclic factor =            \
@@ -313,6 +326,12 @@ private:
 #pragma HLS ARRAY_PARTITION variable = running_var cyclic factor =             \
     partition_factor
 #endif
+    if constexpr (channels_last) {
+      nhwc_impl(output, input, weight, bias, running_mean, running_var,
+                epsilon);
+      return;
+    }
+
   CHANNEL_LOOP:
     for (int c = 0; c < channels; c++) {
 #ifdef __VITIS_HLS__
@@ -342,10 +361,12 @@ private:
                            const float epsilon) {
 #ifdef __VITIS_HLS__
 #pragma HLS INLINE off
+    if constexpr (!channels_last) {
 #pragma HLS ARRAY_PARTITION variable = input cyclic factor =                   \
     partition_factor dim = 1
 #pragma HLS ARRAY_PARTITION variable = output cyclic factor =                  \
     partition_factor dim = 1
+    }
 #pragma HLS ARRAY_PARTITION variable = weight cyclic factor = partition_factor
 #pragma HLS ARRAY_PARTITION variable = bias cyclic factor = partition_factor
 #pragma HLS ARRAY_PARTITION variable = running_mean cyclic factor =            \
@@ -353,6 +374,14 @@ private:
 #pragma HLS ARRAY_PARTITION variable = running_var cyclic factor =             \
     partition_factor
 #endif
+    if constexpr (channels_last) {
+      // [HEIGHT][WIDTH][CHANNELS] is contiguous, i.e. [spatial_size][CHANNELS].
+      nhwc_impl(reinterpret_cast<dtype(*)[channels]>(output),
+                reinterpret_cast<const dtype(*)[channels]>(input), weight,
+                bias, running_mean, running_var, epsilon);
+      return;
+    }
+
   CHANNEL_LOOP:
     for (int c = 0; c < channels; c++) {
 #ifdef __VITIS_HLS__
@@ -379,6 +408,51 @@ private:
     }
   }
 
+  // Channels-last: fold the statistics into one scale/shift pair per channel,
+  // then sweep pixels with the contiguous channel vector innermost.
+  static void nhwc_impl(dtype output[][CHANNELS],
+                        const dtype input[][CHANNELS], const Weight_t weight,
+                        const Bias_t bias, const RunningMean_t running_mean,
+                        const RunningVar_t running_var, const float epsilon) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+    dtype scale[channels];
+    dtype shift[channels];
+#ifdef __VITIS_HLS__
+#pragma HLS ARRAY_PARTITION variable = scale cyclic factor = partition_factor
+#pragma HLS ARRAY_PARTITION variable = shift cyclic factor = partition_factor
+#pragma HLS ARRAY_PARTITION variable = input cyclic factor =                   \
+    partition_factor dim = 2
+#pragma HLS ARRAY_PARTITION variable = output cyclic factor =                  \
+    partition_factor dim = 2
+#endif
+
+  SCALE_LOOP:
+    for (int c = 0; c < channels; c++) {
+#ifdef __VITIS_HLS__
+#pragma HLS PIPELINE II = pipeline_ii
+      dtype inv_std = hls::rsqrt(running_var[c] + dtype(epsilon));
+#else
+      dtype inv_std = dtype(1.0) / std::sqrt(running_var[c] + dtype(epsilon));
+#endif
+      scale[c] = weight[c] * inv_std;
+      shift[c] = bias[c] - running_mean[c] * scale[c];
+    }
+
+  PIXEL_LOOP:
+    for (int s = 0; s < spatial_size; s++) {
+    CHANNEL_LOOP:
+      for (int c = 0; c < channels; c++) {
+#ifdef __VITIS_HLS__
+#pragma HLS PIPELINE II = pipeline_ii
+#pragma HLS UNROLL factor = unroll_factor
+#endif
+        output[s][c] = input[s][c] * scale[c] + shift[c];
+      }
+    }
+  }
+
 #ifdef __VITIS_HLS__
   static void bn2d_stream_impl(hls::stream<dtype> &output_stream,
                                hls::stream<dtype> &input_stream,
@@ -386,6 +460,21 @@ private:
                                const RunningMean_t running_mean,
                                const RunningVar_t running_var,
                                const float epsilon) {
+    if constexpr (channels_last) {
+    PIXEL_STREAM_LOOP:
+      for (int s = 0; s < spatial_size; s++) {
+      CHANNEL_STREAM_LOOP:
+        for (int c = 0; c < channels; c++) {
+#pragma HLS PIPELINE II = pipeline_ii
+          dtype inv_std = hls::rsqrt(running_var[c] + dtype(epsilon));
+          dtype x = input_stream.read();
+          output_stream.write(weight[c] * (x - running_mean[c]) * inv_std +
+                              bias[c]);
+        }
+      }
+      return;
+    }
+
     dtype input_buffer[spatial_size];
 #pragma HLS ARRAY_PARTITION variable = input_buffer cyclic factor =            \
     partition_factor
@@ -38,9 +38,15 @@ public:
     auto pipeline_ii = hls_cfg.value("pipeline_ii", 1);
     auto unroll_factor = hls_cfg.value("unroll_factor", 4);
     auto partition_factor = hls_cfg.value("partition_factor", 4);
+    auto layout = hls_cfg.value("layout", std::string("nchw"));
+    if (layout != "nchw" && layout != "nhwc") {
+      throw std::runtime_error("Unsupported BatchNorm2d layout: " + layout);
+    }
 
     oss << "using " << name << "_cfg = vhn::BatchNorm2dConfig<";
     oss << pipeline_ii << ", " << unroll_factor << ", " << partition_factor;
+    if (layout == "nhwc")
+      oss << ", vhn::LAYOUT_NHWC";
     oss << ">;\n\n";
 
     return oss.str();
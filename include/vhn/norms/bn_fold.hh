@@ -0,0 +1,88 @@
+#pragma once
+
+#include <cmath>
+#include <type_traits>
+
+#ifdef __VITIS_HLS__
+#include <hls_math.h>
+#endif
+
+namespace vhn {
+
+// ============================================================================
+// BatchNorm folding
+// ============================================================================
+// Folds an inference-mode BatchNorm that directly follows a Linear / Conv1d /
+// Conv2d layer into that layer's weight and bias:
+//
+//   scale[c]     = bn_weight[c] / sqrt(running_var[c] + epsilon)
+//   weight'[c].. = weight[c].. * scale[c]
+//   bias'[c]     = (bias[c] - running_mean[c]) * scale[c] + bn_bias[c]
+//
+// `Layer` is any layer whose Weight_t has the output channel as its leading
+// dimension and whose Bias_t is dtype[out_channels]. The output arrays may
+// alias the inputs to fold in place.
+template <typename Layer> class BatchNormFold {
+public:
+  using dtype = typename Layer::dtype;
+  using Weight_t = typename Layer::Weight_t;
+  using Bias_t = typename Layer::Bias_t;
+
+  static constexpr int channels = std::extent<Weight_t, 0>::value;
+  static constexpr int fan_in =
+      sizeof(std::remove_extent_t<Weight_t>) / sizeof(dtype);
+
+  using BNParam_t = dtype[channels];
+
+  static_assert(std::extent<Bias_t, 0>::value == channels,
+                "Bias_t must have one entry per output channel");
+
+  BatchNormFold() = default;
+  ~BatchNormFold() = default;
+
+  static void fold(Weight_t folded_weight, Bias_t folded_bias,
+                   const Weight_t weight, const Bias_t bias,
+                   const BNParam_t bn_weight, const BNParam_t bn_bias,
+                   const BNParam_t running_mean, const BNParam_t running_var,
+                   const float epsilon = 1e-5) {
+    const dtype *w_in = reinterpret_cast<const dtype *>(weight);
+    dtype *w_out = reinterpret_cast<dtype *>(folded_weight);
+
+  CHANNEL_LOOP:
+    for (int c = 0; c < channels; c++) {
+#ifdef __VITIS_HLS__
+      dtype inv_std = hls::rsqrt(running_var[c] + dtype(epsilon));
+#else
+      dtype inv_std = dtype(1.0) / std::sqrt(running_var[c] + dtype(epsilon));
+#endif
+      dtype scale = bn_weight[c] * inv_std;
+
+    FAN_IN_LOOP:
+      for (int i = 0; i < fan_in; i++) {
+        w_out[c * fan_in + i] = w_in[c * fan_in + i] * scale;
+      }
+      folded_bias[c] = (bias[c] - running_mean[c]) * scale + bn_bias[c];
+    }
+  }
+
+  // Leaves the weights alone and reduces the BatchNorm to a per-channel
+  // y = x * scale + shift, e.g. for a Conv2dEpilogue.
+  static void scale_shift(BNParam_t scale, BNParam_t shift,
+                          const BNParam_t bn_weight, const BNParam_t bn_bias,
+                          const BNParam_t running_mean,
+                          const BNParam_t running_var,
+                          const float epsilon = 1e-5) {
+  CHANNEL_LOOP:
+    for (int c = 0; c < channels; c++) {
+#ifdef __VITIS_HLS__
+      dtype inv_std = hls::rsqrt(running_var[c] + dtype(epsilon));
+#else
+      dtype inv_std = dtype(1.0) / std::sqrt(running_var[c] + dtype(epsilon));
+#endif
+      scale[c] = bn_weight[c] * inv_std;
+      shift[c] = bn_bias[c] - running_mean[c] * scale[c];
+    }
+  }
+};
+
+} // namespace vhn
@@ -1,7 +1,9 @@
 #pragma once
 
+#include "../operators/multi_reduce.hh"
 #include "../opt_level.hh"
 #include <cmath>
+#include <type_traits>
 
 #ifdef __VITIS_HLS__
 #include <hls_math.h>
@@ -18,6 +20,13 @@ template <int HIDDEN_DIM> struct LayerNormHParams {
   static constexpr int hidden_dim = HIDDEN_DIM;
 };
 
+// Row statistics strategy used by the optimized LayerNorm.
+//   LN_TWO_PASS    : mean pass, then variance pass (reference behaviour)
+//   LN_WELFORD     : single pass, Welford running mean / M2 update
+//   LN_SUMSQ       : single pass, sum and sum of squares shifted by input[0]
+//   LN_SUMSQ_KAHAN : LN_SUMSQ with Kahan-compensated accumulators
+enum LayerNormStats { LN_TWO_PASS, LN_WELFORD, LN_SUMSQ, LN_SUMSQ_KAHAN };
+
 // ============================================================================
 // Non-optimized version (OPT_NONE)
 // ============================================================================
@@ -76,6 +85,26 @@ public:
     }
   }
 
+  // Fused residual add + LayerNorm (post-norm): output = LN(input + residual)
+  static void add_ln(dtype output[hidden_dim], const dtype input[hidden_dim],
+                     const dtype residual[hidden_dim], const Gamma_t gamma,
+                     const Beta_t beta, const float epsilon = 1e-5) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+    add_ln_1d_impl(output, input, residual, gamma, beta, epsilon);
+  }
+
+  // Fused LayerNorm + residual add (pre-norm): output = residual + LN(input)
+  static void ln_add(dtype output[hidden_dim], const dtype input[hidden_dim],
+                     const dtype residual[hidden_dim], const Gamma_t gamma,
+                     const Beta_t beta, const float epsilon = 1e-5) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+    ln_add_1d_impl(output, input, residual, gamma, beta, epsilon);
+  }
+
 #ifdef __VITIS_HLS__
   static void ln(hls::stream<dtype> &output_stream,
                  hls::stream<dtype> &input_stream, const Gamma_t gamma,
@@ -96,6 +125,52 @@ public:
     }
   }
 
+
+  static void add_ln(hls::stream<dtype> &output_stream,
+                     hls::stream<dtype> &input_stream,
+                     hls::stream<dtype> &residual_stream, const Gamma_t gamma,
+                     const Beta_t beta, const float epsilon = 1e-5) {
+#pragma HLS INLINE off
+    add_ln_1d_stream_impl(output_stream, input_stream, residual_stream, gamma,
+                          beta, epsilon);
+  }
+
+  static void add_ln_2d(hls::stream<dtype> &output_stream,
+                        hls::stream<dtype> &input_stream,
+                        hls::stream<dtype> &residual_stream, const int seq_len,
+                        const Gamma_t gamma, const Beta_t beta,
+                        const float epsilon = 1e-5) {
+#pragma HLS INLINE off
+  SEQ_LOOP:
+    for (int i = 0; i < seq_len; i++) {
+#pragma HLS LOOP_FLATTEN off
+      add_ln_1d_stream_impl(output_stream, input_stream, residual_stream, gamma,
+                            beta, epsilon);
+    }
+  }
+
+  static void ln_add(hls::stream<dtype> &output_stream,
+                     hls::stream<dtype> &input_stream,
+                     hls::stream<dtype> &residual_stream, const Gamma_t gamma,
+                     const Beta_t beta, const float epsilon = 1e-5) {
+#pragma HLS INLINE off
+    ln_add_1d_stream_impl(output_stream, input_stream, residual_stream, gamma,
+                          beta, epsilon);
+  }
+
+  static void ln_add_2d(hls::stream<dtype> &output_stream,
+                        hls::stream<dtype> &input_stream,
+                        hls::stream<dtype> &residual_stream, const int seq_len,
+                        const Gamma_t gamma, const Beta_t beta,
+                        const float epsilon = 1e-5) {
+#pragma HLS INLINE off
+  SEQ_LOOP:
+    for (int i = 0; i < seq_len; i++) {
+#pragma HLS LOOP_FLATTEN off
+      ln_add_1d_stream_impl(output_stream, input_stream, residual_stream, gamma,
+                            beta, epsilon);
+    }
+  }
 #endif
 
 private:
@@ -143,6 +218,94 @@ private:
     }
   }
 
+  static void add_ln_1d_impl(dtype *output, const dtype *input,
+                             const dtype *residual, const Gamma_t gamma,
+                             const Beta_t beta, const float epsilon) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+    dtype row[hidden_dim];
+
+    dtype mean = dtype(0);
+  ADD_MEAN:
+    for (int j = 0; j < hidden_dim; j++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 4096
+#endif
+      row[j] = input[j] + residual[j];
+      mean += row[j];
+    }
+    mean /= dtype(hidden_dim);
+
+    dtype variance = dtype(0);
+  CALC_VARIANCE:
+    for (int j = 0; j < hidden_dim; j++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 4096
+#endif
+      dtype diff = row[j] - mean;
+      variance += diff * diff;
+    }
+    variance /= dtype(hidden_dim);
+
+#ifdef __VITIS_HLS__
+    dtype inv_std = hls::rsqrt(variance + dtype(epsilon));
+#else
+    dtype inv_std = dtype(1.0) / std::sqrt(variance + dtype(epsilon));
+#endif
+
+  NORMALIZE:
+    for (int j = 0; j < hidden_dim; j++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 4096
+#endif
+      output[j] = gamma[j] * (row[j] - mean) * inv_std + beta[j];
+    }
+  }
+
+  static void ln_add_1d_impl(dtype *output, const dtype *input,
+                             const dtype *residual, const Gamma_t gamma,
+                             const Beta_t beta, const float epsilon) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+    dtype mean = dtype(0);
+  CALC_MEAN:
+    for (int j = 0; j < hidden_dim; j++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 4096
+#endif
+      mean += input[j];
+    }
+    mean /= dtype(hidden_dim);
+
+    dtype variance = dtype(0);
+  CALC_VARIANCE:
+    for (int j = 0; j < hidden_dim; j++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 4096
+#endif
+      dtype diff = input[j] - mean;
+      variance += diff * diff;
+    }
+    variance /= dtype(hidden_dim);
+
+#ifdef __VITIS_HLS__
+    dtype inv_std = hls::rsqrt(variance + dtype(epsilon));
+#else
+    dtype inv_std = dtype(1.0) / std::sqrt(variance + dtype(epsilon));
+#endif
+
+  NORMALIZE_ADD:
+    for (int j = 0; j < hidden_dim; j++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 4096
+#endif
+      output[j] =
+          residual[j] + gamma[j] * (input[j] - mean) * inv_std + beta[j];
+    }
+  }
+
 #ifdef __VITIS_HLS__
   static void ln_1d_stream_impl(hls::stream<dtype> &output_stream,
                                 hls::stream<dtype> &input_stream,
@@ -187,14 +350,87 @@ private:
       output_stream.write(output_val);
     }
   }
+
+  static void add_ln_1d_stream_impl(hls::stream<dtype> &output_stream,
+                                    hls::stream<dtype> &input_stream,
+                                    hls::stream<dtype> &residual_stream,
+                                    const Gamma_t gamma, const Beta_t beta,
+                                    const float epsilon) {
+#pragma HLS INLINE off
+    dtype row[hidden_dim];
+
+    dtype mean = dtype(0);
+  READ_ADD_MEAN:
+    for (int j = 0; j < hidden_dim; j++) {
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 4096
+      row[j] = input_stream.read() + residual_stream.read();
+      mean += row[j];
+    }
+    mean /= dtype(hidden_dim);
+
+    dtype variance = dtype(0);
+  CALC_VARIANCE_STREAM:
+    for (int j = 0; j < hidden_dim; j++) {
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 4096
+      dtype diff = row[j] - mean;
+      variance += diff * diff;
+    }
+    variance /= dtype(hidden_dim);
+
+    dtype inv_std = hls::rsqrt(variance + dtype(epsilon));
+
+  NORMALIZE_WRITE:
+    for (int j = 0; j < hidden_dim; j++) {
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 4096
+      output_stream.write(gamma[j] * (row[j] - mean) * inv_std + beta[j]);
+    }
+  }
+
+  static void ln_add_1d_stream_impl(hls::stream<dtype> &output_stream,
+                                    hls::stream<dtype> &input_stream,
+                                    hls::stream<dtype> &residual_stream,
+                                    const Gamma_t gamma, const Beta_t beta,
+                                    const float epsilon) {
+#pragma HLS INLINE off
+    dtype input_buffer[hidden_dim];
+
+    dtype mean = dtype(0);
+  READ_MEAN:
+    for (int j = 0; j < hidden_dim; j++) {
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 4096
+      input_buffer[j] = input_stream.read();
+      mean += input_buffer[j];
+    }
+    mean /= dtype(hidden_dim);
+
+    dtype variance = dtype(0);
+  CALC_VARIANCE_STREAM:
+    for (int j = 0; j < hidden_dim; j++) {
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 4096
+      dtype diff = input_buffer[j] - mean;
+      variance += diff * diff;
+    }
+    variance /= dtype(hidden_dim);
+
+    dtype inv_std = hls::rsqrt(variance + dtype(epsilon));
+
+  NORMALIZE_ADD_WRITE:
+    for (int j = 0; j < hidden_dim; j++) {
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 4096
+      dtype normed = gamma[j] * (input_buffer[j] - mean) * inv_std + beta[j];
+      output_stream.write(residual_stream.read() + normed);
+    }
+  }
 #endif
 };
 
-template <int PIPELINE_II, int UNROLL_FACTOR, int PARTITION_FACTOR>
+template <int PIPELINE_II, int UNROLL_FACTOR, int PARTITION_FACTOR,
+          LayerNormStats STATS_MODE = LN_TWO_PASS>
 struct LayerNormConfig {
   static constexpr int pipeline_ii = PIPELINE_II;
   static constexpr int unroll_factor = UNROLL_FACTOR;
   static constexpr int partition_factor = PARTITION_FACTOR;
+  static constexpr LayerNormStats stats_mode = STATS_MODE;
 };
 
 // ============================================================================
@@ -210,6 +446,7 @@ public:
   static constexpr int pipeline_ii = Config::pipeline_ii;
   static constexpr int unroll_factor = Config::unroll_factor;
   static constexpr int partition_factor = Config::partition_factor;
+  static constexpr LayerNormStats stats_mode = Config::stats_mode;
 
   using Gamma_t = dtype[hidden_dim];
   using Beta_t = dtype[hidden_dim];
@@ -259,6 +496,26 @@ public:
     }
   }
 
+  // Fused residual add + LayerNorm (post-norm): output = LN(input + residual)
+  static void add_ln(dtype output[hidden_dim], const dtype input[hidden_dim],
+                     const dtype residual[hidden_dim], const Gamma_t gamma,
+                     const Beta_t beta, const float epsilon = 1e-5) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+    add_ln_1d_impl(output, input, residual, gamma, beta, epsilon);
+  }
+
+  // Fused LayerNorm + residual add (pre-norm): output = residual + LN(input)
+  static void ln_add(dtype output[hidden_dim], const dtype input[hidden_dim],
+                     const dtype residual[hidden_dim], const Gamma_t gamma,
+                     const Beta_t beta, const float epsilon = 1e-5) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+    ln_add_1d_impl(output, input, residual, gamma, beta, epsilon);
+  }
+
 #ifdef __VITIS_HLS__
   static void ln(hls::stream<dtype> &output_stream,
                  hls::stream<dtype> &input_stream, const Gamma_t gamma,
@@ -279,6 +536,52 @@ public:
     }
   }
 
+
+  static void add_ln(hls::stream<dtype> &output_stream,
+                     hls::stream<dtype> &input_stream,
+                     hls::stream<dtype> &residual_stream, const Gamma_t gamma,
+                     const Beta_t beta, const float epsilon = 1e-5) {
+#pragma HLS INLINE off
+    add_ln_1d_stream_impl(output_stream, input_stream, residual_stream, gamma,
+                          beta, epsilon);
+  }
+
+  static void add_ln_2d(hls::stream<dtype> &output_stream,
+                        hls::stream<dtype> &input_stream,
+                        hls::stream<dtype> &residual_stream, const int seq_len,
+                        const Gamma_t gamma, const Beta_t beta,
+                        const float epsilon = 1e-5) {
+#pragma HLS INLINE off
+  SEQ_LOOP:
+    for (int i = 0; i < seq_len; i++) {
+#pragma HLS LOOP_FLATTEN off
+      add_ln_1d_stream_impl(output_stream, input_stream, residual_stream, gamma,
+                            beta, epsilon);
+    }
+  }
+
+  static void ln_add(hls::stream<dtype> &output_stream,
+                     hls::stream<dtype> &input_stream,
+                     hls::stream<dtype> &residual_stream, const Gamma_t gamma,
+                     const Beta_t beta, const float epsilon = 1e-5) {
+#pragma HLS INLINE off
+    ln_add_1d_stream_impl(output_stream, input_stream, residual_stream, gamma,
+                          beta, epsilon);
+  }
+
+  static void ln_add_2d(hls::stream<dtype> &output_stream,
+                        hls::stream<dtype> &input_stream,
+                        hls::stream<dtype> &residual_stream, const int seq_len,
+                        const Gamma_t gamma, const Beta_t beta,
+                        const float epsilon = 1e-5) {
+#pragma HLS INLINE off
+  SEQ_LOOP:
+    for (int i = 0; i < seq_len; i++) {
+#pragma HLS LOOP_FLATTEN off
+      ln_add_1d_stream_impl(output_stream, input_stream, residual_stream, gamma,
+                            beta, epsilon);
+    }
+  }
 #endif
 
 private:
@@ -307,31 +610,118 @@ private:
 #endif
 
     dtype mean = dtype(0);
-  CALC_MEAN:
+    dtype variance = dtype(0);
+    calc_stats(input, mean, variance);
+
+#ifdef __VITIS_HLS__
+    dtype inv_std = hls::rsqrt(variance + dtype(epsilon));
+#else
+    dtype inv_std = dtype(1.0) / std::sqrt(variance + dtype(epsilon));
+#endif
+
+  NORMALIZE:
     for (int i = 0; i < hidden_dim; i++) {
 #ifdef __VITIS_HLS__
 #pragma HLS PIPELINE II = pipeline_ii
 #pragma HLS UNROLL factor = unroll_factor
 #pragma HLS LOOP_TRIPCOUNT min = 1 max = 4096
+#pragma HLS BIND_OP variable = output op = mul impl = dsp
+#endif
+      output[i] = gamma[i] * (input[i] - mean) * inv_std + beta[i];
+    }
+  }
+
+  static void calc_stats(const dtype *input, dtype &mean, dtype &variance) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE
+#endif
+    mean = dtype(0);
+    variance = dtype(0);
+
+    if constexpr (stats_mode == LN_TWO_PASS) {
+    CALC_MEAN:
+      for (int i = 0; i < hidden_dim; i++) {
+#ifdef __VITIS_HLS__
+#pragma HLS PIPELINE II = pipeline_ii
+#pragma HLS UNROLL factor = unroll_factor
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 4096
 #pragma HLS BIND_OP variable = mean op = add impl = dsp
 #endif
-      mean += input[i];
+        mean += input[i];
+      }
+      mean /= dtype(hidden_dim);
+
+    CALC_VARIANCE:
+      for (int i = 0; i < hidden_dim; i++) {
+#ifdef __VITIS_HLS__
+#pragma HLS PIPELINE II = pipeline_ii
+#pragma HLS UNROLL factor = unroll_factor
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 4096
+#pragma HLS BIND_OP variable = variance op = add impl = dsp
+#endif
+        dtype diff = input[i] - mean;
+        variance += diff * diff;
+      }
+      variance /= dtype(hidden_dim);
+    } else {
+      const MeanVar<dtype> result = stats_reduce::reduce(input);
+      mean = result.mean;
+      variance = result.variance;
     }
-    mean /= dtype(hidden_dim);
+  }
+
+  static void add_ln_1d_impl(dtype *output, const dtype *input,
+                             const dtype *residual, const Gamma_t gamma,
+                             const Beta_t beta, const float epsilon) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+    dtype row[hidden_dim];
+#ifdef __VITIS_HLS__
+    constexpr bool should_partition =
+        (partition_factor > 1) && (hidden_dim <= 4096);
+    if constexpr (should_partition) {
+#pragma HLS ARRAY_PARTITION variable = row type = cyclic factor =              \
+    partition_factor
+#pragma HLS ARRAY_PARTITION variable = input type = cyclic factor =            \
+    partition_factor
+#pragma HLS ARRAY_PARTITION variable = residual type = cyclic factor =         \
+    partition_factor
+#pragma HLS ARRAY_PARTITION variable = output type = cyclic factor =           \
+    partition_factor
+    } else {
+#pragma HLS BIND_STORAGE variable = row type = ram_2p impl = bram
+    }
+#endif
 
+    dtype mean = dtype(0);
     dtype variance = dtype(0);
-  CALC_VARIANCE:
-    for (int i = 0; i < hidden_dim; i++) {
+
+    if constexpr (stats_mode == LN_TWO_PASS) {
+    ADD_ROW:
+      for (int i = 0; i < hidden_dim; i++) {
 #ifdef __VITIS_HLS__
 #pragma HLS PIPELINE II = pipeline_ii
 #pragma HLS UNROLL factor = unroll_factor
 #pragma HLS LOOP_TRIPCOUNT min = 1 max = 4096
-#pragma HLS BIND_OP variable = variance op = add impl = dsp
 #endif
-      dtype diff = input[i] - mean;
-      variance += diff * diff;
+        row[i] = input[i] + residual[i];
+      }
+      calc_stats(row, mean, variance);
+    } else {
+      Stats stats;
+    ADD_STATS:
+      for (int i = 0; i < hidden_dim; i++) {
+#ifdef __VITIS_HLS__
+#pragma HLS PIPELINE II = pipeline_ii
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 4096
+#endif
+        dtype val = input[i] + residual[i];
+        row[i] = val;
+        stats_impl::update(stats, val, i);
+      }
+      stats_finalize(stats, mean, variance);
     }
-    variance /= dtype(hidden_dim);
 
 #ifdef __VITIS_HLS__
     dtype inv_std = hls::rsqrt(variance + dtype(epsilon));
@@ -347,7 +737,48 @@ private:
 #pragma HLS LOOP_TRIPCOUNT min = 1 max = 4096
 #pragma HLS BIND_OP variable = output op = mul impl = dsp
 #endif
-      output[i] = gamma[i] * (input[i] - mean) * inv_std + beta[i];
+      output[i] = gamma[i] * (row[i] - mean) * inv_std + beta[i];
+    }
+  }
+
+  static void ln_add_1d_impl(dtype *output, const dtype *input,
+                             const dtype *residual, const Gamma_t gamma,
+                             const Beta_t beta, const float epsilon) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+
+    constexpr bool should_partition =
+        (partition_factor > 1) && (hidden_dim <= 4096);
+    if constexpr (should_partition) {
+#pragma HLS ARRAY_PARTITION variable = input type = cyclic factor =            \
+    partition_factor
+#pragma HLS ARRAY_PARTITION variable = residual type = cyclic factor =         \
+    partition_factor
+#pragma HLS ARRAY_PARTITION variable = output type = cyclic factor =           \
+    partition_factor
+    }
+#endif
+
+    dtype mean = dtype(0);
+    dtype variance = dtype(0);
+    calc_stats(input, mean, variance);
+
+#ifdef __VITIS_HLS__
+    dtype inv_std = hls::rsqrt(variance + dtype(epsilon));
+#else
+    dtype inv_std = dtype(1.0) / std::sqrt(variance + dtype(epsilon));
+#endif
+
+  NORMALIZE_ADD:
+    for (int i = 0; i < hidden_dim; i++) {
+#ifdef __VITIS_HLS__
+#pragma HLS PIPELINE II = pipeline_ii
+#pragma HLS UNROLL factor = unroll_factor
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 4096
+#pragma HLS BIND_OP variable = output op = mul impl = dsp
+#endif
+      output[i] =
+          residual[i] + gamma[i] * (input[i] - mean) * inv_std + beta[i];
     }
   }
 
@@ -372,31 +803,47 @@ private:
 #pragma HLS ARRAY_PARTITION variable = input_buffer cyclic factor =            \
     partition_factor
 
-  READ_INPUT:
-    for (int j = 0; j < hidden_dim; j++) {
+    dtype mean = dtype(0);
+    dtype variance = dtype(0);
+
+    if constexpr (stats_mode == LN_TWO_PASS) {
+    READ_INPUT:
+      for (int j = 0; j < hidden_dim; j++) {
 #pragma HLS PIPELINE II = pipeline_ii
 #pragma HLS LOOP_TRIPCOUNT min = 1 max = 4096
-      input_buffer[j] = input_stream.read();
-    }
+        input_buffer[j] = input_stream.read();
+      }
 
-    dtype mean = dtype(0);
-  CALC_MEAN_STREAM:
-    for (int j = 0; j < hidden_dim; j++) {
+    CALC_MEAN_STREAM:
+      for (int j = 0; j < hidden_dim; j++) {
 #pragma HLS UNROLL factor = unroll_factor
 #pragma HLS BIND_OP variable = mean op = add impl = dsp
-      mean += input_buffer[j];
-    }
-    mean /= dtype(hidden_dim);
+        mean += input_buffer[j];
+      }
+      mean /= dtype(hidden_dim);
 
-    dtype variance = dtype(0);
-  CALC_VARIANCE_STREAM:
-    for (int j = 0; j < hidden_dim; j++) {
+    CALC_VARIANCE_STREAM:
+      for (int j = 0; j < hidden_dim; j++) {
 #pragma HLS UNROLL factor = unroll_factor
 #pragma HLS BIND_OP variable = variance op = add impl = dsp
-      dtype diff = input_buffer[j] - mean;
-      variance += diff * diff;
+        dtype diff = input_buffer[j] - mean;
+        variance += diff * diff;
+      }
+      variance /= dtype(hidden_dim);
+    } else {
+      // Statistics are accumulated while the row is being buffered, so the
+      // normalize loop can start as soon as the last element arrives.
+      Stats stats;
+    READ_STATS:
+      for (int j = 0; j < hidden_dim; j++) {
+#pragma HLS PIPELINE II = pipeline_ii
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 4096
+        dtype val = input_stream.read();
+        input_buffer[j] = val;
+        stats_impl::update(stats, val, j);
+      }
+      stats_finalize(stats, mean, variance);
     }
-    variance /= dtype(hidden_dim);
 
     dtype inv_std = hls::rsqrt(variance + dtype(epsilon));
 
@@ -411,7 +858,134 @@ private:
       output_stream.write(output_val);
     }
   }
+
+  static void add_ln_1d_stream_impl(hls::stream<dtype> &output_stream,
+                                    hls::stream<dtype> &input_stream,
+                                    hls::stream<dtype> &residual_stream,
+                                    const Gamma_t gamma, const Beta_t beta,
+                                    const float epsilon) {
+#pragma HLS INLINE off
+
+    dtype row[hidden_dim];
+
+    constexpr bool should_partition =
+        (partition_factor > 1) && (hidden_dim <= 4096);
+    if constexpr (should_partition) {
+#pragma HLS ARRAY_PARTITION variable = row type = cyclic factor =              \
+    partition_factor
+    } else {
+#pragma HLS BIND_STORAGE variable = row type = ram_2p impl = bram
+    }
+
+    dtype mean = dtype(0);
+    dtype variance = dtype(0);
+
+    if constexpr (stats_mode == LN_TWO_PASS) {
+    READ_ADD:
+      for (int j = 0; j < hidden_dim; j++) {
+#pragma HLS PIPELINE II = pipeline_ii
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 4096
+        row[j] = input_stream.read() + residual_stream.read();
+      }
+      calc_stats(row, mean, variance);
+    } else {
+      Stats stats;
+    READ_ADD_STATS:
+      for (int j = 0; j < hidden_dim; j++) {
+#pragma HLS PIPELINE II = pipeline_ii
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 4096
+        dtype val = input_stream.read() + residual_stream.read();
+        row[j] = val;
+        stats_impl::update(stats, val, j);
+      }
+      stats_finalize(stats, mean, variance);
+    }
+
+    dtype inv_std = hls::rsqrt(variance + dtype(epsilon));
+
+  NORMALIZE_WRITE:
+    for (int j = 0; j < hidden_dim; j++) {
+#pragma HLS PIPELINE II = pipeline_ii
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 4096
+      output_stream.write(gamma[j] * (row[j] - mean) * inv_std + beta[j]);
+    }
+  }
+
+  static void ln_add_1d_stream_impl(hls::stream<dtype> &output_stream,
+                                    hls::stream<dtype> &input_stream,
+                                    hls::stream<dtype> &residual_stream,
+                                    const Gamma_t gamma, const Beta_t beta,
+                                    const float epsilon) {
+#pragma HLS INLINE off
+
+    dtype input_buffer[hidden_dim];
+
+    constexpr bool should_partition =
+        (partition_factor > 1) && (hidden_dim <= 4096);
+    if constexpr (should_partition) {
+#pragma HLS ARRAY_PARTITION variable = input_buffer type = cyclic factor =     \
+    partition_factor
+    } else {
+#pragma HLS BIND_STORAGE variable = input_buffer type = ram_2p impl = bram
+    }
+
+    dtype mean = dtype(0);
+    dtype variance = dtype(0);
+
+    if constexpr (stats_mode == LN_TWO_PASS) {
+    READ_INPUT:
+      for (int j = 0; j < hidden_dim; j++) {
+#pragma HLS PIPELINE II = pipeline_ii
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 4096
+        input_buffer[j] = input_stream.read();
+      }
+      calc_stats(input_buffer, mean, variance);
+    } else {
+      Stats stats;
+    READ_STATS:
+      for (int j = 0; j < hidden_dim; j++) {
+#pragma HLS PIPELINE II = pipeline_ii
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 4096
+        dtype val = input_stream.read();
+        input_buffer[j] = val;
+        stats_impl::update(stats, val, j);
+      }
+      stats_finalize(stats, mean, variance);
+    }
+
+    dtype inv_std = hls::rsqrt(variance + dtype(epsilon));
+
+  NORMALIZE_ADD_WRITE:
+    for (int j = 0; j < hidden_dim; j++) {
+#pragma HLS PIPELINE II = pipeline_ii
+#pragma HLS LOOP_TRIPCOUNT min = 1 max = 4096
+      dtype normed = gamma[j] * (input_buffer[j] - mean) * inv_std + beta[j];
+      output_stream.write(residual_stream.read() + normed);
+    }
+  }
 #endif
+
+  // Single-pass statistics modes map onto multi-output reduce Impls; rows
+  // held in memory go through MultiReduce, loops that produce the row on the
+  // fly fold it in with stats_impl::update.
+  using stats_impl =
+      std::conditional_t<stats_mode == LN_WELFORD,
+                         WelfordImpl<dtype, hidden_dim>,
+                         SumSqImpl<dtype, hidden_dim,
+                                   stats_mode == LN_SUMSQ_KAHAN>>;
+  using stats_reduce = MultiReduce<dtype, ReduceHParams<stats_impl, hidden_dim>,
+                                   Config, OPT_ENABLED>;
+  using Stats = typename stats_impl::State;
+
+  static void stats_finalize(const Stats &stats, dtype &mean,
+                             dtype &variance) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE
+#endif
+    const MeanVar<dtype> result = stats_impl::finalize(stats);
+    mean = result.mean;
+    variance = result.variance;
+  }
 };
 
 } // namespace vhn
@@ -34,9 +34,26 @@ public:
     auto pipeline_ii = hls_cfg.value("pipeline_ii", 1);
     auto unroll_factor = hls_cfg.value("unroll_factor", 4);
     auto partition_factor = hls_cfg.value("partition_factor", 4);
+    auto stats_mode = hls_cfg.value("stats_mode", std::string("two_pass"));
+
+    std::string stats_enum;
+
+    if (stats_mode == "two_pass") {
+      stats_enum = "vhn::LN_TWO_PASS";
+    } else if (stats_mode == "welford") {
+      stats_enum = "vhn::LN_WELFORD";
+    } else if (stats_mode == "sumsq") {
+      stats_enum = "vhn::LN_SUMSQ";
+    } else if (stats_mode == "sumsq_kahan") {
+      stats_enum = "vhn::LN_SUMSQ_KAHAN";
+    } else {
+      throw std::runtime_error("Unsupported LayerNorm stats_mode: " +
+                               stats_mode);
+    }
 
     oss << "using " << name << "_cfg = vhn::LayerNormConfig<";
-    oss << pipeline_ii << ", " << unroll_factor << ", " << partition_factor;
+    oss << pipeline_ii << ", " << unroll_factor << ", " << partition_factor
+        << ", " << stats_enum;
     oss << ">;\n\n";
     return oss.str();
   }
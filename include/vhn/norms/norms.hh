@@ -2,6 +2,7 @@
 
 #include "./batchnorm1d.hh"
 #include "./batchnorm2d.hh"
+#include "./bn_fold.hh"
 #include "./layernorm.hh"
 
 #ifndef __VITIS_HLS__
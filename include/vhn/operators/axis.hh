@@ -0,0 +1,31 @@
+#pragma once
+
+namespace vhn {
+
+// Row-major [D0][D1][D2] tensor (D2 = 1 for [D0][D1]) seen as
+// [outer][len][inner] around AXIS, so element (o, k, j) sits at
+// (o * len + k) * inner + j. Reducing AXIS leaves an [outer][inner] tensor,
+// and a broadcast operand of that shape is reused across the len slices.
+//   [R][C]     AXIS 0: columns (outer 1, inner C)
+//              AXIS 1: rows    (outer R, inner 1)
+//   [C][H][W]  AXIS 0: channels, per-pixel result over C
+//              AXIS 1/2: H or W of every channel
+// Per-channel statistics of [C][H][W] reduce AXIS 1 of [C][H * W].
+template <int AXIS, int D0, int D1, int D2 = 1> struct AxisShape {
+  static_assert(AXIS >= 0 && AXIS <= 2, "AXIS must be 0, 1 or 2");
+  static_assert(D0 > 0 && D1 > 0 && D2 > 0, "Dimensions must be positive");
+
+  static constexpr int axis = AXIS;
+  static constexpr int d0 = D0;
+  static constexpr int d1 = D1;
+  static constexpr int d2 = D2;
+
+  static constexpr int outer = AXIS == 0 ? 1 : (AXIS == 1 ? D0 : D0 * D1);
+  static constexpr int len = AXIS == 0 ? D0 : (AXIS == 1 ? D1 : D2);
+  static constexpr int inner = AXIS == 0 ? D1 * D2 : (AXIS == 1 ? D2 : 1);
+
+  static constexpr int size = D0 * D1 * D2;
+  static constexpr int reduced_size = outer * inner;
+};
+
+} // namespace vhn
@@ -0,0 +1,249 @@
+#pragma once
+
+#include "../opt_level.hh"
+#include "../stream.hh"
+#include "./axis.hh"
+#include "./reduce.hh"
+
+namespace vhn {
+
+template <typename DType, typename HParams, typename Config = void,
+          OptLevel OPT_LEVEL = OPT_NONE>
+class AxisReduce;
+
+// Impl is a Reduce impl sized to the reduced axis, e.g.
+// MeanImpl<T, AxisShape<AXIS, D0, D1, D2>::len>.
+template <typename ImplType, int AXIS, int D0, int D1, int D2 = 1>
+struct AxisReduceHParams : AxisShape<AXIS, D0, D1, D2> {
+  using impl = ImplType;
+};
+
+// ============================================================================
+// Non-optimized version (OPT_NONE) - Sequential
+// ============================================================================
+// Input is read strictly in row-major order: a reduction over the last axis
+// folds each contiguous row, and any other axis keeps one accumulator per
+// inner index and folds whole contiguous slices into it, so columns and
+// channels are reduced without a strided walk or a transpose.
+template <typename DType, typename HParams>
+class AxisReduce<DType, HParams, void, OPT_NONE> {
+public:
+  using dtype = DType;
+  using impl = typename HParams::impl;
+  static constexpr int outer = HParams::outer;
+  static constexpr int len = HParams::len;
+  static constexpr int inner = HParams::inner;
+  static constexpr int size = HParams::size;
+  static constexpr int reduced_size = HParams::reduced_size;
+  static constexpr OptLevel opt_level = OPT_NONE;
+
+  AxisReduce() = default;
+  ~AxisReduce() = default;
+
+  static void reduce(dtype output[reduced_size], const dtype input[size]) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+    reduce_impl(output, input);
+  }
+
+  static void reduce(stream<dtype> &output_stream,
+                     stream<dtype> &input_stream) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+    reduce_stream_impl(output_stream, input_stream);
+  }
+
+private:
+  using row_reduce = Reduce<dtype, ReduceHParams<impl, len>, void, OPT_NONE>;
+
+  static void reduce_impl(dtype *output, const dtype *input) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+  OUTER_LOOP:
+    for (int o = 0; o < outer; o++) {
+      const dtype *slab = &input[o * len * inner];
+      dtype *acc = &output[o * inner];
+
+      if constexpr (inner == 1) {
+        acc[0] = row_reduce::reduce(slab);
+      } else {
+      INIT_LOOP:
+        for (int j = 0; j < inner; j++) {
+          acc[j] = slab[j];
+        }
+      AXIS_LOOP:
+        for (int k = 1; k < len; k++) {
+        INNER_LOOP:
+          for (int j = 0; j < inner; j++) {
+            acc[j] = impl::kernel(acc[j], slab[k * inner + j]);
+          }
+        }
+      FINALIZE_LOOP:
+        for (int j = 0; j < inner; j++) {
+          acc[j] = impl::finalize(acc[j]);
+        }
+      }
+    }
+  }
+
+  static void reduce_stream_impl(stream<dtype> &output_stream,
+                                 stream<dtype> &input_stream) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+    dtype acc[inner];
+
+  OUTER_STREAM_LOOP:
+    for (int o = 0; o < outer; o++) {
+    AXIS_STREAM_LOOP:
+      for (int k = 0; k < len; k++) {
+      INNER_STREAM_LOOP:
+        for (int j = 0; j < inner; j++) {
+          const dtype value = input_stream.read();
+          acc[j] = (k == 0) ? value : impl::kernel(acc[j], value);
+        }
+      }
+    WRITE_STREAM_LOOP:
+      for (int j = 0; j < inner; j++) {
+        output_stream.write(impl::finalize(acc[j]));
+      }
+    }
+  }
+};
+
+// ============================================================================
+// Optimized version (OPT_ENABLED)
+// ============================================================================
+// Takes a ReduceConfig. Last-axis rows go through the optimized Reduce
+// (tree / pipelined accumulator under HLS, multi-accumulator on the host).
+// Other axes pipeline INNER_LOOP over the partitioned accumulator row; the
+// inner accumulators are independent, so there is no loop-carried
+// dependency and the host compiler vectorizes the slice fold directly.
+template <typename DType, typename HParams, typename Config>
+class AxisReduce<DType, HParams, Config, OPT_ENABLED> {
+public:
+  using dtype = DType;
+  using impl = typename HParams::impl;
+  static constexpr int outer = HParams::outer;
+  static constexpr int len = HParams::len;
+  static constexpr int inner = HParams::inner;
+  static constexpr int size = HParams::size;
+  static constexpr int reduced_size = HParams::reduced_size;
+  static constexpr OptLevel opt_level = OPT_ENABLED;
+
+  static constexpr int pipeline_ii = Config::pipeline_ii;
+  static constexpr int unroll_factor = Config::unroll_factor;
+  static constexpr int partition_factor = Config::partition_factor;
+
+  AxisReduce() = default;
+  ~AxisReduce() = default;
+
+  static void reduce(dtype output[reduced_size], const dtype input[size]) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+    reduce_impl(output, input);
+  }
+
+  static void reduce(stream<dtype> &output_stream,
+                     stream<dtype> &input_stream) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+    reduce_stream_impl(output_stream, input_stream);
+  }
+
+private:
+  using row_reduce =
+      Reduce<dtype, ReduceHParams<impl, len>, Config, OPT_ENABLED>;
+
+  static void reduce_impl(dtype *output, const dtype *input) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#pragma HLS ARRAY_PARTITION variable = input cyclic factor = partition_factor
+#pragma HLS ARRAY_PARTITION variable = output cyclic factor = partition_factor
+#endif
+  OUTER_LOOP:
+    for (int o = 0; o < outer; o++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_FLATTEN off
+#endif
+      const dtype *slab = &input[o * len * inner];
+      dtype *acc = &output[o * inner];
+
+      if constexpr (inner == 1) {
+        acc[0] = row_reduce::reduce(slab);
+      } else {
+      INIT_LOOP:
+        for (int j = 0; j < inner; j++) {
+#ifdef __VITIS_HLS__
+#pragma HLS PIPELINE II = pipeline_ii
+#pragma HLS UNROLL factor = unroll_factor
+#endif
+          acc[j] = slab[j];
+        }
+      AXIS_LOOP:
+        for (int k = 1; k < len; k++) {
+          const dtype *row = &slab[k * inner];
+        INNER_LOOP:
+          for (int j = 0; j < inner; j++) {
+#ifdef __VITIS_HLS__
+#pragma HLS PIPELINE II = pipeline_ii
+#pragma HLS UNROLL factor = unroll_factor
+#endif
+            acc[j] = impl::kernel(acc[j], row[j]);
+          }
+        }
+      FINALIZE_LOOP:
+        for (int j = 0; j < inner; j++) {
+#ifdef __VITIS_HLS__
+#pragma HLS PIPELINE II = pipeline_ii
+#pragma HLS UNROLL factor = unroll_factor
+#endif
+          acc[j] = impl::finalize(acc[j]);
+        }
+      }
+    }
+  }
+
+  static void reduce_stream_impl(stream<dtype> &output_stream,
+                                 stream<dtype> &input_stream) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+    dtype acc[inner];
+#ifdef __VITIS_HLS__
+#pragma HLS ARRAY_PARTITION variable = acc cyclic factor = partition_factor
+#endif
+
+  OUTER_STREAM_LOOP:
+    for (int o = 0; o < outer; o++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_FLATTEN off
+#endif
+    AXIS_STREAM_LOOP:
+      for (int k = 0; k < len; k++) {
+      INNER_STREAM_LOOP:
+        for (int j = 0; j < inner; j++) {
+#ifdef __VITIS_HLS__
+#pragma HLS PIPELINE II = pipeline_ii
+#endif
+          const dtype value = input_stream.read();
+          acc[j] = (k == 0) ? value : impl::kernel(acc[j], value);
+        }
+      }
+    WRITE_STREAM_LOOP:
+      for (int j = 0; j < inner; j++) {
+#ifdef __VITIS_HLS__
+#pragma HLS PIPELINE II = pipeline_ii
+#endif
+        output_stream.write(impl::finalize(acc[j]));
+      }
+    }
+  }
+};
+
+} // namespace vhn
@@ -0,0 +1,193 @@
+#pragma once
+
+#include "../opt_level.hh"
+#include "../stream.hh"
+#include "./axis.hh"
+
+namespace vhn {
+
+template <typename DType, typename HParams, typename Config = void,
+          OptLevel OPT_LEVEL = OPT_NONE>
+class Broadcast;
+
+// Impl is a binary elementwise impl (AddImpl, MulImpl, ...). The operand
+// has the reduced [outer][inner] shape and is repeated along AXIS, so the
+// output of AxisReduce over the same AXIS broadcasts straight back:
+//   output[o][k][j] = Impl::kernel(input[o][k][j], operand[o][j])
+template <typename ImplType, int AXIS, int D0, int D1, int D2 = 1>
+struct BroadcastHParams : AxisShape<AXIS, D0, D1, D2> {
+  using impl = ImplType;
+};
+
+// ============================================================================
+// Non-optimized version (OPT_NONE) - Sequential
+// ============================================================================
+// Input and output are walked in row-major order. A broadcast along the
+// last axis (per-row / per-channel) reads one operand value per row; any
+// other axis re-reads the same contiguous operand row for every slice.
+template <typename DType, typename HParams>
+class Broadcast<DType, HParams, void, OPT_NONE> {
+public:
+  using dtype = DType;
+  using impl = typename HParams::impl;
+  static constexpr int outer = HParams::outer;
+  static constexpr int len = HParams::len;
+  static constexpr int inner = HParams::inner;
+  static constexpr int size = HParams::size;
+  static constexpr int operand_size = HParams::reduced_size;
+  static constexpr OptLevel opt_level = OPT_NONE;
+
+  Broadcast() = default;
+  ~Broadcast() = default;
+
+  static void elem(dtype output[size], const dtype input[size],
+                   const dtype operand[operand_size]) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+    elem_impl(output, input, operand);
+  }
+
+  static void elem(stream<dtype> &output_stream, stream<dtype> &input_stream,
+                   const dtype operand[operand_size]) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+  OUTER_STREAM_LOOP:
+    for (int o = 0; o < outer; o++) {
+    AXIS_STREAM_LOOP:
+      for (int k = 0; k < len; k++) {
+      INNER_STREAM_LOOP:
+        for (int j = 0; j < inner; j++) {
+          output_stream.write(
+              impl::kernel(input_stream.read(), operand[o * inner + j]));
+        }
+      }
+    }
+  }
+
+private:
+  static void elem_impl(dtype *output, const dtype *input,
+                        const dtype *operand) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+  OUTER_LOOP:
+    for (int o = 0; o < outer; o++) {
+      const dtype *row = &operand[o * inner];
+    AXIS_LOOP:
+      for (int k = 0; k < len; k++) {
+        const int base = (o * len + k) * inner;
+      INNER_LOOP:
+        for (int j = 0; j < inner; j++) {
+          output[base + j] = impl::kernel(input[base + j], row[j]);
+        }
+      }
+    }
+  }
+};
+
+// ============================================================================
+// Optimized version (OPT_ENABLED)
+// ============================================================================
+// Takes an ElementwiseConfig. The last-axis case hoists the operand value
+// and pipelines the contiguous row; otherwise the operand row is
+// partitioned alongside input / output and INNER_LOOP is pipelined.
+template <typename DType, typename HParams, typename Config>
+class Broadcast<DType, HParams, Config, OPT_ENABLED> {
+public:
+  using dtype = DType;
+  using impl = typename HParams::impl;
+  static constexpr int outer = HParams::outer;
+  static constexpr int len = HParams::len;
+  static constexpr int inner = HParams::inner;
+  static constexpr int size = HParams::size;
+  static constexpr int operand_size = HParams::reduced_size;
+  static constexpr OptLevel opt_level = OPT_ENABLED;
+
+  static constexpr int pipeline_ii = Config::pipeline_ii;
+  static constexpr int unroll_factor = Config::unroll_factor;
+  static constexpr int partition_factor = Config::partition_factor;
+
+  Broadcast() = default;
+  ~Broadcast() = default;
+
+  static void elem(dtype output[size], const dtype input[size],
+                   const dtype operand[operand_size]) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+    elem_impl(output, input, operand);
+  }
+
+  static void elem(stream<dtype> &output_stream, stream<dtype> &input_stream,
+                   const dtype operand[operand_size]) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#pragma HLS ARRAY_PARTITION variable = operand cyclic factor = partition_factor
+#endif
+  OUTER_STREAM_LOOP:
+    for (int o = 0; o < outer; o++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_FLATTEN off
+#endif
+    AXIS_STREAM_LOOP:
+      for (int k = 0; k < len; k++) {
+      INNER_STREAM_LOOP:
+        for (int j = 0; j < inner; j++) {
+#ifdef __VITIS_HLS__
+#pragma HLS PIPELINE II = pipeline_ii
+#endif
+          output_stream.write(
+              impl::kernel(input_stream.read(), operand[o * inner + j]));
+        }
+      }
+    }
+  }
+
+private:
+  static void elem_impl(dtype *output, const dtype *input,
+                        const dtype *operand) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#pragma HLS ARRAY_PARTITION variable = input cyclic factor = partition_factor
+#pragma HLS ARRAY_PARTITION variable = output cyclic factor = partition_factor
+#pragma HLS ARRAY_PARTITION variable = operand cyclic factor = partition_factor
+#endif
+  OUTER_LOOP:
+    for (int o = 0; o < outer; o++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_FLATTEN off
+#endif
+      const dtype *slab = &input[o * len * inner];
+      dtype *out = &output[o * len * inner];
+
+      if constexpr (inner == 1) {
+        const dtype value = operand[o];
+      ROW_LOOP:
+        for (int k = 0; k < len; k++) {
+#ifdef __VITIS_HLS__
+#pragma HLS PIPELINE II = pipeline_ii
+#pragma HLS UNROLL factor = unroll_factor
+#endif
+          out[k] = impl::kernel(slab[k], value);
+        }
+      } else {
+        const dtype *row = &operand[o * inner];
+      AXIS_LOOP:
+        for (int k = 0; k < len; k++) {
+        INNER_LOOP:
+          for (int j = 0; j < inner; j++) {
+#ifdef __VITIS_HLS__
+#pragma HLS PIPELINE II = pipeline_ii
+#pragma HLS UNROLL factor = unroll_factor
+#endif
+            out[k * inner + j] = impl::kernel(slab[k * inner + j], row[j]);
+          }
+        }
+      }
+    }
+  }
+};
+
+} // namespace vhn
@@ -0,0 +1,101 @@
+#pragma once
+
+#ifndef __VITIS_HLS__
+#include "../builder/builder.hh"
+#include <sstream>
+
+namespace vhn {
+
+// "shape" is [D0, D1] or [D0, D1, D2] (row-major) and "axis" the dimension
+// the operand is repeated along, e.g. {"shape": [16, 64], "axis": 0,
+// "op": "add"} adds a 64-wide bias to every row.
+class BroadcastBuilder : public BaseBuilder {
+public:
+  std::string generate_hparams(const std::string &name,
+                               const std::string &dtype,
+                               const json &hparams) const override {
+    std::ostringstream oss;
+    NECESSARY_HPARAMS("Broadcast", name, "shape")
+    NECESSARY_HPARAMS("Broadcast", name, "axis")
+    NECESSARY_HPARAMS("Broadcast", name, "op")
+
+    const std::string shape = shape_args(name, hparams["shape"]);
+    int axis = hparams["axis"].get<int>();
+    std::string op = hparams["op"].get<std::string>();
+
+    std::string impl_class;
+
+    if (op == "add") {
+      impl_class = "vhn::AddImpl";
+    } else if (op == "sub") {
+      impl_class = "vhn::SubImpl";
+    } else if (op == "mul") {
+      impl_class = "vhn::MulImpl";
+    } else if (op == "max") {
+      impl_class = "vhn::MaxImpl";
+    } else if (op == "min") {
+      impl_class = "vhn::MinImpl";
+    } else {
+      throw std::runtime_error("Unsupported broadcast operation: " + op);
+    }
+
+    oss << "using " << name << "_hparams = vhn::BroadcastHParams<"
+        << impl_class << "<" << dtype << ", vhn::AxisShape<" << axis << ", "
+        << shape << ">::size>, " << axis << ", " << shape << ">;\n";
+
+    return oss.str();
+  }
+
+  std::string generate_config(const std::string &name,
+                              const json &hls_cfg) const override {
+    if (hls_cfg.empty() || hls_cfg.is_null()) {
+      return "";
+    }
+
+    std::ostringstream oss;
+
+    auto pipeline_ii = hls_cfg.value("pipeline_ii", 1);
+    auto unroll_factor = hls_cfg.value("unroll_factor", 4);
+    auto partition_factor = hls_cfg.value("partition_factor", 4);
+
+    oss << "using " << name << "_cfg = vhn::ElementwiseConfig<";
+    oss << pipeline_ii << ", " << unroll_factor << ", " << partition_factor;
+    oss << ">;\n\n";
+
+    return oss.str();
+  }
+
+  std::string generate_type_alias(const std::string &name,
+                                  const std::string &dtype,
+                                  const json &hls_cfg) const override {
+    std::ostringstream oss;
+
+    std::string opt_level = "OPT_NONE";
+
+    if (!hls_cfg.empty() && !hls_cfg.is_null()) {
+      opt_level = "OPT_ENABLED";
+    }
+
+    std::string config_type =
+        (opt_level == "OPT_NONE") ? "void" : (name + "_cfg");
+
+    GENERATE_TYPE_ALIAS(oss, "Broadcast", name, dtype, opt_level)
+    return oss.str();
+  }
+
+private:
+  static std::string shape_args(const std::string &name, const json &shape) {
+    if (!shape.is_array() || shape.size() < 2 || shape.size() > 3) {
+      throw std::runtime_error("Broadcast module '" + name +
+                               "' needs a 2D or 3D shape");
+    }
+    std::string args;
+    for (const auto &dim : shape) {
+      args += (args.empty() ? "" : ", ") + std::to_string(dim.get<int>());
+    }
+    return args;
+  }
+};
+
+} // namespace vhn
+#endif
@@ -1,10 +1,8 @@
 #pragma once
 
 #include "../opt_level.hh"
-
-#ifdef __VITIS_HLS__
-#include <hls_stream.h>
-#endif
+#include "../stream.hh"
+#include <type_traits>
 
 namespace vhn {
 
@@ -152,6 +150,30 @@ public:
     }
   }
 
+  // Fused chains taking two or more extra operands (see FusedImpl). Each
+  // operand is an array of n elements or a dtype scalar broadcast over it.
+  template <typename... Operands>
+  static void elem(dtype output[n], const dtype input[n],
+                   const Operands... operands) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+    elem_fused_1d_impl(output, input, operands...);
+  }
+
+  // Reads one element of the input and of every operand stream per
+  // iteration, so a fused chain needs no row buffer.
+  template <typename... Streams>
+  static void elem(stream<dtype> &output_stream, stream<dtype> &input_stream,
+                   Streams &...operand_streams) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+    static_assert((std::is_same<Streams, stream<dtype>>::value && ...),
+                  "Elementwise operand streams must carry dtype");
+    elem_fused_stream_impl(output_stream, input_stream, operand_streams...);
+  }
+
 #ifdef __VITIS_HLS__
   static void elem(hls::stream<dtype> &output_stream,
                    hls::stream<dtype> &input_stream) {
@@ -227,6 +249,34 @@ private:
     }
   }
 
+  static dtype operand_at(const dtype *operand, const int i) {
+    return operand[i];
+  }
+  static dtype operand_at(const dtype operand, const int) { return operand; }
+
+  template <typename... Operands>
+  static void elem_fused_1d_impl(dtype *output, const dtype *input,
+                                 const Operands... operands) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+  ELEMENTWISE_FUSED_LOOP:
+    for (int i = 0; i < n; i++) {
+      output[i] = impl::kernel(input[i], operand_at(operands, i)...);
+    }
+  }
+
+  template <typename... Streams>
+  static void elem_fused_stream_impl(stream<dtype> &output_stream,
+                                     stream<dtype> &input_stream,
+                                     Streams &...operand_streams) {
+  ELEMENTWISE_FUSED_STREAM_LOOP:
+    for (int i = 0; i < n; i++) {
+      const dtype x = input_stream.read();
+      output_stream.write(impl::kernel(x, operand_streams.read()...));
+    }
+  }
+
 #ifdef __VITIS_HLS__
   static void elem_1d_stream_impl(hls::stream<dtype> &output_stream,
                                   hls::stream<dtype> &input_stream) {
@@ -414,6 +464,30 @@ public:
     }
   }
 
+  // Fused chains taking two or more extra operands (see FusedImpl). Each
+  // operand is an array of n elements or a dtype scalar broadcast over it.
+  template <typename... Operands>
+  static void elem(dtype output[n], const dtype input[n],
+                   const Operands... operands) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+    elem_fused_1d_impl(output, input, operands...);
+  }
+
+  // Reads one element of the input and of every operand stream per
+  // iteration, so a fused chain needs no row buffer.
+  template <typename... Streams>
+  static void elem(stream<dtype> &output_stream, stream<dtype> &input_stream,
+                   Streams &...operand_streams) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+    static_assert((std::is_same<Streams, stream<dtype>>::value && ...),
+                  "Elementwise operand streams must carry dtype");
+    elem_fused_stream_impl(output_stream, input_stream, operand_streams...);
+  }
+
 #ifdef __VITIS_HLS__
   static void elem(hls::stream<dtype> &output_stream,
                    hls::stream<dtype> &input_stream) {
@@ -513,6 +587,43 @@ private:
     }
   }
 
+  static dtype operand_at(const dtype *operand, const int i) {
+    return operand[i];
+  }
+  static dtype operand_at(const dtype operand, const int) { return operand; }
+
+  template <typename... Operands>
+  static void elem_fused_1d_impl(dtype *output, const dtype *input,
+                                 const Operands... operands) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#pragma HLS ARRAY_PARTITION variable = output cyclic factor = partition_factor
+#pragma HLS ARRAY_PARTITION variable = input cyclic factor = partition_factor
+#endif
+  ELEMENTWISE_FUSED_LOOP:
+    for (int i = 0; i < n; i++) {
+#ifdef __VITIS_HLS__
+#pragma HLS PIPELINE II = pipeline_ii
+#pragma HLS UNROLL factor = unroll_factor
+#endif
+      output[i] = impl::kernel(input[i], operand_at(operands, i)...);
+    }
+  }
+
+  template <typename... Streams>
+  static void elem_fused_stream_impl(stream<dtype> &output_stream,
+                                     stream<dtype> &input_stream,
+                                     Streams &...operand_streams) {
+  ELEMENTWISE_FUSED_STREAM_LOOP:
+    for (int i = 0; i < n; i++) {
+#ifdef __VITIS_HLS__
+#pragma HLS PIPELINE II = pipeline_ii
+#endif
+      const dtype x = input_stream.read();
+      output_stream.write(impl::kernel(x, operand_streams.read()...));
+    }
+  }
+
 #ifdef __VITIS_HLS__
   static void elem_1d_stream_impl(hls::stream<dtype> &output_stream,
                                   hls::stream<dtype> &input_stream) {
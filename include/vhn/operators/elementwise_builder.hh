@@ -6,6 +6,8 @@
 
 namespace vhn {
 
+// "op" is a single operation or, for a fused chain, an array applied left
+// to right, e.g. ["add", "mul", "relu"] -> relu((x + a) * b) in one pass.
 class ElementwiseBuilder : public BaseBuilder {
 public:
   std::string generate_hparams(const std::string &name,
@@ -16,22 +18,27 @@ public:
     NECESSARY_HPARAMS("Elementwise", name, "op")
 
     int n = hparams["n"].get<int>();
-    std::string op = hparams["op"].get<std::string>();
-
-    std::string impl_class;
-
-    if (op == "relu") {
-      impl_class = "vhn::ReLUImpl";
-    } else if (op == "sigmoid") {
-      impl_class = "vhn::SigmoidImpl";
-    } else if (op == "gelu") {
-      impl_class = "vhn::GeLUImpl";
+    const json &op = hparams["op"];
+
+    std::string impl_type;
+
+    if (op.is_array()) {
+      if (op.empty()) {
+        throw std::runtime_error("Elementwise module '" + name +
+                                 "' has an empty op chain");
+      }
+      impl_type = "vhn::FusedImpl<" + dtype + ", " + std::to_string(n);
+      for (const auto &stage : op) {
+        impl_type += ", " + impl_class(stage.get<std::string>());
+      }
+      impl_type += ">";
     } else {
-      throw std::runtime_error("Unsupported elementwise operation: " + op);
+      impl_type = impl_class(op.get<std::string>()) + "<" + dtype + ", " +
+                  std::to_string(n) + ">";
     }
 
     oss << "using " << name << "_hparams = vhn::ElementwiseHParams<"
-        << impl_class << "<" << dtype << ", " << n << ">, " << n << ">;\n";
+        << impl_type << ", " << n << ">;\n";
 
     return oss.str();
   }
@@ -72,6 +79,28 @@ public:
     GENERATE_TYPE_ALIAS(oss, "Elementwise", name, dtype, opt_level)
     return oss.str();
   }
+
+private:
+  static std::string impl_class(const std::string &op) {
+    if (op == "relu") {
+      return "vhn::ReLUImpl";
+    } else if (op == "sigmoid") {
+      return "vhn::SigmoidImpl";
+    } else if (op == "gelu") {
+      return "vhn::GeLUImpl";
+    } else if (op == "add") {
+      return "vhn::AddImpl";
+    } else if (op == "sub") {
+      return "vhn::SubImpl";
+    } else if (op == "mul") {
+      return "vhn::MulImpl";
+    } else if (op == "max") {
+      return "vhn::MaxImpl";
+    } else if (op == "min") {
+      return "vhn::MinImpl";
+    }
+    throw std::runtime_error("Unsupported elementwise operation: " + op);
+  }
 };
 
 } // namespace vhn
@@ -0,0 +1,474 @@
+#pragma once
+
+#include "../opt_level.hh"
+#include "../stream.hh"
+#include "./reduce.hh"
+#include <cmath>
+
+#ifdef __VITIS_HLS__
+#include <hls_math.h>
+#endif
+
+namespace vhn {
+
+// ============================================================================
+// Multi-output reductions
+// ============================================================================
+// A multi-output Impl carries a State through one sweep and finalizes it into
+// a Result holding every statistic the caller needs:
+//   State                          empty on default construction
+//   update(State &, x, i)          fold in element x at row index i
+//   combine(const State &, ...)    merge two partial states (any order)
+//   finalize(const State &)        -> Result
+// combine lets MultiReduce split a row over independent partial states.
+// Kernels that produce a row on the fly (e.g. residual add + LayerNorm) call
+// update directly from their own loop instead.
+
+template <typename DType> struct MeanVar {
+  DType mean;
+  DType variance;
+};
+
+template <typename DType> struct ValueIndex {
+  DType value;
+  int index;
+};
+
+template <typename DType> struct MaxSumExp {
+  DType max;
+  DType sum; // sum of exp(x - max)
+};
+
+// Welford running mean / M2, merged with Chan's parallel update.
+template <typename DType, int N> class WelfordImpl {
+public:
+  using dtype = DType;
+  static constexpr int n = N;
+
+  struct State {
+    int count = 0;
+    dtype mean = dtype(0);
+    dtype m2 = dtype(0);
+  };
+  using Result = MeanVar<dtype>;
+
+  static void update(State &state, const dtype x, const int) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE
+#endif
+    state.count++;
+    const dtype delta = x - state.mean;
+    state.mean += delta / dtype(state.count);
+    state.m2 += delta * (x - state.mean);
+  }
+
+  static State combine(const State &a, const State &b) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE
+#endif
+    if (b.count == 0) {
+      return a;
+    }
+    if (a.count == 0) {
+      return b;
+    }
+    State merged;
+    merged.count = a.count + b.count;
+    const dtype delta = b.mean - a.mean;
+    const dtype weight = dtype(b.count) / dtype(merged.count);
+    merged.mean = a.mean + delta * weight;
+    merged.m2 = a.m2 + b.m2 + delta * delta * dtype(a.count) * weight;
+    return merged;
+  }
+
+  static Result finalize(const State &state) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE
+#endif
+    return {state.mean, state.m2 / dtype(state.count)};
+  }
+};
+
+// Sum and sum of squares, shifted by the first element seen so they do not
+// cancel catastrophically when |mean| >> std. KAHAN compensates both sums.
+template <typename DType, int N, bool KAHAN = false> class SumSqImpl {
+public:
+  using dtype = DType;
+  static constexpr int n = N;
+  static constexpr bool kahan = KAHAN;
+
+  struct State {
+    int count = 0;
+    dtype shift = dtype(0);
+    dtype sum = dtype(0);
+    dtype sum_sq = dtype(0);
+    dtype comp = dtype(0);
+    dtype comp_sq = dtype(0);
+  };
+  using Result = MeanVar<dtype>;
+
+  static void update(State &state, const dtype x, const int) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE
+#endif
+    if (state.count == 0) {
+      state.shift = x;
+    }
+    state.count++;
+    const dtype diff = x - state.shift;
+    accumulate(state.sum, state.comp, diff);
+    accumulate(state.sum_sq, state.comp_sq, diff * diff);
+  }
+
+  static State combine(const State &a, const State &b) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE
+#endif
+    if (b.count == 0) {
+      return a;
+    }
+    if (a.count == 0) {
+      return b;
+    }
+    // Re-express b's sums relative to a's shift before adding them.
+    const dtype d = b.shift - a.shift;
+    const dtype b_sum = b.sum - b.comp;
+    const dtype b_sum_sq = b.sum_sq - b.comp_sq;
+    State merged = a;
+    merged.count = a.count + b.count;
+    accumulate(merged.sum, merged.comp, b_sum + dtype(b.count) * d);
+    accumulate(merged.sum_sq, merged.comp_sq,
+               b_sum_sq + dtype(2) * d * b_sum + dtype(b.count) * d * d);
+    return merged;
+  }
+
+  static Result finalize(const State &state) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE
+#endif
+    const dtype shifted_mean = state.sum / dtype(state.count);
+    dtype variance =
+        state.sum_sq / dtype(state.count) - shifted_mean * shifted_mean;
+    if (variance < dtype(0)) {
+      variance = dtype(0);
+    }
+    return {state.shift + shifted_mean, variance};
+  }
+
+private:
+  static void accumulate(dtype &sum, dtype &comp, const dtype value) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE
+#endif
+    if constexpr (kahan) {
+      const dtype y = value - comp;
+      const dtype t = sum + y;
+      comp = (t - sum) - y;
+      sum = t;
+    } else {
+      sum += value;
+    }
+  }
+};
+
+// Maximum and the index of its first occurrence.
+template <typename DType, int N> class MaxArgMaxImpl {
+public:
+  using dtype = DType;
+  static constexpr int n = N;
+
+  struct State {
+    dtype value = dtype(0);
+    int index = -1;
+  };
+  using Result = ValueIndex<dtype>;
+
+  static void update(State &state, const dtype x, const int i) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE
+#endif
+    if (state.index < 0 || x > state.value) {
+      state.value = x;
+      state.index = i;
+    }
+  }
+
+  static State combine(const State &a, const State &b) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE
+#endif
+    if (b.index < 0) {
+      return a;
+    }
+    if (a.index < 0) {
+      return b;
+    }
+    if (b.value > a.value || (b.value == a.value && b.index < a.index)) {
+      return b;
+    }
+    return a;
+  }
+
+  static Result finalize(const State &state) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE
+#endif
+    return {state.value, state.index};
+  }
+};
+
+// Online softmax statistics: running maximum and the sum of exp(x - max),
+// rescaled whenever the maximum moves.
+template <typename DType, int N> class MaxSumExpImpl {
+public:
+  using dtype = DType;
+  static constexpr int n = N;
+
+  struct State {
+    int count = 0;
+    dtype max = dtype(0);
+    dtype sum = dtype(0);
+  };
+  using Result = MaxSumExp<dtype>;
+
+  static void update(State &state, const dtype x, const int) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE
+#endif
+    if (state.count == 0) {
+      state.max = x;
+      state.sum = dtype(1);
+    } else if (x > state.max) {
+      state.sum = state.sum * exp(state.max - x) + dtype(1);
+      state.max = x;
+    } else {
+      state.sum += exp(x - state.max);
+    }
+    state.count++;
+  }
+
+  static State combine(const State &a, const State &b) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE
+#endif
+    if (b.count == 0) {
+      return a;
+    }
+    if (a.count == 0) {
+      return b;
+    }
+    State merged;
+    merged.count = a.count + b.count;
+    merged.max = a.max > b.max ? a.max : b.max;
+    merged.sum =
+        a.sum * exp(a.max - merged.max) + b.sum * exp(b.max - merged.max);
+    return merged;
+  }
+
+  static Result finalize(const State &state) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE
+#endif
+    return {state.max, state.sum};
+  }
+
+  static dtype exp(const dtype x) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE
+    return hls::exp(x);
+#else
+    return std::exp(x);
+#endif
+  }
+};
+
+template <typename DType, typename HParams, typename Config = void,
+          OptLevel OPT_LEVEL = OPT_NONE>
+class MultiReduce;
+
+// ============================================================================
+// Non-optimized version (OPT_NONE) - Sequential
+// ============================================================================
+template <typename DType, typename HParams>
+class MultiReduce<DType, HParams, void, OPT_NONE> {
+public:
+  using dtype = DType;
+  using impl = typename HParams::impl;
+  using State = typename impl::State;
+  using Result = typename impl::Result;
+  static constexpr int n = HParams::n;
+  static constexpr OptLevel opt_level = OPT_NONE;
+
+  MultiReduce() = default;
+  ~MultiReduce() = default;
+
+  static Result reduce(const dtype input[n]) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+    return reduce_sequential(input);
+  }
+
+  static void reduce(Result output[], const dtype input[][n],
+                     const int batch_size) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+  BATCH_LOOP:
+    for (int b = 0; b < batch_size; b++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_FLATTEN off
+#endif
+      output[b] = reduce_sequential(input[b]);
+    }
+  }
+
+  static Result reduce(stream<dtype> &input_stream) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+    State state;
+  REDUCE_STREAM_LOOP:
+    for (int i = 0; i < n; i++) {
+      impl::update(state, input_stream.read(), i);
+    }
+    return impl::finalize(state);
+  }
+
+private:
+  static Result reduce_sequential(const dtype *input) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+    State state;
+  REDUCE_LOOP:
+    for (int i = 0; i < n; i++) {
+      impl::update(state, input[i], i);
+    }
+    return impl::finalize(state);
+  }
+};
+
+// ============================================================================
+// Optimized version (OPT_ENABLED) - Partial states
+// ============================================================================
+// Element i is folded into partial state i % lanes, which breaks the
+// loop-carried dependency of update (unroll_factor lanes under HLS, a fixed
+// eight on the host), and the partial states are merged by an in-place
+// pairwise combine. Works with any Config carrying pipeline_ii,
+// unroll_factor and partition_factor, so kernels can pass their own.
+template <typename DType, typename HParams, typename Config>
+class MultiReduce<DType, HParams, Config, OPT_ENABLED> {
+public:
+  using dtype = DType;
+  using impl = typename HParams::impl;
+  using State = typename impl::State;
+  using Result = typename impl::Result;
+  static constexpr int n = HParams::n;
+  static constexpr OptLevel opt_level = OPT_ENABLED;
+
+  static constexpr int pipeline_ii = Config::pipeline_ii;
+  static constexpr int unroll_factor = Config::unroll_factor;
+  static constexpr int partition_factor = Config::partition_factor;
+
+#ifdef __VITIS_HLS__
+  static constexpr int max_lanes = unroll_factor > 1 ? unroll_factor : 1;
+#else
+  static constexpr int max_lanes = 8;
+#endif
+  static constexpr int lanes = prev_power_of_2(n < max_lanes ? n : max_lanes);
+
+  MultiReduce() = default;
+  ~MultiReduce() = default;
+
+  static Result reduce(const dtype input[n]) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+    return reduce_lanes(input);
+  }
+
+  static void reduce(Result output[], const dtype input[][n],
+                     const int batch_size) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+  BATCH_LOOP:
+    for (int b = 0; b < batch_size; b++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_FLATTEN off
+#endif
+      output[b] = reduce_lanes(input[b]);
+    }
+  }
+
+  static Result reduce(stream<dtype> &input_stream) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+    State partial[lanes];
+#ifdef __VITIS_HLS__
+#pragma HLS ARRAY_PARTITION variable = partial complete
+#endif
+  REDUCE_STREAM_LOOP:
+    for (int i = 0; i < n; i++) {
+#ifdef __VITIS_HLS__
+#pragma HLS PIPELINE II = pipeline_ii
+#pragma HLS DEPENDENCE variable = partial inter false
+#endif
+      impl::update(partial[i % lanes], input_stream.read(), i);
+    }
+    return impl::finalize(combine_lanes(partial));
+  }
+
+private:
+  static Result reduce_lanes(const dtype *input) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#pragma HLS ARRAY_PARTITION variable = input cyclic factor = partition_factor
+#endif
+    State partial[lanes];
+#ifdef __VITIS_HLS__
+#pragma HLS ARRAY_PARTITION variable = partial complete
+#endif
+
+    int i = 0;
+  BLOCK_LOOP:
+    for (; i + lanes <= n; i += lanes) {
+#ifdef __VITIS_HLS__
+#pragma HLS PIPELINE II = pipeline_ii
+#endif
+    LANE_LOOP:
+      for (int l = 0; l < lanes; l++) {
+        impl::update(partial[l], input[i + l], i + l);
+      }
+    }
+  TAIL_LOOP:
+    for (int l = 0; i + l < n; l++) {
+      impl::update(partial[l], input[i + l], i + l);
+    }
+
+    return impl::finalize(combine_lanes(partial));
+  }
+
+  static State combine_lanes(State partial[lanes]) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE
+#endif
+  COMBINE_LOOP:
+    for (int width = lanes / 2; width > 0; width /= 2) {
+#ifdef __VITIS_HLS__
+#pragma HLS UNROLL
+#endif
+      for (int l = 0; l < width; l++) {
+#ifdef __VITIS_HLS__
+#pragma HLS UNROLL
+#endif
+        partial[l] = impl::combine(partial[l], partial[l + width]);
+      }
+    }
+    return partial[0];
+  }
+};
+
+} // namespace vhn
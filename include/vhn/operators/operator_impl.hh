@@ -1,6 +1,10 @@
 #pragma once
 
 #include "./elementwise.hh"
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
 
 #ifdef __VITIS_HLS__
 #endif
@@ -65,4 +69,73 @@ public:
   static dtype finalize(const dtype x) { return x / n; }
 };
 
+// True for two-operand kernels (x op y), false for activations.
+template <typename Impl, typename = void>
+struct is_binary_impl : std::false_type {};
+
+template <typename Impl>
+struct is_binary_impl<
+    Impl, std::void_t<decltype(Impl::kernel(
+              std::declval<typename Impl::dtype>(),
+              std::declval<typename Impl::dtype>()))>> : std::true_type {};
+
+// Compile-time composition of elementwise kernels, so a chain runs as one
+// loop in Elementwise instead of one pass over memory per op. Stages apply
+// left to right and every binary stage consumes the next operand:
+//   FusedImpl<T, N, AddImpl, MulImpl, ReLUImpl>::kernel(x, a, b)
+//     == relu((x + a) * b)
+template <typename DType, int N, template <typename, int> class... Stages>
+class FusedImpl {
+public:
+  using dtype = DType;
+  static constexpr int n = N;
+  static constexpr int num_stages = sizeof...(Stages);
+  static constexpr int num_operands =
+      1 + (0 + ... + int(is_binary_impl<Stages<DType, N>>::value));
+
+  static_assert(num_stages > 0, "FusedImpl needs at least one stage");
+
+  template <typename... Operands>
+  static dtype kernel(const dtype x, const Operands... operands) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE
+#endif
+    static_assert(sizeof...(Operands) + 1 == num_operands,
+                  "FusedImpl called with the wrong number of operands");
+    const dtype args[num_operands] = {x, dtype(operands)...};
+    return apply(args, std::make_index_sequence<num_stages>());
+  }
+
+private:
+  using stages = std::tuple<Stages<DType, N>...>;
+  static constexpr bool binary[num_stages] = {
+      is_binary_impl<Stages<DType, N>>::value...};
+
+  // Index into args of the operand consumed by stage `s`.
+  static constexpr int operand_index(const std::size_t s) {
+    int index = 1;
+    for (std::size_t i = 0; i < s; i++) {
+      index += binary[i] ? 1 : 0;
+    }
+    return index;
+  }
+
+  template <std::size_t S>
+  static dtype stage(const dtype value, const dtype args[]) {
+    using impl = std::tuple_element_t<S, stages>;
+    if constexpr (binary[S]) {
+      return impl::kernel(value, args[operand_index(S)]);
+    } else {
+      return impl::kernel(value);
+    }
+  }
+
+  template <std::size_t... S>
+  static dtype apply(const dtype args[], std::index_sequence<S...>) {
+    dtype value = args[0];
+    ((value = stage<S>(value, args)), ...);
+    return value;
+  }
+};
+
 } // namespace vhn
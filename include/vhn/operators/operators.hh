@@ -9,10 +9,38 @@ ELEMENTWISE_REGISTRY(Add)
 ELEMENTWISE_REGISTRY(Sub)
 ELEMENTWISE_REGISTRY(Mul)
 
+// Elementwise over a FusedImpl chain, e.g.
+// Fused<float, N, Config, OPT_ENABLED, AddImpl, MulImpl, ReLUImpl>.
+template <typename DType, int N, typename Config, OptLevel OPT_LEVEL,
+          template <typename, int> class... Stages>
+using Fused = Elementwise<
+    DType, ElementwiseHParams<FusedImpl<DType, N, Stages...>, N>, Config,
+    OPT_LEVEL>;
+
 REDUCE_REGISTRY(Max)
 REDUCE_REGISTRY(Min)
 REDUCE_REGISTRY(Sum)
 REDUCE_REGISTRY(Mean)
+
+MULTI_REDUCE_REGISTRY(Welford)
+MULTI_REDUCE_REGISTRY(SumSq)
+MULTI_REDUCE_REGISTRY(MaxArgMax)
+MULTI_REDUCE_REGISTRY(MaxSumExp)
+
+// Value and first index of the maximum; OPT_ENABLED tracks per-lane partial
+// maxima and merges them in a tree. TopK covers the k > 1 case.
+template <typename DType, int N, typename Config = void,
+          OptLevel OPT_LEVEL = OPT_NONE>
+using ArgMax = ReduceMaxArgMax<DType, N, Config, OPT_LEVEL>;
+
+AXIS_REDUCE_REGISTRY(Max)
+AXIS_REDUCE_REGISTRY(Min)
+AXIS_REDUCE_REGISTRY(Sum)
+AXIS_REDUCE_REGISTRY(Mean)
+
+BROADCAST_REGISTRY(Add)
+BROADCAST_REGISTRY(Sub)
+BROADCAST_REGISTRY(Mul)
 } // namespace vhn
 
 namespace vhn::tb {
@@ -28,9 +56,15 @@ REDUCE_TB_REGISTRY(Mean)
 
 // Builders
 #ifndef __VITIS_HLS__
+#include "./axis_reduce_builder.hh"
+#include "./broadcast_builder.hh"
 #include "./elementwise_builder.hh"
 #include "./reduce_builder.hh"
+#include "./topk_builder.hh"
 
 REGISTER_LAYER_BUILDER("elementwise", ElementwiseBuilder)
 REGISTER_LAYER_BUILDER("reduce", ReduceBuilder)
+REGISTER_LAYER_BUILDER("axis_reduce", AxisReduceBuilder)
+REGISTER_LAYER_BUILDER("broadcast", BroadcastBuilder)
+REGISTER_LAYER_BUILDER("topk", TopKBuilder)
 #endif
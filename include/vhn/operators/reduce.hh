@@ -22,6 +22,9 @@ constexpr bool is_power_of_2(int x) { return (x & (x - 1)) == 0; }
 constexpr int next_power_of_2(int x) {
   return is_power_of_2(x) ? x : 1 << log2_ceil(x);
 }
+constexpr int prev_power_of_2(int x) {
+  return is_power_of_2(x) ? x : next_power_of_2(x) / 2;
+}
 
 // ============================================================================
 // Non-optimized version (OPT_NONE) - Always Sequential
@@ -110,10 +113,10 @@ private:
 #ifdef __VITIS_HLS__
 #pragma HLS INLINE off
 #endif
-    dtype acc = dtype(0);
+    dtype acc = input[0];
 
   REDUCE_LOOP:
-    for (int i = 0; i < n; i++) {
+    for (int i = 1; i < n; i++) {
       acc = impl::kernel(acc, input[i]);
     }
 
@@ -131,9 +134,9 @@ private:
       input_buffer[i] = input_stream.read();
     }
 
-    dtype acc = dtype(0);
+    dtype acc = input_buffer[0];
   REDUCE_STREAM_LOOP:
-    for (int i = 0; i < n; i++) {
+    for (int i = 1; i < n; i++) {
       acc = impl::kernel(acc, input_buffer[i]);
     }
 
@@ -154,6 +157,11 @@ struct ReduceConfig {
 // ============================================================================
 // Optimized version (OPT_ENABLED) - Sequential or Tree based on Config
 // ============================================================================
+// Under HLS, use_reduce_tree selects a pipelined accumulator or a balanced
+// adder tree. Host builds ignore it and run reduce_host instead: host_lanes
+// independent accumulators (host_accumulators vectors of host_vector_bytes)
+// that the compiler keeps in SIMD registers, folded by an in-place pairwise
+// combine. There is no padding and no per-level temporary.
 template <typename DType, typename HParams, typename Config>
 class Reduce<DType, HParams, Config, OPT_ENABLED> {
 public:
@@ -170,18 +178,31 @@ public:
   static constexpr int num_stages = log2_ceil(n);
   static constexpr int padded_n = next_power_of_2(n);
 
+  static constexpr int host_vector_bytes = 32;
+  static constexpr int host_accumulators = 4;
+  static constexpr int host_vector_lanes =
+      host_vector_bytes >= int(sizeof(dtype))
+          ? host_vector_bytes / int(sizeof(dtype))
+          : 1;
+  static constexpr int host_lanes =
+      prev_power_of_2(n < host_accumulators * host_vector_lanes
+                          ? n
+                          : host_accumulators * host_vector_lanes);
+
   Reduce() = default;
   ~Reduce() = default;
 
   static dtype reduce(const dtype input[n]) {
 #ifdef __VITIS_HLS__
 #pragma HLS INLINE off
-#endif
     if constexpr (use_reduce_tree) {
       return reduce_tree(input);
     } else {
       return reduce_sequential(input);
     }
+#else
+    return reduce_host(input);
+#endif
   }
 
   static void reduce(dtype &output, const dtype input[n]) {
@@ -245,15 +266,48 @@ public:
 #endif
 
 private:
+#ifndef __VITIS_HLS__
+  static dtype reduce_host(const dtype *input) {
+    dtype acc[host_lanes];
+
+  HOST_LANE_INIT_LOOP:
+    for (int l = 0; l < host_lanes; l++) {
+      acc[l] = input[l];
+    }
+
+    int i = host_lanes;
+  HOST_BLOCK_LOOP:
+    for (; i + host_lanes <= n; i += host_lanes) {
+    HOST_LANE_LOOP:
+      for (int l = 0; l < host_lanes; l++) {
+        acc[l] = impl::kernel(acc[l], input[i + l]);
+      }
+    }
+  HOST_TAIL_LOOP:
+    for (int l = 0; i + l < n; l++) {
+      acc[l] = impl::kernel(acc[l], input[i + l]);
+    }
+
+  HOST_COMBINE_LOOP:
+    for (int width = host_lanes / 2; width > 0; width /= 2) {
+      for (int l = 0; l < width; l++) {
+        acc[l] = impl::kernel(acc[l], acc[l + width]);
+      }
+    }
+
+    return impl::finalize(acc[0]);
+  }
+#endif
+
   static dtype reduce_sequential(const dtype *input) {
 #ifdef __VITIS_HLS__
 #pragma HLS INLINE off
 #pragma HLS ARRAY_PARTITION variable = input cyclic factor = partition_factor
 #endif
-    dtype acc = dtype(0);
+    dtype acc = input[0];
 
   REDUCE_LOOP:
-    for (int i = 0; i < n; i++) {
+    for (int i = 1; i < n; i++) {
 #ifdef __VITIS_HLS__
 #pragma HLS PIPELINE II = pipeline_ii
 #pragma HLS UNROLL factor = unroll_factor
@@ -349,11 +403,11 @@ private:
     }
 
     if constexpr (use_reduce_tree) {
-      return reduce_tree_internal(input_buffer);
+      return reduce_tree(input_buffer);
     } else {
-      dtype acc = dtype(0);
+      dtype acc = input_buffer[0];
     REDUCE_STREAM_LOOP:
-      for (int i = 0; i < n; i++) {
+      for (int i = 1; i < n; i++) {
 #pragma HLS PIPELINE II = pipeline_ii
 #pragma HLS UNROLL factor = unroll_factor
         acc = impl::kernel(acc, input_buffer[i]);
@@ -6,6 +6,9 @@
 
 namespace vhn {
 
+// Single-output ops generate a Reduce; "welford", "sumsq", "max_argmax"
+// (alias "argmax") and "max_sum_exp" generate a MultiReduce returning
+// several statistics.
 class ReduceBuilder : public BaseBuilder {
 public:
   std::string generate_hparams(const std::string &name,
@@ -28,6 +31,14 @@ public:
       impl_class = "vhn::MaxImpl";
     } else if (op == "min") {
       impl_class = "vhn::MinImpl";
+    } else if (op == "welford") {
+      impl_class = "vhn::WelfordImpl";
+    } else if (op == "sumsq") {
+      impl_class = "vhn::SumSqImpl";
+    } else if (op == "max_argmax" || op == "argmax") {
+      impl_class = "vhn::MaxArgMaxImpl";
+    } else if (op == "max_sum_exp") {
+      impl_class = "vhn::MaxSumExpImpl";
     } else {
       throw std::runtime_error("Unsupported reduce operation: " + op);
     }
@@ -73,9 +84,22 @@ public:
     std::string config_type =
         (opt_level == "OPT_NONE") ? "void" : (name + "_cfg");
 
-    GENERATE_TYPE_ALIAS(oss, "Reduce", name, dtype, opt_level)
+    GENERATE_TYPE_ALIAS(oss, reduce_class(hls_cfg), name, dtype, opt_level)
     return oss.str();
   }
+
+private:
+  // The generator passes the whole module description to
+  // generate_type_alias, so the op is read from its hparams.
+  static std::string reduce_class(const json &module) {
+    const std::string op = module.value("hparams", json::object())
+                               .value("op", std::string());
+    if (op == "welford" || op == "sumsq" || op == "max_argmax" ||
+        op == "argmax" || op == "max_sum_exp") {
+      return "MultiReduce";
+    }
+    return "Reduce";
+  }
 };
 
 } // namespace vhn
@@ -1,8 +1,12 @@
 #pragma once
 
 #include "../tb/tb.hh"
+#include "./axis_reduce.hh"
+#include "./broadcast.hh"
 #include "./elementwise.hh"
+#include "./multi_reduce.hh"
 #include "./reduce.hh"
+#include "./topk.hh"
 #include <algorithm>
 #include <random>
 
@@ -24,6 +28,32 @@
       Reduce<DType, ReduceHParams<REDUCE_NAME##Impl<DType, N>, N>, Config,     \
              OPT_LEVEL>;
 
+#define MULTI_REDUCE_REGISTRY(REDUCE_NAME)                                     \
+  template <typename DType, int N, typename Config = void,                     \
+            OptLevel OPT_LEVEL = OPT_NONE>                                     \
+  using Reduce##REDUCE_NAME =                                                  \
+      MultiReduce<DType, ReduceHParams<REDUCE_NAME##Impl<DType, N>, N>,        \
+                  Config, OPT_LEVEL>;
+
+#define AXIS_REDUCE_REGISTRY(REDUCE_NAME)                                      \
+  template <typename DType, int AXIS, int D0, int D1, int D2 = 1,              \
+            typename Config = void, OptLevel OPT_LEVEL = OPT_NONE>             \
+  using Reduce##REDUCE_NAME##Axis = AxisReduce<                                \
+      DType,                                                                   \
+      AxisReduceHParams<                                                       \
+          REDUCE_NAME##Impl<DType, AxisShape<AXIS, D0, D1, D2>::len>, AXIS,    \
+          D0, D1, D2>,                                                         \
+      Config, OPT_LEVEL>;
+
+#define BROADCAST_REGISTRY(BROADCAST_NAME)                                     \
+  template <typename DType, int AXIS, int D0, int D1, int D2 = 1,              \
+            typename Config = void, OptLevel OPT_LEVEL = OPT_NONE>             \
+  using Broadcast##BROADCAST_NAME = Broadcast<                                 \
+      DType,                                                                   \
+      BroadcastHParams<BROADCAST_NAME##Impl<DType, D0 * D1 * D2>, AXIS, D0,    \
+                       D1, D2>,                                                \
+      Config, OPT_LEVEL>;
+
 #define ELEMENTWISE_TB_REGISTRY(ELEMENTWISE_NAME)                              \
   template <const int N> class ELEMENTWISE_NAME##TestCase {                    \
   public:                                                                      \
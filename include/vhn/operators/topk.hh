@@ -0,0 +1,455 @@
+#pragma once
+
+#include "../opt_level.hh"
+#include "../stream.hh"
+#include "./reduce.hh"
+
+namespace vhn {
+
+template <typename DType, typename HParams, typename Config = void,
+          OptLevel OPT_LEVEL = OPT_NONE>
+class TopK;
+
+template <int N, int K> struct TopKHParams {
+  static_assert(K > 0 && K <= N, "TopK needs 0 < K <= N");
+  static constexpr int n = N;
+  static constexpr int k = K;
+};
+
+template <int PIPELINE_II, int UNROLL_FACTOR, int PARTITION_FACTOR,
+          bool USE_TREE>
+struct TopKConfig {
+  static constexpr int pipeline_ii = PIPELINE_II;
+  static constexpr int unroll_factor = UNROLL_FACTOR;
+  static constexpr int partition_factor = PARTITION_FACTOR;
+  static constexpr bool use_tree = USE_TREE;
+};
+
+// Results are the K largest values in descending order with their indices.
+// Equal values keep the lower index first, i.e. the order of a stable
+// descending sort, so every variant returns identical output.
+template <typename DType, int K> struct TopKList {
+  DType value[K];
+  int index[K]; // -1 marks an empty slot, ranked below every element
+
+  void clear() {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE
+#endif
+  CLEAR_LOOP:
+    for (int s = 0; s < K; s++) {
+#ifdef __VITIS_HLS__
+#pragma HLS UNROLL
+#endif
+      value[s] = DType(0);
+      index[s] = -1;
+    }
+  }
+
+  static bool better(const DType x, const int i, const DType y, const int j) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE
+#endif
+    return i >= 0 && (j < 0 || x > y || (x == y && i < j));
+  }
+
+  // Shift-register insertion: every slot compares against the unmodified
+  // slot above it, so the unrolled loop is K parallel compare-and-moves.
+  void insert(const DType x, const int i) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE
+#endif
+    if (!better(x, i, value[K - 1], index[K - 1])) {
+      return;
+    }
+  INSERT_LOOP:
+    for (int s = K - 1; s >= 0; s--) {
+#ifdef __VITIS_HLS__
+#pragma HLS UNROLL
+#endif
+      if (better(x, i, value[s], index[s])) {
+        if (s > 0 && better(x, i, value[s - 1], index[s - 1])) {
+          value[s] = value[s - 1];
+          index[s] = index[s - 1];
+        } else {
+          value[s] = x;
+          index[s] = i;
+        }
+      }
+    }
+  }
+
+  // Keeps the top K of two sorted lists.
+  static TopKList merge(const TopKList &a, const TopKList &b) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE
+#endif
+    TopKList merged;
+    int ia = 0;
+    int ib = 0;
+  MERGE_LOOP:
+    for (int s = 0; s < K; s++) {
+#ifdef __VITIS_HLS__
+#pragma HLS PIPELINE II = 1
+#endif
+      const bool take_a =
+          better(a.value[ia], a.index[ia], b.value[ib], b.index[ib]);
+      merged.value[s] = take_a ? a.value[ia] : b.value[ib];
+      merged.index[s] = take_a ? a.index[ia] : b.index[ib];
+      ia += take_a ? 1 : 0;
+      ib += take_a ? 0 : 1;
+    }
+    return merged;
+  }
+
+  void write(DType values[K], int indices[K]) const {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE
+#endif
+  WRITE_LOOP:
+    for (int s = 0; s < K; s++) {
+      values[s] = value[s];
+      indices[s] = index[s];
+    }
+  }
+};
+
+// ============================================================================
+// Non-optimized version (OPT_NONE) - Sequential insertion
+// ============================================================================
+template <typename DType, typename HParams>
+class TopK<DType, HParams, void, OPT_NONE> {
+public:
+  using dtype = DType;
+  static constexpr int n = HParams::n;
+  static constexpr int k = HParams::k;
+  static constexpr OptLevel opt_level = OPT_NONE;
+
+  TopK() = default;
+  ~TopK() = default;
+
+  static void topk(dtype values[k], int indices[k], const dtype input[n]) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+    topk_1d_impl(values, indices, input);
+  }
+
+  static void topk(dtype values[][k], int indices[][k],
+                   const dtype input[][n], const int batch_size) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+  BATCH_LOOP:
+    for (int b = 0; b < batch_size; b++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_FLATTEN off
+#endif
+      topk_1d_impl(values[b], indices[b], input[b]);
+    }
+  }
+
+  static void topk(dtype values[k], int indices[k],
+                   stream<dtype> &input_stream) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+    TopKList<dtype, k> list;
+    list.clear();
+  TOPK_STREAM_LOOP:
+    for (int i = 0; i < n; i++) {
+      list.insert(input_stream.read(), i);
+    }
+    list.write(values, indices);
+  }
+
+private:
+  static void topk_1d_impl(dtype *values, int *indices, const dtype *input) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+    TopKList<dtype, k> list;
+    list.clear();
+  TOPK_LOOP:
+    for (int i = 0; i < n; i++) {
+      list.insert(input[i], i);
+    }
+    list.write(values, indices);
+  }
+};
+
+// ============================================================================
+// Optimized version (OPT_ENABLED) - Tree or Heap based on Config
+// ============================================================================
+// use_tree: element i goes to lane i % lanes (unroll_factor lanes, rounded
+// down to a power of two), each lane a fully partitioned shift-register
+// list, so one element per lane retires per cycle; the lane lists are then
+// merged pairwise in log2(lanes) levels. This is the hardware form.
+// Otherwise a K-entry min-heap holds the current top K with the weakest at
+// the root: most elements are rejected by a single compare against it and
+// the rest cost O(log K), which suits the host and large K.
+template <typename DType, typename HParams, typename Config>
+class TopK<DType, HParams, Config, OPT_ENABLED> {
+public:
+  using dtype = DType;
+  static constexpr int n = HParams::n;
+  static constexpr int k = HParams::k;
+  static constexpr OptLevel opt_level = OPT_ENABLED;
+
+  static constexpr int pipeline_ii = Config::pipeline_ii;
+  static constexpr int unroll_factor = Config::unroll_factor;
+  static constexpr int partition_factor = Config::partition_factor;
+  static constexpr bool use_tree = Config::use_tree;
+
+  static constexpr int max_lanes = unroll_factor > 1 ? unroll_factor : 1;
+  static constexpr int lanes = prev_power_of_2(n < max_lanes ? n : max_lanes);
+  static constexpr int heap_depth = log2_ceil(k + 1);
+
+  TopK() = default;
+  ~TopK() = default;
+
+  static void topk(dtype values[k], int indices[k], const dtype input[n]) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+    topk_1d_impl(values, indices, input);
+  }
+
+  static void topk(dtype values[][k], int indices[][k],
+                   const dtype input[][n], const int batch_size) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+  BATCH_LOOP:
+    for (int b = 0; b < batch_size; b++) {
+#ifdef __VITIS_HLS__
+#pragma HLS LOOP_FLATTEN off
+#endif
+      topk_1d_impl(values[b], indices[b], input[b]);
+    }
+  }
+
+  static void topk(dtype values[k], int indices[k],
+                   stream<dtype> &input_stream) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+    if constexpr (use_tree) {
+      TopKList<dtype, k> partial[lanes];
+#ifdef __VITIS_HLS__
+#pragma HLS ARRAY_PARTITION variable = partial complete dim = 0
+#endif
+      clear_lanes(partial);
+    TOPK_STREAM_LOOP:
+      for (int i = 0; i < n; i++) {
+#ifdef __VITIS_HLS__
+#pragma HLS PIPELINE II = pipeline_ii
+#pragma HLS DEPENDENCE variable = partial inter false
+#endif
+        partial[i % lanes].insert(input_stream.read(), i);
+      }
+      merge_lanes(partial).write(values, indices);
+    } else {
+      Heap heap;
+    HEAP_FILL_STREAM_LOOP:
+      for (int i = 0; i < k; i++) {
+        heap_fill(heap, i, input_stream.read(), i);
+      }
+    HEAP_STREAM_LOOP:
+      for (int i = k; i < n; i++) {
+        heap_offer(heap, input_stream.read(), i);
+      }
+      heap_write(heap, values, indices);
+    }
+  }
+
+private:
+  struct Heap {
+    dtype value[k];
+    int index[k];
+  };
+
+  static void topk_1d_impl(dtype *values, int *indices, const dtype *input) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE off
+#endif
+    if constexpr (use_tree) {
+      topk_tree(values, indices, input);
+    } else {
+      topk_heap(values, indices, input);
+    }
+  }
+
+  static void topk_tree(dtype *values, int *indices, const dtype *input) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE
+#pragma HLS ARRAY_PARTITION variable = input cyclic factor = partition_factor
+#endif
+    TopKList<dtype, k> partial[lanes];
+#ifdef __VITIS_HLS__
+#pragma HLS ARRAY_PARTITION variable = partial complete dim = 0
+#endif
+    clear_lanes(partial);
+
+    int i = 0;
+  BLOCK_LOOP:
+    for (; i + lanes <= n; i += lanes) {
+#ifdef __VITIS_HLS__
+#pragma HLS PIPELINE II = pipeline_ii
+#endif
+    LANE_LOOP:
+      for (int l = 0; l < lanes; l++) {
+        partial[l].insert(input[i + l], i + l);
+      }
+    }
+  TAIL_LOOP:
+    for (int l = 0; i + l < n; l++) {
+      partial[l].insert(input[i + l], i + l);
+    }
+
+    merge_lanes(partial).write(values, indices);
+  }
+
+  static void clear_lanes(TopKList<dtype, k> partial[lanes]) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE
+#endif
+  CLEAR_LANES_LOOP:
+    for (int l = 0; l < lanes; l++) {
+#ifdef __VITIS_HLS__
+#pragma HLS UNROLL
+#endif
+      partial[l].clear();
+    }
+  }
+
+  static TopKList<dtype, k> merge_lanes(TopKList<dtype, k> partial[lanes]) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE
+#endif
+  MERGE_TREE_LOOP:
+    for (int width = lanes / 2; width > 0; width /= 2) {
+#ifdef __VITIS_HLS__
+#pragma HLS UNROLL
+#endif
+      for (int l = 0; l < width; l++) {
+#ifdef __VITIS_HLS__
+#pragma HLS UNROLL
+#endif
+        partial[l] = TopKList<dtype, k>::merge(partial[l], partial[l + width]);
+      }
+    }
+    return partial[0];
+  }
+
+  static void topk_heap(dtype *values, int *indices, const dtype *input) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE
+#endif
+    Heap heap;
+  HEAP_FILL_LOOP:
+    for (int i = 0; i < k; i++) {
+      heap_fill(heap, i, input[i], i);
+    }
+  HEAP_LOOP:
+    for (int i = k; i < n; i++) {
+      heap_offer(heap, input[i], i);
+    }
+    heap_write(heap, values, indices);
+  }
+
+  // Min-heap on TopKList::better: the root is the weakest kept element.
+  static bool weaker(const Heap &heap, const int a, const int b) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE
+#endif
+    return TopKList<dtype, k>::better(heap.value[b], heap.index[b],
+                                      heap.value[a], heap.index[a]);
+  }
+
+  static void heap_swap(Heap &heap, const int a, const int b) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE
+#endif
+    const dtype value = heap.value[a];
+    const int index = heap.index[a];
+    heap.value[a] = heap.value[b];
+    heap.index[a] = heap.index[b];
+    heap.value[b] = value;
+    heap.index[b] = index;
+  }
+
+  static void heap_fill(Heap &heap, const int size, const dtype x,
+                        const int i) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE
+#endif
+    int pos = size;
+    heap.value[pos] = x;
+    heap.index[pos] = i;
+  SIFT_UP_LOOP:
+    for (int d = 0; d < heap_depth && pos > 0; d++) {
+      const int parent = (pos - 1) / 2;
+      if (!weaker(heap, pos, parent)) {
+        break;
+      }
+      heap_swap(heap, pos, parent);
+      pos = parent;
+    }
+  }
+
+  // Indices arrive in increasing order, so once the heap is full a tie with
+  // the root loses and a single compare rejects most elements.
+  static void heap_offer(Heap &heap, const dtype x, const int i) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE
+#endif
+    if (x > heap.value[0]) {
+      heap.value[0] = x;
+      heap.index[0] = i;
+      sift_down(heap, k);
+    }
+  }
+
+  static void sift_down(Heap &heap, const int size) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE
+#endif
+    int pos = 0;
+  SIFT_DOWN_LOOP:
+    for (int d = 0; d < heap_depth; d++) {
+      const int left = 2 * pos + 1;
+      const int right = left + 1;
+      int weakest = pos;
+      if (left < size && weaker(heap, left, weakest)) {
+        weakest = left;
+      }
+      if (right < size && weaker(heap, right, weakest)) {
+        weakest = right;
+      }
+      if (weakest == pos) {
+        break;
+      }
+      heap_swap(heap, pos, weakest);
+      pos = weakest;
+    }
+  }
+
+  // Pops the weakest element into the last free slot until the heap is
+  // empty, leaving the output in descending order.
+  static void heap_write(Heap &heap, dtype *values, int *indices) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE
+#endif
+  HEAP_WRITE_LOOP:
+    for (int s = k - 1; s >= 0; s--) {
+      values[s] = heap.value[0];
+      indices[s] = heap.index[0];
+      heap.value[0] = heap.value[s];
+      heap.index[0] = heap.index[s];
+      sift_down(heap, s);
+    }
+  }
+};
+
+} // namespace vhn
@@ -0,0 +1,73 @@
+#pragma once
+
+#ifndef __VITIS_HLS__
+#include "../builder/builder.hh"
+#include <sstream>
+
+namespace vhn {
+
+class TopKBuilder : public BaseBuilder {
+public:
+  std::string generate_hparams(const std::string &name,
+                               const std::string &dtype,
+                               const json &hparams) const override {
+    std::ostringstream oss;
+    NECESSARY_HPARAMS("TopK", name, "n")
+    NECESSARY_HPARAMS("TopK", name, "k")
+
+    int n = hparams["n"].get<int>();
+    int k = hparams["k"].get<int>();
+
+    if (k <= 0 || k > n) {
+      throw std::runtime_error("TopK module '" + name +
+                               "' needs 0 < k <= n");
+    }
+
+    oss << "using " << name << "_hparams = vhn::TopKHParams<" << n << ", "
+        << k << ">;\n";
+
+    return oss.str();
+  }
+
+  std::string generate_config(const std::string &name,
+                              const json &hls_cfg) const override {
+    if (hls_cfg.empty() || hls_cfg.is_null()) {
+      return "";
+    }
+
+    std::ostringstream oss;
+
+    auto pipeline_ii = hls_cfg.value("pipeline_ii", 1);
+    auto unroll_factor = hls_cfg.value("unroll_factor", 4);
+    auto partition_factor = hls_cfg.value("partition_factor", 4);
+    auto use_tree = hls_cfg.value("use_tree", true);
+
+    oss << "using " << name << "_cfg = vhn::TopKConfig<";
+    oss << pipeline_ii << ", " << unroll_factor << ", " << partition_factor
+        << ", " << (use_tree ? "true" : "false");
+    oss << ">;\n\n";
+
+    return oss.str();
+  }
+
+  std::string generate_type_alias(const std::string &name,
+                                  const std::string &dtype,
+                                  const json &hls_cfg) const override {
+    std::ostringstream oss;
+
+    std::string opt_level = "OPT_NONE";
+
+    if (!hls_cfg.empty() && !hls_cfg.is_null()) {
+      opt_level = "OPT_ENABLED";
+    }
+
+    std::string config_type =
+        (opt_level == "OPT_NONE") ? "void" : (name + "_cfg");
+
+    GENERATE_TYPE_ALIAS(oss, "TopK", name, dtype, opt_level)
+    return oss.str();
+  }
+};
+
+} // namespace vhn
+#endif
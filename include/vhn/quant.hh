@@ -0,0 +1,181 @@
+#pragma once
+
+#include "./types.hh"
+#include <cmath>
+#include <cstdint>
+
+namespace vhn {
+
+// Storage / accumulator types of the int8 layers.
+#ifdef __VITIS_HLS__
+using qint8_t = ap_int<8>;
+using quint8_t = ap_uint<8>;
+using qint32_t = ap_int<32>;
+#else
+using qint8_t = std::int8_t;
+using quint8_t = std::uint8_t;
+using qint32_t = std::int32_t;
+#endif
+
+// ============================================================================
+// Symmetric int8 quantization
+// ============================================================================
+// Activations and weights are symmetric (zero point 0): real = q * scale.
+// A layer accumulates q_in * q_w into int32 and rescales each output channel
+// by M[c] = in_scale * w_scale[c] / out_scale, represented in fixed point as
+//
+//   M = multiplier * 2^(shift - 31),  multiplier in [2^30, 2^31)
+//
+// so requantization is one 32x32 multiply and a rounding shift, with no
+// floating point in the datapath. Bias is int32 at scale in_scale *
+// w_scale[c].
+struct Quant {
+  static constexpr int qmin = -128;
+  static constexpr int qmax = 127;
+
+  // Host-side: splits a positive real multiplier into (multiplier, shift).
+  static void quantize_multiplier(const double real, qint32_t &multiplier,
+                                  int &shift) {
+    if (real <= 0.0) {
+      multiplier = 0;
+      shift = 0;
+      return;
+    }
+    const double q = std::frexp(real, &shift);
+    long long m = static_cast<long long>(std::llround(q * (1LL << 31)));
+    if (m == (1LL << 31)) {
+      m /= 2;
+      shift++;
+    }
+    multiplier = static_cast<qint32_t>(m);
+  }
+
+  // round(acc * M), saturated to int8; RELU clamps the lower bound at zero.
+  template <bool RELU>
+  static qint8_t requantize(const qint32_t acc, const qint32_t multiplier,
+                            const int shift) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE
+#endif
+    const long long prod =
+        static_cast<long long>(acc) * static_cast<long long>(multiplier);
+    const int total_shift = 31 - shift;
+    long long value;
+    if (total_shift <= 0) {
+      value = prod << -total_shift;
+    } else {
+      value = (prod + (1LL << (total_shift - 1))) >> total_shift;
+    }
+    const long long lo = RELU ? 0 : qmin;
+    value = value < lo ? lo : value;
+    value = value > qmax ? qmax : value;
+    return static_cast<qint8_t>(value);
+  }
+
+  static qint8_t quantize(const float x, const float scale) {
+    long q = std::lround(x / scale);
+    q = q < qmin ? qmin : q;
+    q = q > qmax ? qmax : q;
+    return static_cast<qint8_t>(q);
+  }
+
+  // Host-side helpers for preparing tensors.
+  static float scale_for(const float *x, const int n) {
+    float max_abs = 0.0f;
+    for (int i = 0; i < n; i++) {
+      max_abs = std::fabs(x[i]) > max_abs ? std::fabs(x[i]) : max_abs;
+    }
+    return max_abs > 0.0f ? max_abs / qmax : 1.0f;
+  }
+
+  static void quantize_array(qint8_t *q, const float *x, const int n,
+                             const float scale) {
+    for (int i = 0; i < n; i++) {
+      q[i] = quantize(x[i], scale);
+    }
+  }
+
+  static void dequantize_array(float *x, const qint8_t *q, const int n,
+                               const float scale) {
+    for (int i = 0; i < n; i++) {
+      x[i] = static_cast<float>(q[i]) * scale;
+    }
+  }
+
+  // Per-output-channel weight quantization of a [channels][fan_in] tensor.
+  static void quantize_per_channel(qint8_t *q, float *scales, const float *w,
+                                   const int channels, const int fan_in) {
+    for (int c = 0; c < channels; c++) {
+      scales[c] = scale_for(&w[c * fan_in], fan_in);
+      quantize_array(&q[c * fan_in], &w[c * fan_in], fan_in, scales[c]);
+    }
+  }
+
+  // Builds the int32 bias and requantization parameters of one layer.
+  static void prepare_requant(qint32_t *q_bias, qint32_t *multiplier,
+                              int *shift, const float *bias,
+                              const float *w_scales, const float in_scale,
+                              const float out_scale, const int channels) {
+    for (int c = 0; c < channels; c++) {
+      const double acc_scale = double(in_scale) * double(w_scales[c]);
+      q_bias[c] = static_cast<qint32_t>(std::llround(bias[c] / acc_scale));
+      quantize_multiplier(acc_scale / out_scale, multiplier[c], shift[c]);
+    }
+  }
+};
+
+// ============================================================================
+// Row-wise affine quantization (8 / 4 bits)
+// ============================================================================
+// Each row stores unsigned codes with its own scale and offset:
+// real = code * scale + offset, offset = row min, scale = (max - min) /
+// (2^BITS - 1). At 4 bits two codes share a byte, the even element in the
+// low nibble. Used for tables read a row at a time (QEmbedding).
+template <int BITS> struct RowwiseQuant {
+  static_assert(BITS == 8 || BITS == 4, "RowwiseQuant supports 8 or 4 bits");
+  static constexpr int bits = BITS;
+  static constexpr int levels = (1 << BITS) - 1;
+  static constexpr int per_byte = 8 / BITS;
+
+  static constexpr int row_bytes(const int n) {
+    return (n + per_byte - 1) / per_byte;
+  }
+
+  static int code(const quint8_t *row, const int j) {
+#ifdef __VITIS_HLS__
+#pragma HLS INLINE
+#endif
+    if constexpr (BITS == 8) {
+      return row[j];
+    } else {
+      const int byte = row[j / 2];
+      return (j % 2 == 0) ? (byte & 0xF) : (byte >> 4);
+    }
+  }
+
+  // Host-side: quantizes one row of n floats into row_bytes(n) bytes.
+  static void quantize_row(quint8_t *row, float &scale, float &offset,
+                           const float *x, const int n) {
+    float lo = x[0], hi = x[0];
+    for (int j = 1; j < n; j++) {
+      lo = x[j] < lo ? x[j] : lo;
+      hi = x[j] > hi ? x[j] : hi;
+    }
+    offset = lo;
+    scale = hi > lo ? (hi - lo) / levels : 1.0f;
+    for (int b = 0; b < row_bytes(n); b++) {
+      row[b] = 0;
+    }
+    for (int j = 0; j < n; j++) {
+      long q = std::lround((x[j] - lo) / scale);
+      q = q < 0 ? 0 : (q > levels ? levels : q);
+      if constexpr (BITS == 8) {
+        row[j] = static_cast<quint8_t>(q);
+      } else {
+        row[j / 2] = static_cast<quint8_t>(row[j / 2] | (q << (4 * (j % 2))));
+      }
+    }
+  }
+};
+
+} // namespace vhn
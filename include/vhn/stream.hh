@@ -0,0 +1,56 @@
+#pragma once
+
+#ifdef __VITIS_HLS__
+#include <hls_stream.h>
+#else
+#include <deque>
+#include <stdexcept>
+#endif
+
+namespace vhn {
+
+// Stream type for kernels that must also run in a plain host build. Under
+// Vitis HLS this is hls::stream; on the host it is a FIFO with the same
+// read/write/empty/size interface.
+#ifdef __VITIS_HLS__
+template <typename T> using stream = hls::stream<T>;
+#else
+template <typename T> class stream {
+public:
+  stream() = default;
+  stream(const stream &) = delete;
+  stream &operator=(const stream &) = delete;
+
+  void write(const T &value) { _fifo.push_back(value); }
+
+  T read() {
+    if (_fifo.empty()) {
+      throw std::runtime_error("vhn::stream: read from empty stream");
+    }
+    T value = _fifo.front();
+    _fifo.pop_front();
+    return value;
+  }
+
+  void read(T &value) { value = read(); }
+
+  bool empty() const { return _fifo.empty(); }
+  bool full() const { return false; }
+  int size() const { return static_cast<int>(_fifo.size()); }
+
+  stream &operator<<(const T &value) {
+    write(value);
+    return *this;
+  }
+
+  stream &operator>>(T &value) {
+    value = read();
+    return *this;
+  }
+
+private:
+  std::deque<T> _fifo;
+};
+#endif
+
+} // namespace vhn
@@ -0,0 +1,123 @@
+#include <gtest/gtest.h>
+#include <vhn.hh>
+
+namespace {
+
+constexpr int kInChannels = 4;
+constexpr int kOutChannels = 6;
+constexpr int kKernelSize = 3;
+constexpr int kDilation = 2;
+constexpr int kGroups = 2;
+constexpr int kLength = 24;
+
+using causal_config = vhn::CausalConv1dConfig<1, 2, 4>;
+
+// Whole sequence through a regular Conv1d with (K - 1) * DILATION padding on
+// both sides; its first kLength outputs are the causal result.
+using full_hparams =
+    vhn::Conv1dHParams<kInChannels, kOutChannels, kKernelSize,
+                       (kKernelSize - 1) * kDilation, kLength, 1, kDilation,
+                       kGroups>;
+using full_conv = vhn::Conv1d<float, full_hparams, void, OPT_NONE>;
+
+struct Sequence {
+  float input[kInChannels][kLength];
+  full_conv::Weight_t weight;
+  full_conv::Bias_t bias;
+  full_conv::Output_t golden;
+};
+
+Sequence &make_sequence() {
+  static Sequence seq;
+  static bool ready = false;
+  if (!ready) {
+    BaseTestCase generator;
+    generator.generate_random_array(&seq.input[0][0], kInChannels * kLength);
+    generator.generate_random_array(&seq.weight[0][0][0],
+                                    sizeof(seq.weight) / sizeof(float));
+    generator.generate_random_array(seq.bias, kOutChannels);
+    full_conv::conv1d(seq.golden, seq.input, seq.weight, seq.bias);
+    ready = true;
+  }
+  return seq;
+}
+
+// Feeds the sequence CHUNK timesteps at a time and requires every output to
+// match the one-shot convolution bit for bit.
+template <int CHUNK, typename Config, OptLevel OPT_LEVEL> void run_chunked() {
+  static_assert(kLength % CHUNK == 0, "chunk must divide the test length");
+  using hparams = vhn::CausalConv1dHParams<kInChannels, kOutChannels,
+                                           kKernelSize, CHUNK, kDilation,
+                                           kGroups>;
+  using layer_t = vhn::CausalConv1d<float, hparams, Config, OPT_LEVEL>;
+
+  Sequence &seq = make_sequence();
+  typename layer_t::State state;
+
+  for (int c = 0; c < kLength / CHUNK; c++) {
+    typename layer_t::Input_t input;
+    typename layer_t::Output_t output;
+    for (int ic = 0; ic < kInChannels; ic++) {
+      for (int t = 0; t < CHUNK; t++) {
+        input[ic][t] = seq.input[ic][c * CHUNK + t];
+      }
+    }
+    layer_t::conv1d(output, input, seq.weight, seq.bias, state);
+    for (int oc = 0; oc < kOutChannels; oc++) {
+      for (int t = 0; t < CHUNK; t++) {
+        EXPECT_EQ(output[oc][t], seq.golden[oc][c * CHUNK + t])
+            << "chunk " << c << " oc " << oc << " t " << t;
+      }
+    }
+  }
+}
+
+} // namespace
+
+TEST(CausalConv1dTest, SingleStepMatchesFullSequence) {
+  run_chunked<1, void, OPT_NONE>();
+}
+
+TEST(CausalConv1dTest, ChunkShorterThanHistory) {
+  run_chunked<3, void, OPT_NONE>();
+}
+
+TEST(CausalConv1dTest, ChunkLongerThanHistory) {
+  run_chunked<8, void, OPT_NONE>();
+}
+
+TEST(CausalConv1dTest, OptimizedMatchesFullSequence) {
+  run_chunked<1, causal_config, OPT_ENABLED>();
+  run_chunked<6, causal_config, OPT_ENABLED>();
+  run_chunked<kLength, causal_config, OPT_ENABLED>();
+}
+
+TEST(CausalConv1dTest, StreamAndReset) {
+  constexpr int chunk = 4;
+  using hparams = vhn::CausalConv1dHParams<kInChannels, kOutChannels,
+                                           kKernelSize, chunk, kDilation,
+                                           kGroups>;
+  using layer_t = vhn::CausalConv1d<float, hparams, causal_config, OPT_ENABLED>;
+
+  Sequence &seq = make_sequence();
+  layer_t::State state;
+
+  for (int pass = 0; pass < 2; pass++) {
+    vhn::stream<float> input_stream, output_stream;
+    for (int t = 0; t < kLength; t++) {
+      for (int ic = 0; ic < kInChannels; ic++) {
+        input_stream.write(seq.input[ic][t]);
+      }
+    }
+    layer_t::conv1d(output_stream, input_stream, seq.weight, seq.bias, state,
+                    kLength / chunk);
+    for (int t = 0; t < kLength; t++) {
+      for (int oc = 0; oc < kOutChannels; oc++) {
+        EXPECT_EQ(output_stream.read(), seq.golden[oc][t])
+            << "pass " << pass << " oc " << oc << " t " << t;
+      }
+    }
+    // A fresh sequence must not see the previous one's history.
+    state.reset();
+  }
+}
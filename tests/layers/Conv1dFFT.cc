@@ -0,0 +1,89 @@
+#include <gtest/gtest.h>
+#include <vhn.hh>
+
+namespace {
+
+using direct_config = vhn::Conv1dConfig<true, 1, 1, 4, 1, 1>;
+using fft_config =
+    vhn::Conv1dConfig<true, 1, 1, 4, 1, 1, vhn::CONV1D_FFT, void>;
+using auto_config =
+    vhn::Conv1dConfig<true, 1, 1, 4, 1, 1, vhn::CONV1D_AUTO, void, 32>;
+
+template <typename HParams, typename Config> void run_fft_vs_direct() {
+  using direct_t = vhn::Conv1d<float, HParams, direct_config, OPT_ENABLED>;
+  using fft_t = vhn::Conv1d<float, HParams, Config, OPT_ENABLED>;
+  static_assert(fft_t::use_fft, "expected the FFT path");
+
+  BaseTestCase generator;
+
+  static typename direct_t::Input_t input;
+  static typename direct_t::Weight_t weight;
+  static typename direct_t::Bias_t bias;
+  static typename direct_t::Output_t output_direct, output_fft, output_pre;
+  static typename fft_t::Spectra_t spectra;
+
+  constexpr int out_size = direct_t::out_channels * direct_t::out_length;
+
+  generator.generate_random_array(&input[0][0],
+                                  sizeof(input) / sizeof(float));
+  generator.generate_random_array(&weight[0][0][0],
+                                  sizeof(weight) / sizeof(float));
+  generator.generate_random_array(bias, direct_t::out_channels);
+
+  direct_t::conv1d(output_direct, input, weight, bias);
+  fft_t::conv1d(output_fft, input, weight, bias);
+
+  fft_t::precompute_spectra(spectra, weight);
+  fft_t::conv1d(output_pre, input, spectra, bias);
+
+  EXPECT_LT(ResultComparator::compare(&output_direct[0][0], &output_fft[0][0],
+                                      out_size)
+                .max_abs_error,
+            1e-3);
+  EXPECT_LT(ResultComparator::compare(&output_direct[0][0], &output_pre[0][0],
+                                      out_size)
+                .max_abs_error,
+            1e-3);
+}
+
+} // namespace
+
+TEST(Conv1dFFTTest, LongKernel) {
+  run_fft_vs_direct<vhn::Conv1dHParams<3, 4, 65, 32, 300>, fft_config>();
+}
+
+TEST(Conv1dFFTTest, StrideDilationGroups) {
+  run_fft_vs_direct<vhn::Conv1dHParams<4, 6, 33, 10, 200, 3, 2, 2>,
+                    fft_config>();
+}
+
+TEST(Conv1dFFTTest, AutoAboveThreshold) {
+  run_fft_vs_direct<vhn::Conv1dHParams<2, 2, 48, 0, 128>, auto_config>();
+}
+
+TEST(Conv1dFFTTest, AutoBelowThresholdRunsDirect) {
+  using hparams = vhn::Conv1dHParams<2, 3, 5, 2, 64>;
+  using direct_t = vhn::Conv1d<float, hparams, direct_config, OPT_ENABLED>;
+  using auto_t = vhn::Conv1d<float, hparams, auto_config, OPT_ENABLED>;
+  static_assert(!auto_t::use_fft, "kernel below threshold must run direct");
+
+  BaseTestCase generator;
+  direct_t::Input_t input;
+  direct_t::Weight_t weight;
+  direct_t::Bias_t bias;
+  direct_t::Output_t output_direct, output_auto;
+
+  generator.generate_random_array(&input[0][0], sizeof(input) / sizeof(float));
+  generator.generate_random_array(&weight[0][0][0],
+                                  sizeof(weight) / sizeof(float));
+  generator.generate_random_array(bias, direct_t::out_channels);
+
+  direct_t::conv1d(output_direct, input, weight, bias);
+  auto_t::conv1d(output_auto, input, weight, bias);
+
+  for (int oc = 0; oc < direct_t::out_channels; oc++) {
+    for (int pos = 0; pos < direct_t::out_length; pos++) {
+      EXPECT_EQ(output_direct[oc][pos], output_auto[oc][pos]);
+    }
+  }
+}
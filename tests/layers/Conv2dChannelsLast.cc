@@ -0,0 +1,114 @@
+#include <gtest/gtest.h>
+#include <vhn.hh>
+
+namespace {
+
+using nhwc_config = vhn::Conv2dConfig<true, 1, 1, 4, 1, 1, vhn::CONV2D_DIRECT,
+                                      void, vhn::LAYOUT_NHWC>;
+
+template <typename HParams> void run_channels_last() {
+  using ref_t = vhn::Conv2d<float, HParams, void, OPT_NONE>;
+  using dut_t = vhn::Conv2d<float, HParams, nhwc_config, OPT_ENABLED>;
+  using input_layout = vhn::LayoutTransform<float, ref_t::in_channels,
+                                            ref_t::width, ref_t::height>;
+  using output_layout =
+      vhn::LayoutTransform<float, ref_t::out_channels, ref_t::out_width,
+                           ref_t::out_height>;
+  using weight_layout =
+      vhn::LayoutTransform<float, ref_t::in_channels_per_group,
+                           ref_t::kernel_size, ref_t::kernel_size>;
+
+  constexpr int batch = 2;
+
+  BaseTestCase generator;
+
+  static typename ref_t::Input_t input[batch];
+  static typename ref_t::Weight_t weight;
+  static typename ref_t::Bias_t bias;
+  static typename ref_t::Output_t output_ref[batch], output_back[batch];
+  static typename dut_t::Input_t input_nhwc[batch];
+  static typename dut_t::Weight_t weight_nhwc;
+  static typename dut_t::Output_t output_nhwc[batch];
+
+  generator.generate_random_array(&input[0][0][0][0],
+                                  sizeof(input) / sizeof(float));
+  generator.generate_random_array(&weight[0][0][0][0],
+                                  sizeof(weight) / sizeof(float));
+  generator.generate_random_array(bias, ref_t::out_channels);
+
+  input_layout::to_nhwc(input_nhwc, input, batch);
+  weight_layout::to_nhwc(weight_nhwc, weight, ref_t::out_channels);
+
+  ref_t::conv2d(output_ref, input, batch, weight, bias);
+  dut_t::conv2d(output_nhwc, input_nhwc, batch, weight_nhwc, bias);
+  output_layout::to_nchw(output_back, output_nhwc, batch);
+
+  auto result = ResultComparator::compare(
+      &output_back[0][0][0][0], &output_ref[0][0][0][0],
+      sizeof(output_ref) / sizeof(float));
+  EXPECT_LT(result.max_abs_error, 1e-5f);
+}
+
+} // namespace
+
+TEST(Conv2dChannelsLast, LayoutRoundTrip) {
+  using layout = vhn::LayoutTransform<float, 3, 5, 4>;
+  BaseTestCase generator;
+  float nchw[3][5][4], nhwc[5][4][3], back[3][5][4];
+  generator.generate_random_array(&nchw[0][0][0], 60);
+
+  layout::to_nhwc(nhwc, nchw);
+  EXPECT_EQ(nhwc[4][1][2], nchw[2][4][1]);
+  layout::to_nchw(back, nhwc);
+  auto result = ResultComparator::compare(&back[0][0][0], &nchw[0][0][0], 60);
+  EXPECT_EQ(result.max_abs_error, 0.0f);
+}
+
+TEST(Conv2dChannelsLast, Direct) {
+  run_channels_last<vhn::Conv2dHParams<8, 6, 3, 1, 9, 7>>();
+}
+
+TEST(Conv2dChannelsLast, StridedDilatedGrouped) {
+  run_channels_last<vhn::Conv2dHParams<8, 12, 3, 2, 11, 10, 2, 2, 4>>();
+}
+
+TEST(Conv2dChannelsLast, Depthwise) {
+  run_channels_last<vhn::Conv2dHParams<8, 16, 3, 1, 10, 10, 1, 1, 8>>();
+}
+
+TEST(Conv2dChannelsLast, LineBufferAcceptsChannelsLastWeights) {
+  using hparams = vhn::Conv2dHParams<4, 6, 3, 1, 8, 8>;
+  using ref_t = vhn::Conv2d<float, hparams, void, OPT_NONE>;
+  using dut_t = vhn::Conv2d<float, hparams, nhwc_config, OPT_ENABLED>;
+
+  BaseTestCase generator;
+  static ref_t::Input_t input;
+  static ref_t::Weight_t weight;
+  static ref_t::Bias_t bias;
+  static dut_t::Input_t input_nhwc;
+  static dut_t::Weight_t weight_nhwc;
+  static dut_t::Output_t output_nhwc;
+
+  generator.generate_random_array(&input[0][0][0], 4 * 8 * 8);
+  generator.generate_random_array(&weight[0][0][0][0], 6 * 4 * 9);
+  generator.generate_random_array(bias, 6);
+  vhn::LayoutTransform<float, 4, 8, 8>::to_nhwc(input_nhwc, input);
+  vhn::LayoutTransform<float, 4, 3, 3>::to_nhwc(weight_nhwc, weight, 6);
+  dut_t::conv2d(output_nhwc, input_nhwc, weight_nhwc, bias);
+
+  // The line-buffer stream order is exactly the NHWC memory order.
+  vhn::stream<float> input_stream, output_stream;
+  for (int i = 0; i < 4 * 8 * 8; i++) {
+    input_stream.write((&input_nhwc[0][0][0])[i]);
+  }
+  dut_t::conv2d_linebuffer(output_stream, input_stream, weight_nhwc, bias);
+
+  ASSERT_EQ(output_stream.size(), 6 * 8 * 8);
+  float max_abs_error = 0.0f;
+  for (int i = 0; i < 6 * 8 * 8; i++) {
+    max_abs_error = std::max(
+        max_abs_error,
+        std::abs(output_stream.read() - (&output_nhwc[0][0][0])[i]));
+  }
+  EXPECT_LT(max_abs_error, 1e-5f);
+}
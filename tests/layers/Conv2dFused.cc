@@ -0,0 +1,148 @@
+#include <cmath>
+#include <gtest/gtest.h>
+#include <vhn.hh>
+
+namespace {
+
+constexpr float kEpsilon = 1e-5f;
+
+using conv_hparams = vhn::Conv2dHParams<3, 8, 3, 1, 10, 9>;
+using fused_config = vhn::Conv2dFusedConfig<1, 2, 4>;
+using conv_t = vhn::Conv2d<float, conv_hparams, void, OPT_NONE>;
+
+struct Params {
+  conv_t::Input_t input;
+  conv_t::Weight_t weight;
+  conv_t::Bias_t bias;
+  conv_t::Output_t residual;
+  float bn_weight[8], bn_bias[8], running_mean[8], running_var[8];
+  float bn_scale[8], bn_shift[8];
+};
+
+Params &make_params() {
+  static Params p;
+  static bool ready = false;
+  if (!ready) {
+    BaseTestCase generator;
+    generator.generate_random_array(&p.input[0][0][0],
+                                    sizeof(p.input) / sizeof(float));
+    generator.generate_random_array(&p.weight[0][0][0][0],
+                                    sizeof(p.weight) / sizeof(float));
+    generator.generate_random_array(p.bias, 8);
+    generator.generate_random_array(&p.residual[0][0][0],
+                                    sizeof(p.residual) / sizeof(float));
+    generator.generate_random_array(p.bn_weight, 8);
+    generator.generate_random_array(p.bn_bias, 8);
+    generator.generate_random_array(p.running_mean, 8);
+    generator.generate_random_array(p.running_var, 8);
+    for (int c = 0; c < 8; c++) {
+      p.running_var[c] = std::fabs(p.running_var[c]) + 0.5f;
+    }
+    vhn::BatchNormFold<conv_t>::scale_shift(p.bn_scale, p.bn_shift,
+                                            p.bn_weight, p.bn_bias,
+                                            p.running_mean, p.running_var,
+                                            kEpsilon);
+    ready = true;
+  }
+  return p;
+}
+
+// Conv2d, BatchNorm, ReLU and residual add as separate passes.
+template <bool BATCHNORM, bool RELU, vhn::ResidualMode RESIDUAL>
+void unfused_golden(conv_t::Output_t output, const Params &p) {
+  conv_t::conv2d(output, p.input, p.weight, p.bias);
+  for (int c = 0; c < 8; c++) {
+    for (int y = 0; y < conv_t::out_width; y++) {
+      for (int x = 0; x < conv_t::out_height; x++) {
+        float v = output[c][y][x];
+        if (BATCHNORM) {
+          v = p.bn_weight[c] * (v - p.running_mean[c]) /
+                  std::sqrt(p.running_var[c] + kEpsilon) +
+              p.bn_bias[c];
+        }
+        if (RESIDUAL == vhn::RESIDUAL_PRE_ACT) {
+          v += p.residual[c][y][x];
+        }
+        if (RELU) {
+          v = std::max(v, 0.0f);
+        }
+        if (RESIDUAL == vhn::RESIDUAL_POST_ACT) {
+          v += p.residual[c][y][x];
+        }
+        output[c][y][x] = v;
+      }
+    }
+  }
+}
+
+template <bool BATCHNORM, bool RELU, vhn::ResidualMode RESIDUAL>
+void run_fused() {
+  using act_t = std::conditional_t<RELU, vhn::ReLUImpl<float, 1>, void>;
+  using hparams =
+      vhn::Conv2dFusedHParams<conv_hparams,
+                              vhn::Conv2dEpilogue<act_t, BATCHNORM, RESIDUAL>>;
+  using ref_t = vhn::Conv2dFused<float, hparams, void, OPT_NONE>;
+  using opt_t = vhn::Conv2dFused<float, hparams, fused_config, OPT_ENABLED>;
+
+  Params &p = make_params();
+  static conv_t::Output_t golden, output_ref, output_opt;
+  constexpr int out_size = 8 * conv_t::out_width * conv_t::out_height;
+
+  unfused_golden<BATCHNORM, RELU, RESIDUAL>(golden, p);
+  ref_t::conv2d(output_ref, p.input, p.weight, p.bias, p.bn_scale, p.bn_shift,
+                p.residual);
+  opt_t::conv2d(output_opt, p.input, p.weight, p.bias, p.bn_scale, p.bn_shift,
+                p.residual);
+
+  EXPECT_LT(ResultComparator::compare(&golden[0][0][0], &output_ref[0][0][0],
+                                      out_size)
+                .max_abs_error,
+            1e-4);
+  EXPECT_LT(ResultComparator::compare(&golden[0][0][0], &output_opt[0][0][0],
+                                      out_size)
+                .max_abs_error,
+            1e-4);
+}
+
+} // namespace
+
+TEST(Conv2dFusedTest, BatchNormReLU) {
+  run_fused<true, true, vhn::RESIDUAL_NONE>();
+}
+
+TEST(Conv2dFusedTest, BatchNormResidualReLU) {
+  run_fused<true, true, vhn::RESIDUAL_PRE_ACT>();
+}
+
+TEST(Conv2dFusedTest, ReLUThenResidual) {
+  run_fused<false, true, vhn::RESIDUAL_POST_ACT>();
+}
+
+TEST(Conv2dFusedTest, BatchNormOnly) {
+  run_fused<true, false, vhn::RESIDUAL_NONE>();
+}
+
+TEST(Conv2dFusedTest, BatchWithoutResidual) {
+  using hparams = vhn::Conv2dFusedHParams<
+      conv_hparams, vhn::Conv2dEpilogue<vhn::ReLUImpl<float, 1>>>;
+  using ref_t = vhn::Conv2dFused<float, hparams, void, OPT_NONE>;
+  using opt_t = vhn::Conv2dFused<float, hparams, fused_config, OPT_ENABLED>;
+
+  Params &p = make_params();
+  static float input[2][3][10][9];
+  static float output_ref[2][8][conv_t::out_width][conv_t::out_height];
+  static float output_opt[2][8][conv_t::out_width][conv_t::out_height];
+  std::copy_n(&p.input[0][0][0], 3 * 10 * 9, &input[0][0][0][0]);
+  std::copy_n(&p.input[0][0][0], 3 * 10 * 9, &input[1][0][0][0]);
+
+  ref_t::conv2d(output_ref, input, 2, p.weight, p.bias, p.bn_scale,
+                p.bn_shift, nullptr);
+  opt_t::conv2d(output_opt, input, 2, p.weight, p.bias, p.bn_scale,
+                p.bn_shift, nullptr);
+
+  constexpr int out_size = 2 * 8 * conv_t::out_width * conv_t::out_height;
+  EXPECT_LT(ResultComparator::compare(&output_ref[0][0][0][0],
+                                      &output_opt[0][0][0][0], out_size)
+                .max_abs_error,
+            1e-4);
+}
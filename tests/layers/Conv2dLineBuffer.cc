@@ -0,0 +1,90 @@
+#include <gtest/gtest.h>
+#include <vhn.hh>
+
+namespace {
+
+constexpr int kInChannels = 3;
+constexpr int kOutChannels = 5;
+
+template <typename Dut, int KERNEL, int PADDING, int WIDTH, int HEIGHT>
+void run_linebuffer(const int batch_size) {
+  using hparams = vhn::Conv2dHParams<kInChannels, kOutChannels, KERNEL,
+                                     PADDING, WIDTH, HEIGHT>;
+  using ref_t = vhn::Conv2d<float, hparams, void, OPT_NONE>;
+  using dut_t = typename Dut::template type<hparams>;
+
+  BaseTestCase generator;
+
+  static typename ref_t::Input_t input[2];
+  static typename ref_t::Weight_t weight;
+  static typename ref_t::Bias_t bias;
+  static typename ref_t::Output_t output_ref[2];
+
+  generator.generate_random_array(&input[0][0][0][0],
+                                  2 * kInChannels * WIDTH * HEIGHT);
+  generator.generate_random_array(&weight[0][0][0][0],
+                                  kOutChannels * kInChannels * KERNEL * KERNEL);
+  generator.generate_random_array(bias, kOutChannels);
+
+  ref_t::conv2d(output_ref, input, batch_size, weight, bias);
+
+  vhn::stream<float> input_stream;
+  vhn::stream<float> output_stream;
+  for (int b = 0; b < batch_size; b++) {
+    for (int r = 0; r < WIDTH; r++) {
+      for (int c = 0; c < HEIGHT; c++) {
+        for (int ic = 0; ic < kInChannels; ic++) {
+          input_stream.write(input[b][ic][r][c]);
+        }
+      }
+    }
+  }
+
+  dut_t::conv2d_linebuffer(output_stream, input_stream, weight, bias,
+                           batch_size);
+
+  EXPECT_TRUE(input_stream.empty());
+  ASSERT_EQ(output_stream.size(), batch_size * kOutChannels *
+                                      ref_t::out_width * ref_t::out_height);
+
+  float max_abs_error = 0.0f;
+  for (int b = 0; b < batch_size; b++) {
+    for (int r = 0; r < ref_t::out_width; r++) {
+      for (int c = 0; c < ref_t::out_height; c++) {
+        for (int oc = 0; oc < kOutChannels; oc++) {
+          float diff = std::abs(output_stream.read() - output_ref[b][oc][r][c]);
+          max_abs_error = std::max(max_abs_error, diff);
+        }
+      }
+    }
+  }
+  EXPECT_LT(max_abs_error, 1e-5f);
+}
+
+struct RefConv {
+  template <typename HParams>
+  using type = vhn::Conv2d<float, HParams, void, OPT_NONE>;
+};
+
+struct OptConv {
+  template <typename HParams>
+  using type =
+      vhn::Conv2d<float, HParams, vhn::Conv2dConfig<true, 1, 1, 4, 1, 1>,
+                  OPT_ENABLED>;
+};
+
+} // namespace
+
+TEST(Conv2dLineBuffer, Kernel3NoPadding) {
+  run_linebuffer<RefConv, 3, 0, 8, 10>(1);
+}
+
+TEST(Conv2dLineBuffer, Kernel3Padded) {
+  run_linebuffer<OptConv, 3, 1, 9, 7>(2);
+}
+
+TEST(Conv2dLineBuffer, Kernel5Padded) {
+  run_linebuffer<OptConv, 5, 2, 12, 11>(1);
+}
+
+TEST(Conv2dLineBuffer, Kernel1) { run_linebuffer<RefConv, 1, 0, 6, 6>(2); }
@@ -0,0 +1,64 @@
+#include <gtest/gtest.h>
+#include <vhn.hh>
+
+namespace {
+
+using direct_config = vhn::Conv2dConfig<true, 1, 1, 4, 1, 1>;
+
+template <typename TileConfig>
+using tiled_config =
+    vhn::Conv2dConfig<true, 1, 1, 4, 1, 1, vhn::CONV2D_DIRECT, void,
+                      vhn::LAYOUT_NCHW, TileConfig>;
+
+template <typename HParams, typename TileConfig> void run_tiled() {
+  using direct_t = vhn::Conv2d<float, HParams, direct_config, OPT_ENABLED>;
+  using tiled_t =
+      vhn::Conv2d<float, HParams, tiled_config<TileConfig>, OPT_ENABLED>;
+  static_assert(tiled_t::tiled, "expected the tiled path");
+
+  BaseTestCase generator;
+
+  static typename direct_t::Input_t input[2];
+  static typename direct_t::Weight_t weight;
+  static typename direct_t::Bias_t bias;
+  static typename direct_t::Output_t output_direct[2], output_tiled[2];
+
+  constexpr int out_size =
+      direct_t::out_channels * direct_t::out_width * direct_t::out_height;
+
+  generator.generate_random_array(&input[0][0][0][0],
+                                  sizeof(input) / sizeof(float));
+  generator.generate_random_array(&weight[0][0][0][0],
+                                  sizeof(weight) / sizeof(float));
+  generator.generate_random_array(bias, direct_t::out_channels);
+
+  direct_t::conv2d(output_direct, input, 2, weight, bias);
+  tiled_t::conv2d(output_tiled, input, 2, weight, bias);
+
+  EXPECT_LT(ResultComparator::compare(&output_direct[0][0][0][0],
+                                      &output_tiled[0][0][0][0], 2 * out_size)
+                .max_abs_error,
+            1e-6);
+}
+
+} // namespace
+
+TEST(Conv2dTiledTest, EvenTiles) {
+  run_tiled<vhn::Conv2dHParams<8, 16, 3, 1, 16, 16>,
+            vhn::Conv2dTileConfig<8, 8, 4, 4>>();
+}
+
+TEST(Conv2dTiledTest, RaggedTilesAndBlocks) {
+  run_tiled<vhn::Conv2dHParams<5, 7, 3, 1, 13, 11>,
+            vhn::Conv2dTileConfig<4, 5, 3, 2>>();
+}
+
+TEST(Conv2dTiledTest, StrideDilationGroups) {
+  run_tiled<vhn::Conv2dHParams<6, 8, 3, 2, 15, 14, 2, 2, 2>,
+            vhn::Conv2dTileConfig<3, 4, 2, 2>>();
+}
+
+TEST(Conv2dTiledTest, TilesLargerThanLayer) {
+  run_tiled<vhn::Conv2dHParams<3, 4, 5, 2, 6, 7>,
+            vhn::Conv2dTileConfig<32, 32, 64, 64>>();
+}
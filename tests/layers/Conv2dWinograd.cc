@@ -0,0 +1,93 @@
+#include <gtest/gtest.h>
+#include <vhn.hh>
+
+namespace {
+
+constexpr int kInChannels = 4;
+constexpr int kOutChannels = 6;
+
+template <int PADDING, int WIDTH, int HEIGHT>
+using conv_hparams =
+    vhn::Conv2dHParams<kInChannels, kOutChannels, 3, PADDING, WIDTH, HEIGHT>;
+
+template <vhn::Conv2dAlgo ALGO>
+using conv_config = vhn::Conv2dConfig<true, 1, 1, 4, 1, 1, ALGO>;
+
+template <vhn::Conv2dAlgo ALGO, int PADDING, int WIDTH, int HEIGHT>
+void run_winograd(const float tolerance) {
+  using hparams = conv_hparams<PADDING, WIDTH, HEIGHT>;
+  using ref_t = vhn::Conv2d<float, hparams, void, OPT_NONE>;
+  using dut_t = vhn::Conv2d<float, hparams, conv_config<ALGO>, OPT_ENABLED>;
+
+  BaseTestCase generator;
+
+  static typename ref_t::Input_t input;
+  static typename ref_t::Weight_t weight;
+  static typename ref_t::Bias_t bias;
+  static typename ref_t::Output_t output_ref, output_dut, output_pre;
+  static typename dut_t::TransformedWeight_t tweight;
+
+  generator.generate_random_array(&input[0][0][0],
+                                  kInChannels * WIDTH * HEIGHT);
+  generator.generate_random_array(&weight[0][0][0][0],
+                                  kOutChannels * kInChannels * 9);
+  generator.generate_random_array(bias, kOutChannels);
+
+  ref_t::conv2d(output_ref, input, weight, bias);
+  dut_t::conv2d(output_dut, input, weight, bias);
+
+  dut_t::transform_weight(tweight, weight);
+  dut_t::conv2d_transformed(output_pre, input, tweight, bias);
+
+  constexpr int out_size = kOutChannels * ref_t::out_width * ref_t::out_height;
+  auto result = ResultComparator::compare(&output_dut[0][0][0],
+                                          &output_ref[0][0][0], out_size);
+  auto pre_result = ResultComparator::compare(&output_pre[0][0][0],
+                                              &output_ref[0][0][0], out_size);
+  EXPECT_LT(result.max_abs_error, tolerance);
+  EXPECT_LT(pre_result.max_abs_error, tolerance);
+}
+
+} // namespace
+
+TEST(Conv2dWinograd, F2x2NoPadding) {
+  run_winograd<vhn::CONV2D_WINOGRAD_2X2, 0, 10, 10>(1e-4f);
+}
+
+TEST(Conv2dWinograd, F2x2PaddedRagged) {
+  run_winograd<vhn::CONV2D_WINOGRAD_2X2, 1, 9, 7>(1e-4f);
+}
+
+TEST(Conv2dWinograd, F4x4NoPadding) {
+  run_winograd<vhn::CONV2D_WINOGRAD_4X4, 0, 14, 14>(1e-3f);
+}
+
+TEST(Conv2dWinograd, F4x4PaddedRagged) {
+  run_winograd<vhn::CONV2D_WINOGRAD_4X4, 1, 11, 13>(1e-3f);
+}
+
+TEST(Conv2dWinograd, DirectConfigMatchesReference) {
+  using hparams = conv_hparams<1, 8, 8>;
+  using ref_t = vhn::Conv2d<float, hparams, void, OPT_NONE>;
+  using dut_t =
+      vhn::Conv2d<float, hparams, conv_config<vhn::CONV2D_DIRECT>, OPT_ENABLED>;
+
+  BaseTestCase generator;
+  static ref_t::Input_t input;
+  static ref_t::Weight_t weight;
+  static ref_t::Bias_t bias;
+  static ref_t::Output_t output_ref, output_dut;
+
+  generator.generate_random_array(&input[0][0][0], kInChannels * 8 * 8);
+  generator.generate_random_array(&weight[0][0][0][0],
+                                  kOutChannels * kInChannels * 9);
+  generator.generate_random_array(bias, kOutChannels);
+
+  ref_t::conv2d(output_ref, input, weight, bias);
+  dut_t::conv2d(output_dut, input, weight, bias);
+
+  auto result = ResultComparator::compare(
+      &output_dut[0][0][0], &output_ref[0][0][0],
+      kOutChannels * ref_t::out_width * ref_t::out_height);
+  EXPECT_LT(result.max_abs_error, 1e-5f);
+}
@@ -0,0 +1,99 @@
+#include <gtest/gtest.h>
+#include <vhn.hh>
+
+namespace {
+
+using gemm_config = vhn::LinearConfig<4, 4, 8, 16, false>;
+
+template <typename GEMM_CONFIG, int KERNEL, int PADDING>
+void run_conv2d_im2col() {
+  constexpr int kInChannels = 5;
+  constexpr int kOutChannels = 12;
+  constexpr int kWidth = 9;
+  constexpr int kHeight = 11;
+
+  using hparams = vhn::Conv2dHParams<kInChannels, kOutChannels, KERNEL,
+                                     PADDING, kWidth, kHeight>;
+  using ref_t = vhn::Conv2d<float, hparams, void, OPT_NONE>;
+  using dut_t = vhn::Conv2d<
+      float, hparams,
+      vhn::Conv2dConfig<true, 1, 1, 4, 1, 1, vhn::CONV2D_IM2COL, GEMM_CONFIG>,
+      OPT_ENABLED>;
+
+  BaseTestCase generator;
+
+  static typename ref_t::Input_t input;
+  static typename ref_t::Weight_t weight;
+  static typename ref_t::Bias_t bias;
+  static typename ref_t::Output_t output_ref, output_dut;
+
+  generator.generate_random_array(&input[0][0][0],
+                                  kInChannels * kWidth * kHeight);
+  generator.generate_random_array(&weight[0][0][0][0],
+                                  kOutChannels * kInChannels * KERNEL * KERNEL);
+  generator.generate_random_array(bias, kOutChannels);
+
+  ref_t::conv2d(output_ref, input, weight, bias);
+  dut_t::conv2d(output_dut, input, weight, bias);
+
+  auto result = ResultComparator::compare(
+      &output_dut[0][0][0], &output_ref[0][0][0],
+      kOutChannels * ref_t::out_width * ref_t::out_height);
+  EXPECT_LT(result.max_abs_error, 1e-4f);
+}
+
+template <typename GEMM_CONFIG, int KERNEL, int PADDING>
+void run_conv1d_im2col() {
+  constexpr int kInChannels = 6;
+  constexpr int kOutChannels = 10;
+  constexpr int kLength = 37;
+
+  using hparams =
+      vhn::Conv1dHParams<kInChannels, kOutChannels, KERNEL, PADDING, kLength>;
+  using ref_t = vhn::Conv1d<float, hparams, void, OPT_NONE>;
+  using dut_t = vhn::Conv1d<
+      float, hparams,
+      vhn::Conv1dConfig<true, 1, 1, 4, 1, 1, vhn::CONV1D_IM2COL, GEMM_CONFIG>,
+      OPT_ENABLED>;
+
+  BaseTestCase generator;
+
+  static typename ref_t::Input_t input;
+  static typename ref_t::Weight_t weight;
+  static typename ref_t::Bias_t bias;
+  static typename ref_t::Output_t output_ref, output_dut;
+
+  generator.generate_random_array(&input[0][0], kInChannels * kLength);
+  generator.generate_random_array(&weight[0][0][0],
+                                  kOutChannels * kInChannels * KERNEL);
+  generator.generate_random_array(bias, kOutChannels);
+
+  ref_t::conv1d(output_ref, input, weight, bias);
+  dut_t::conv1d(output_dut, input, weight, bias);
+
+  auto result = ResultComparator::compare(&output_dut[0][0], &output_ref[0][0],
+                                          kOutChannels * ref_t::out_length);
+  EXPECT_LT(result.max_abs_error, 1e-4f);
+}
+
+} // namespace
+
+TEST(ConvIm2col, Conv2dKernel1) { run_conv2d_im2col<gemm_config, 1, 0>(); }
+
+TEST(ConvIm2col, Conv2dKernel3Padded) {
+  run_conv2d_im2col<gemm_config, 3, 1>();
+}
+
+TEST(ConvIm2col, Conv2dKernel5Padded) {
+  run_conv2d_im2col<gemm_config, 5, 2>();
+}
+
+TEST(ConvIm2col, Conv2dUnoptimizedGemm) { run_conv2d_im2col<void, 3, 1>(); }
+
+TEST(ConvIm2col, Conv1dKernel3Padded) {
+  run_conv1d_im2col<gemm_config, 3, 1>();
+}
+
+TEST(ConvIm2col, Conv1dKernel7) { run_conv1d_im2col<gemm_config, 7, 0>(); }
+
+TEST(ConvIm2col, Conv1dUnoptimizedGemm) { run_conv1d_im2col<void, 5, 2>(); }
@@ -0,0 +1,234 @@
+#include <gtest/gtest.h>
+#include <vhn.hh>
+
+namespace {
+
+using conv2d_config = vhn::Conv2dConfig<true, 1, 1, 4, 1, 1>;
+using conv1d_config = vhn::Conv1dConfig<true, 1, 1, 4, 1, 1>;
+
+// Straightforward grouped/strided/dilated convolution used as the golden.
+template <typename Conv>
+void conv2d_golden(typename Conv::Output_t output,
+                   const typename Conv::Input_t input,
+                   const typename Conv::Weight_t weight,
+                   const typename Conv::Bias_t bias) {
+  constexpr int icpg = Conv::in_channels / Conv::groups;
+  constexpr int ocpg = Conv::out_channels / Conv::groups;
+  for (int oc = 0; oc < Conv::out_channels; oc++) {
+    for (int y = 0; y < Conv::out_width; y++) {
+      for (int x = 0; x < Conv::out_height; x++) {
+        float acc = bias[oc];
+        for (int i = 0; i < icpg; i++) {
+          int ic = (oc / ocpg) * icpg + i;
+          for (int ky = 0; ky < Conv::kernel_size; ky++) {
+            for (int kx = 0; kx < Conv::kernel_size; kx++) {
+              int iy = y * Conv::stride + ky * Conv::dilation - Conv::padding;
+              int ix = x * Conv::stride + kx * Conv::dilation - Conv::padding;
+              if (iy >= 0 && iy < Conv::width && ix >= 0 &&
+                  ix < Conv::height) {
+                acc += input[ic][iy][ix] * weight[oc][i][ky][kx];
+              }
+            }
+          }
+        }
+        output[oc][y][x] = acc;
+      }
+    }
+  }
+}
+
+template <typename HParams> void run_conv2d() {
+  using ref_t = vhn::Conv2d<float, HParams, void, OPT_NONE>;
+  using opt_t = vhn::Conv2d<float, HParams, conv2d_config, OPT_ENABLED>;
+
+  BaseTestCase generator;
+
+  static typename ref_t::Input_t input;
+  static typename ref_t::Weight_t weight;
+  static typename ref_t::Bias_t bias;
+  static typename ref_t::Output_t golden, output_ref, output_opt;
+
+  constexpr int out_size =
+      ref_t::out_channels * ref_t::out_width * ref_t::out_height;
+
+  generator.generate_random_array(&input[0][0][0], sizeof(input) /
+                                                       sizeof(float));
+  generator.generate_random_array(&weight[0][0][0][0], sizeof(weight) /
+                                                           sizeof(float));
+  generator.generate_random_array(bias, ref_t::out_channels);
+
+  conv2d_golden<ref_t>(golden, input, weight, bias);
+  ref_t::conv2d(output_ref, input, weight, bias);
+  opt_t::conv2d(output_opt, input, weight, bias);
+
+  auto ref_result = ResultComparator::compare(&output_ref[0][0][0],
+                                              &golden[0][0][0], out_size);
+  auto opt_result = ResultComparator::compare(&output_opt[0][0][0],
+                                              &golden[0][0][0], out_size);
+  EXPECT_LT(ref_result.max_abs_error, 1e-5f);
+  EXPECT_LT(opt_result.max_abs_error, 1e-5f);
+}
+
+} // namespace
+
+TEST(ConvStrideGroups, Conv2dShape) {
+  using hparams = vhn::Conv2dHParams<4, 8, 3, 1, 16, 15, 2, 1, 1>;
+  EXPECT_EQ(hparams::out_width, 8);
+  EXPECT_EQ(hparams::out_height, 8);
+
+  using dilated = vhn::Conv2dHParams<4, 8, 3, 2, 16, 16, 1, 2, 1>;
+  EXPECT_EQ(dilated::out_width, 16);
+}
+
+TEST(ConvStrideGroups, Conv2dStride2) {
+  run_conv2d<vhn::Conv2dHParams<4, 8, 3, 1, 16, 15, 2>>();
+}
+
+TEST(ConvStrideGroups, Conv2dDilation2) {
+  run_conv2d<vhn::Conv2dHParams<4, 6, 3, 2, 12, 12, 1, 2>>();
+}
+
+TEST(ConvStrideGroups, Conv2dGroups) {
+  run_conv2d<vhn::Conv2dHParams<8, 12, 3, 1, 10, 10, 1, 1, 4>>();
+}
+
+TEST(ConvStrideGroups, Conv2dDepthwise) {
+  run_conv2d<vhn::Conv2dHParams<8, 8, 3, 1, 10, 10, 1, 1, 8>>();
+}
+
+TEST(ConvStrideGroups, Conv2dDepthwiseMultiplierStride2) {
+  run_conv2d<vhn::Conv2dHParams<4, 8, 5, 2, 11, 11, 2, 1, 4>>();
+}
+
+TEST(ConvStrideGroups, Conv2dLineBufferStrideDilationGroups) {
+  using hparams = vhn::Conv2dHParams<4, 6, 3, 2, 11, 9, 2, 2, 2>;
+  using conv_t = vhn::Conv2d<float, hparams, conv2d_config, OPT_ENABLED>;
+
+  BaseTestCase generator;
+  static conv_t::Input_t input;
+  static conv_t::Weight_t weight;
+  static conv_t::Bias_t bias;
+  static conv_t::Output_t golden;
+
+  generator.generate_random_array(&input[0][0][0], sizeof(input) /
+                                                       sizeof(float));
+  generator.generate_random_array(&weight[0][0][0][0], sizeof(weight) /
+                                                           sizeof(float));
+  generator.generate_random_array(bias, conv_t::out_channels);
+  conv2d_golden<conv_t>(golden, input, weight, bias);
+
+  vhn::stream<float> input_stream, output_stream;
+  for (int r = 0; r < conv_t::width; r++) {
+    for (int c = 0; c < conv_t::height; c++) {
+      for (int ic = 0; ic < conv_t::in_channels; ic++) {
+        input_stream.write(input[ic][r][c]);
+      }
+    }
+  }
+  conv_t::conv2d_linebuffer(output_stream, input_stream, weight, bias);
+
+  ASSERT_EQ(output_stream.size(),
+            conv_t::out_channels * conv_t::out_width * conv_t::out_height);
+  float max_abs_error = 0.0f;
+  for (int r = 0; r < conv_t::out_width; r++) {
+    for (int c = 0; c < conv_t::out_height; c++) {
+      for (int oc = 0; oc < conv_t::out_channels; oc++) {
+        max_abs_error = std::max(
+            max_abs_error, std::abs(output_stream.read() - golden[oc][r][c]));
+      }
+    }
+  }
+  EXPECT_LT(max_abs_error, 1e-5f);
+}
+
+TEST(ConvStrideGroups, Conv1dStrideDilationGroups) {
+  using hparams = vhn::Conv1dHParams<6, 9, 3, 2, 40, 2, 2, 3>;
+  using ref_t = vhn::Conv1d<float, hparams, void, OPT_NONE>;
+  using opt_t = vhn::Conv1d<float, hparams, conv1d_config, OPT_ENABLED>;
+  using dw_hparams = vhn::Conv1dHParams<6, 6, 5, 2, 40, 1, 1, 6>;
+  using dw_ref_t = vhn::Conv1d<float, dw_hparams, void, OPT_NONE>;
+  using dw_opt_t = vhn::Conv1d<float, dw_hparams, conv1d_config, OPT_ENABLED>;
+
+  EXPECT_EQ(hparams::out_length, 20);
+
+  BaseTestCase generator;
+  static ref_t::Input_t input;
+  static ref_t::Weight_t weight;
+  static dw_ref_t::Weight_t dw_weight;
+  static ref_t::Bias_t bias;
+  static dw_ref_t::Bias_t dw_bias;
+  static ref_t::Output_t golden, output_ref, output_opt;
+  static dw_ref_t::Output_t dw_ref, dw_opt;
+
+  generator.generate_random_array(&input[0][0], 6 * 40);
+  generator.generate_random_array(&weight[0][0][0], 9 * 2 * 3);
+  generator.generate_random_array(&dw_weight[0][0][0], 6 * 5);
+  generator.generate_random_array(bias, 9);
+  generator.generate_random_array(dw_bias, 6);
+
+  for (int oc = 0; oc < 9; oc++) {
+    for (int pos = 0; pos < hparams::out_length; pos++) {
+      float acc = bias[oc];
+      for (int i = 0; i < 2; i++) {
+        for (int k = 0; k < 3; k++) {
+          int in_pos = pos * 2 + k * 2 - 2;
+          if (in_pos >= 0 && in_pos < 40) {
+            acc += input[(oc / 3) * 2 + i][in_pos] * weight[oc][i][k];
+          }
+        }
+      }
+      golden[oc][pos] = acc;
+    }
+  }
+
+  ref_t::conv1d(output_ref, input, weight, bias);
+  opt_t::conv1d(output_opt, input, weight, bias);
+  dw_ref_t::conv1d(dw_ref, input, dw_weight, dw_bias);
+  dw_opt_t::conv1d(dw_opt, input, dw_weight, dw_bias);
+
+  constexpr int out_size = 9 * hparams::out_length;
+  EXPECT_LT(ResultComparator::compare(&output_ref[0][0], &golden[0][0],
+                                      out_size)
+                .max_abs_error,
+            1e-5f);
+  EXPECT_LT(ResultComparator::compare(&output_opt[0][0], &golden[0][0],
+                                      out_size)
+                .max_abs_error,
+            1e-5f);
+  EXPECT_LT(ResultComparator::compare(&dw_opt[0][0], &dw_ref[0][0],
+                                      6 * dw_hparams::out_length)
+                .max_abs_error,
+            1e-5f);
+}
+
+TEST(ConvStrideGroups, SeparableConv2dFused) {
+  using hparams = vhn::SeparableConv2dHParams<8, 16, 3, 1, 12, 12, 2>;
+  using ref_t = vhn::SeparableConv2d<float, hparams, void, OPT_NONE>;
+  using opt_t = vhn::SeparableConv2d<float, hparams,
+                                     vhn::SeparableConv2dConfig<1, 4, 4>,
+                                     OPT_ENABLED>;
+
+  BaseTestCase generator;
+  static ref_t::Input_t input[2];
+  static ref_t::DWWeight_t dw_weight;
+  static ref_t::DWBias_t dw_bias;
+  static ref_t::PWWeight_t pw_weight;
+  static ref_t::PWBias_t pw_bias;
+  static ref_t::Output_t output_ref[2], output_opt[2];
+
+  generator.generate_random_array(&input[0][0][0][0], 2 * 8 * 12 * 12);
+  generator.generate_random_array(&dw_weight[0][0][0][0], 8 * 9);
+  generator.generate_random_array(dw_bias, 8);
+  generator.generate_random_array(&pw_weight[0][0][0][0], 16 * 8);
+  generator.generate_random_array(pw_bias, 16);
+
+  ref_t::sepconv2d(output_ref, input, 2, dw_weight, dw_bias, pw_weight,
+                   pw_bias);
+  opt_t::sepconv2d(output_opt, input, 2, dw_weight, dw_bias, pw_weight,
+                   pw_bias);
+
+  auto result = ResultComparator::compare(&output_opt[0][0][0][0],
+                                          &output_ref[0][0][0][0],
+                                          2 * 16 * 6 * 6);
+  EXPECT_LT(result.max_abs_error, 1e-5f);
+}
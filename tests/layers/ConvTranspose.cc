@@ -0,0 +1,252 @@
+#include <gtest/gtest.h>
+#include <vhn.hh>
+
+namespace {
+
+using ct1d_config = vhn::ConvTranspose1dConfig<1, 2, 4>;
+using ct2d_config = vhn::ConvTranspose2dConfig<1, 2, 4>;
+using up_config = vhn::UpsampleConv2dConfig<1, 2, 4>;
+
+// Zero-insertion golden: dilate the input by STRIDE, pad it by
+// D * (K - 1) - P (plus output_padding at the end) and run a stride-1
+// Conv1d with the flipped, channel-transposed kernel.
+template <typename HParams> void run_conv_transpose1d() {
+  static_assert(HParams::groups == 1, "golden assumes one group");
+  constexpr int C = HParams::in_channels;
+  constexpr int O = HParams::out_channels;
+  constexpr int K = HParams::kernel_size;
+  constexpr int S = HParams::stride;
+  constexpr int D = HParams::dilation;
+  constexpr int N = HParams::n;
+  constexpr int edge = D * (K - 1) - HParams::padding;
+  constexpr int dilated = (N - 1) * S + 1 + 2 * edge + HParams::output_padding;
+
+  using ref_t = vhn::ConvTranspose1d<float, HParams, void, OPT_NONE>;
+  using opt_t = vhn::ConvTranspose1d<float, HParams, ct1d_config, OPT_ENABLED>;
+  using golden_t =
+      vhn::Conv1d<float, vhn::Conv1dHParams<C, O, K, 0, dilated, 1, D>, void,
+                  OPT_NONE>;
+  static_assert(golden_t::out_length == HParams::out_length,
+                "golden length mismatch");
+
+  BaseTestCase generator;
+  static typename ref_t::Input_t input;
+  static typename ref_t::Weight_t weight;
+  static typename ref_t::Bias_t bias;
+  generator.generate_random_array(&input[0][0], C * N);
+  generator.generate_random_array(&weight[0][0][0], C * O * K);
+  generator.generate_random_array(bias, O);
+
+  static typename golden_t::Input_t zero_inserted = {};
+  static typename golden_t::Weight_t flipped;
+  for (int c = 0; c < C; c++) {
+    for (int i = 0; i < N; i++) {
+      zero_inserted[c][edge + i * S] = input[c][i];
+    }
+    for (int o = 0; o < O; o++) {
+      for (int k = 0; k < K; k++) {
+        flipped[o][c][k] = weight[c][o][K - 1 - k];
+      }
+    }
+  }
+
+  static typename ref_t::Output_t golden, ref, opt;
+  golden_t::conv1d(golden, zero_inserted, flipped, bias);
+  ref_t::conv_transpose1d(ref, input, weight, bias);
+  opt_t::conv_transpose1d(opt, input, weight, bias);
+
+  constexpr int out_size = O * HParams::out_length;
+  EXPECT_LT(
+      ResultComparator::compare(&golden[0][0], &ref[0][0], out_size)
+          .max_abs_error,
+      1e-4f);
+  EXPECT_LT(
+      ResultComparator::compare(&golden[0][0], &opt[0][0], out_size)
+          .max_abs_error,
+      1e-4f);
+}
+
+template <typename HParams> void run_conv_transpose2d() {
+  static_assert(HParams::groups == 1, "golden assumes one group");
+  constexpr int C = HParams::in_channels;
+  constexpr int O = HParams::out_channels;
+  constexpr int K = HParams::kernel_size;
+  constexpr int S = HParams::stride;
+  constexpr int D = HParams::dilation;
+  constexpr int W = HParams::width;
+  constexpr int H = HParams::height;
+  constexpr int edge = D * (K - 1) - HParams::padding;
+  constexpr int dw = (W - 1) * S + 1 + 2 * edge + HParams::output_padding;
+  constexpr int dh = (H - 1) * S + 1 + 2 * edge + HParams::output_padding;
+
+  using ref_t = vhn::ConvTranspose2d<float, HParams, void, OPT_NONE>;
+  using opt_t = vhn::ConvTranspose2d<float, HParams, ct2d_config, OPT_ENABLED>;
+  using golden_t =
+      vhn::Conv2d<float, vhn::Conv2dHParams<C, O, K, 0, dw, dh, 1, D>, void,
+                  OPT_NONE>;
+
+  BaseTestCase generator;
+  static typename ref_t::Input_t input;
+  static typename ref_t::Weight_t weight;
+  static typename ref_t::Bias_t bias;
+  generator.generate_random_array(&input[0][0][0], C * W * H);
+  generator.generate_random_array(&weight[0][0][0][0], C * O * K * K);
+  generator.generate_random_array(bias, O);
+
+  static typename golden_t::Input_t zero_inserted = {};
+  static typename golden_t::Weight_t flipped;
+  for (int c = 0; c < C; c++) {
+    for (int y = 0; y < W; y++) {
+      for (int x = 0; x < H; x++) {
+        zero_inserted[c][edge + y * S][edge + x * S] = input[c][y][x];
+      }
+    }
+    for (int o = 0; o < O; o++) {
+      for (int ky = 0; ky < K; ky++) {
+        for (int kx = 0; kx < K; kx++) {
+          flipped[o][c][ky][kx] = weight[c][o][K - 1 - ky][K - 1 - kx];
+        }
+      }
+    }
+  }
+
+  static typename ref_t::Output_t golden, ref, opt;
+  golden_t::conv2d(golden, zero_inserted, flipped, bias);
+  ref_t::conv_transpose2d(ref, input, weight, bias);
+  opt_t::conv_transpose2d(opt, input, weight, bias);
+
+  constexpr int out_size = O * HParams::out_width * HParams::out_height;
+  EXPECT_LT(
+      ResultComparator::compare(&golden[0][0][0], &ref[0][0][0], out_size)
+          .max_abs_error,
+      1e-4f);
+  EXPECT_LT(
+      ResultComparator::compare(&golden[0][0][0], &opt[0][0][0], out_size)
+          .max_abs_error,
+      1e-4f);
+}
+
+// Explicit upsample (independent of UpsampleCoord) followed by Conv2d.
+template <typename ConvHParams, int SCALE, vhn::UpsampleMode MODE>
+void run_upsample_conv2d() {
+  using hparams = vhn::UpsampleConv2dHParams<ConvHParams, SCALE, MODE>;
+  using ref_t = vhn::UpsampleConv2d<float, hparams, void, OPT_NONE>;
+  using opt_t = vhn::UpsampleConv2d<float, hparams, up_config, OPT_ENABLED>;
+  using conv_t = vhn::Conv2d<float, ConvHParams, void, OPT_NONE>;
+  constexpr int C = hparams::in_channels;
+  constexpr int W = hparams::width;
+  constexpr int H = hparams::height;
+
+  BaseTestCase generator;
+  static typename ref_t::Input_t input;
+  static typename ref_t::Weight_t weight;
+  static typename ref_t::Bias_t bias;
+  generator.generate_random_array(&input[0][0][0], C * W * H);
+  generator.generate_random_array(&weight[0][0][0][0],
+                                  sizeof(weight) / sizeof(float));
+  generator.generate_random_array(bias, hparams::out_channels);
+
+  auto source = [](int dst, int size, int &i0, int &i1, float &l) {
+    float src = std::max((dst + 0.5f) / SCALE - 0.5f, 0.0f);
+    i0 = static_cast<int>(src);
+    i1 = std::min(i0 + 1, size - 1);
+    l = src - i0;
+  };
+  static typename conv_t::Input_t upsampled;
+  for (int c = 0; c < C; c++) {
+    for (int y = 0; y < W * SCALE; y++) {
+      for (int x = 0; x < H * SCALE; x++) {
+        if (MODE == vhn::UPSAMPLE_NEAREST) {
+          upsampled[c][y][x] = input[c][y / SCALE][x / SCALE];
+          continue;
+        }
+        int y0, y1, x0, x1;
+        float ly, lx;
+        source(y, W, y0, y1, ly);
+        source(x, H, x0, x1, lx);
+        upsampled[c][y][x] =
+            (1 - ly) * ((1 - lx) * input[c][y0][x0] + lx * input[c][y0][x1]) +
+            ly * ((1 - lx) * input[c][y1][x0] + lx * input[c][y1][x1]);
+      }
+    }
+  }
+
+  static typename ref_t::Output_t golden, ref, opt;
+  conv_t::conv2d(golden, upsampled, weight, bias);
+  ref_t::upsample_conv2d(ref, input, weight, bias);
+  opt_t::upsample_conv2d(opt, input, weight, bias);
+
+  constexpr int out_size =
+      hparams::out_channels * hparams::out_width * hparams::out_height;
+  EXPECT_LT(
+      ResultComparator::compare(&golden[0][0][0], &ref[0][0][0], out_size)
+          .max_abs_error,
+      1e-4f);
+  EXPECT_LT(
+      ResultComparator::compare(&golden[0][0][0], &opt[0][0][0], out_size)
+          .max_abs_error,
+      1e-4f);
+}
+
+} // namespace
+
+TEST(ConvTransposeTest, Conv1dStride2) {
+  run_conv_transpose1d<vhn::ConvTranspose1dHParams<3, 5, 4, 1, 17, 2>>();
+}
+
+TEST(ConvTransposeTest, Conv1dStride3DilationOutputPadding) {
+  run_conv_transpose1d<
+      vhn::ConvTranspose1dHParams<4, 3, 3, 2, 11, 3, 1, 2>>();
+}
+
+TEST(ConvTransposeTest, Conv2dStride2) {
+  run_conv_transpose2d<vhn::ConvTranspose2dHParams<4, 6, 3, 1, 7, 9, 2, 1>>();
+}
+
+TEST(ConvTransposeTest, Conv2dStride3Kernel5) {
+  run_conv_transpose2d<vhn::ConvTranspose2dHParams<3, 4, 5, 2, 6, 5, 3>>();
+}
+
+TEST(ConvTransposeTest, GroupsMatchReference) {
+  using hparams = vhn::ConvTranspose2dHParams<4, 6, 4, 1, 6, 7, 2, 0, 1, 2>;
+  using ref_t = vhn::ConvTranspose2d<float, hparams, void, OPT_NONE>;
+  using opt_t = vhn::ConvTranspose2d<float, hparams, ct2d_config, OPT_ENABLED>;
+
+  BaseTestCase generator;
+  static ref_t::Input_t input[2];
+  static ref_t::Weight_t weight;
+  static ref_t::Bias_t bias;
+  generator.generate_random_array(&input[0][0][0][0],
+                                  sizeof(input) / sizeof(float));
+  generator.generate_random_array(&weight[0][0][0][0],
+                                  sizeof(weight) / sizeof(float));
+  generator.generate_random_array(bias, 6);
+
+  static ref_t::Output_t ref[2], opt[2];
+  ref_t::conv_transpose2d(ref, input, 2, weight, bias);
+  opt_t::conv_transpose2d(opt, input, 2, weight, bias);
+  EXPECT_LT(ResultComparator::compare(&ref[0][0][0][0], &opt[0][0][0][0],
+                                      sizeof(ref) / sizeof(float))
+                .max_abs_error,
+            1e-4f);
+}
+
+TEST(ConvTransposeTest, UpsampleNearest) {
+  run_upsample_conv2d<vhn::Conv2dHParams<3, 4, 3, 1, 16, 12>, 2,
+                      vhn::UPSAMPLE_NEAREST>();
+}
+
+TEST(ConvTransposeTest, UpsampleNearestScale3Groups) {
+  run_upsample_conv2d<vhn::Conv2dHParams<4, 6, 5, 2, 15, 12, 1, 1, 2>, 3,
+                      vhn::UPSAMPLE_NEAREST>();
+}
+
+TEST(ConvTransposeTest, UpsampleBilinear) {
+  run_upsample_conv2d<vhn::Conv2dHParams<3, 4, 3, 1, 16, 12>, 2,
+                      vhn::UPSAMPLE_BILINEAR>();
+}
+
+TEST(ConvTransposeTest, UpsampleBilinearValidPadding) {
+  run_upsample_conv2d<vhn::Conv2dHParams<2, 3, 3, 0, 12, 18>, 3,
+                      vhn::UPSAMPLE_BILINEAR>();
+}
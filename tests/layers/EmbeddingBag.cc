@@ -0,0 +1,86 @@
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <vhn.hh>
+
+namespace {
+
+constexpr int kVocab = 50;
+constexpr int kEmbed = 24;
+constexpr int kBags = 5;
+constexpr int kIndices = 14;
+
+using bag_config = vhn::EmbeddingBagConfig<1, 2, 4>;
+
+// Bag sizes 3, 0, 6, 1, 4 (one empty bag).
+const int kOffsets[kBags] = {0, 3, 3, 9, 10};
+const int kLengths[kBags] = {3, 0, 6, 1, 4};
+const int kIdx[kIndices] = {4, 9, 4, 0, 49, 13, 7, 7, 21, 33, 8, 1, 2, 3};
+
+// Golden: gather every row with Embedding, then pool them explicitly.
+template <vhn::EmbeddingBagMode MODE, bool WEIGHTED>
+void run_embedding_bag() {
+  using hparams = vhn::EmbeddingBagHParams<kVocab, kEmbed, MODE, WEIGHTED>;
+  using ref_t = vhn::EmbeddingBag<float, hparams, void, OPT_NONE>;
+  using opt_t = vhn::EmbeddingBag<float, hparams, bag_config, OPT_ENABLED>;
+  using emb_t = vhn::Embedding<float, vhn::EmbeddingHParams<kVocab, kEmbed>,
+                               void, OPT_NONE>;
+
+  BaseTestCase generator;
+  static float weight[kVocab][kEmbed];
+  float sample_weights[kIndices];
+  generator.generate_random_array(&weight[0][0], kVocab * kEmbed);
+  generator.generate_random_array(sample_weights, kIndices);
+
+  float rows[kIndices][kEmbed];
+  emb_t::emb(rows, kIdx, kIndices, weight);
+  float golden[kBags][kEmbed];
+  for (int b = 0; b < kBags; b++) {
+    for (int j = 0; j < kEmbed; j++) {
+      float acc = 0.0f;
+      for (int i = kOffsets[b]; i < kOffsets[b] + kLengths[b]; i++) {
+        const float v = WEIGHTED ? sample_weights[i] * rows[i][j] : rows[i][j];
+        if (MODE != vhn::BAG_MAX) {
+          acc += v;
+        } else {
+          acc = (i == kOffsets[b]) ? v : std::max(acc, v);
+        }
+      }
+      if (MODE == vhn::BAG_MEAN && kLengths[b] > 0) {
+        acc /= kLengths[b];
+      }
+      golden[b][j] = acc;
+    }
+  }
+
+  const float *sw = WEIGHTED ? sample_weights : nullptr;
+  float ref[kBags][kEmbed], opt[kBags][kEmbed], opt_len[kBags][kEmbed];
+  ref_t::bag(ref, kIdx, kOffsets, kBags, kIndices, weight, sw);
+  opt_t::bag(opt, kIdx, kOffsets, kBags, kIndices, weight, sw);
+  opt_t::bag_lengths(opt_len, kIdx, kLengths, kBags, weight, sw);
+
+  constexpr int out_size = kBags * kEmbed;
+  EXPECT_LT(ResultComparator::compare(&golden[0][0], &ref[0][0], out_size)
+                .max_abs_error,
+            1e-5f);
+  EXPECT_LT(ResultComparator::compare(&golden[0][0], &opt[0][0], out_size)
+                .max_abs_error,
+            1e-5f);
+  EXPECT_LT(ResultComparator::compare(&opt[0][0], &opt_len[0][0], out_size)
+                .max_abs_error,
+            1e-7f);
+  for (int j = 0; j < kEmbed; j++) {
+    EXPECT_EQ(opt[1][j], 0.0f);
+  }
+}
+
+} // namespace
+
+TEST(EmbeddingBagTest, Sum) { run_embedding_bag<vhn::BAG_SUM, false>(); }
+
+TEST(EmbeddingBagTest, WeightedSum) {
+  run_embedding_bag<vhn::BAG_SUM, true>();
+}
+
+TEST(EmbeddingBagTest, Mean) { run_embedding_bag<vhn::BAG_MEAN, false>(); }
+
+TEST(EmbeddingBagTest, Max) { run_embedding_bag<vhn::BAG_MAX, false>(); }
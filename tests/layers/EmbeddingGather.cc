@@ -0,0 +1,52 @@
+#include <gtest/gtest.h>
+#include <vhn.hh>
+
+namespace {
+
+constexpr int kVocab = 300;
+constexpr int kEmbed = 40;
+constexpr int kLength = 257;
+
+using emb_hparams = vhn::EmbeddingHParams<kVocab, kEmbed>;
+using ref_t = vhn::Embedding<float, emb_hparams, void, OPT_NONE>;
+
+// Heavily repeated tokens, so the dedup table both hits and collides.
+template <typename Config> void run_gather() {
+  using opt_t = vhn::Embedding<float, emb_hparams, Config, OPT_ENABLED>;
+
+  BaseTestCase generator;
+  static ref_t::Weight_t weight;
+  generator.generate_random_array(&weight[0][0], kVocab * kEmbed);
+
+  int tokens[kLength];
+  for (int i = 0; i < kLength; i++) {
+    tokens[i] = (i % 7 == 0) ? (i * 131) % kVocab : (i * i) % 11;
+  }
+
+  static float ref[kLength][kEmbed], opt[kLength][kEmbed];
+  static float opt_flat[kLength * kEmbed];
+  ref_t::emb(ref, tokens, kLength, weight);
+  opt_t::emb(opt, tokens, kLength, weight);
+  opt_t::emb(opt_flat, tokens, kLength, weight);
+
+  for (int i = 0; i < kLength; i++) {
+    for (int j = 0; j < kEmbed; j++) {
+      ASSERT_EQ(ref[i][j], opt[i][j]) << "token " << i;
+      ASSERT_EQ(ref[i][j], opt_flat[i * kEmbed + j]) << "token " << i;
+    }
+  }
+}
+
+} // namespace
+
+TEST(EmbeddingGatherTest, Prefetch) {
+  run_gather<vhn::EmbeddingConfig<1, 1, 1, 4, 0>>();
+}
+
+TEST(EmbeddingGatherTest, Dedup) {
+  run_gather<vhn::EmbeddingConfig<1, 1, 1, 0, 256>>();
+}
+
+TEST(EmbeddingGatherTest, PrefetchDedupSmallTable) {
+  run_gather<vhn::EmbeddingConfig<1, 1, 1, 8, 4>>();
+}
@@ -0,0 +1,92 @@
+#include <cmath>
+#include <gtest/gtest.h>
+#include <vhn.hh>
+
+namespace {
+
+constexpr int kVocab = 40;
+constexpr int kEmbed = 32;
+constexpr int kMaxSeq = 160;
+constexpr int kSegments = 2;
+
+using fused_config = vhn::FusedEmbeddingConfig<1, 2, 4>;
+
+// Golden: Embedding lookups for token / position / segment, summed
+// explicitly; sinusoidal positions come from a double-precision formula.
+template <vhn::PositionEncoding POSITION, int SEGMENTS>
+void run_fused_embedding(const int seq_len, const int start_pos) {
+  using hparams =
+      vhn::FusedEmbeddingHParams<kVocab, kEmbed, kMaxSeq, POSITION, SEGMENTS>;
+  using ref_t = vhn::FusedEmbedding<float, hparams, void, OPT_NONE>;
+  using opt_t = vhn::FusedEmbedding<float, hparams, fused_config, OPT_ENABLED>;
+  using tok_t = vhn::Embedding<float, vhn::EmbeddingHParams<kVocab, kEmbed>,
+                               void, OPT_NONE>;
+
+  BaseTestCase generator;
+  static float token_w[kVocab][kEmbed];
+  static float position_w[kMaxSeq][kEmbed];
+  static float segment_w[kSegments][kEmbed];
+  generator.generate_random_array(&token_w[0][0], kVocab * kEmbed);
+  generator.generate_random_array(&position_w[0][0], kMaxSeq * kEmbed);
+  generator.generate_random_array(&segment_w[0][0], kSegments * kEmbed);
+
+  static int tokens[kMaxSeq], segments[kMaxSeq];
+  for (int t = 0; t < seq_len; t++) {
+    tokens[t] = (t * 7 + 3) % kVocab;
+    segments[t] = t < seq_len / 2 ? 0 : 1;
+  }
+
+  static float golden[kMaxSeq][kEmbed];
+  tok_t::emb(golden, tokens, seq_len, token_w);
+  for (int t = 0; t < seq_len; t++) {
+    const int pos = start_pos + t;
+    for (int j = 0; j < kEmbed; j++) {
+      if (POSITION == vhn::POSITION_SINUSOIDAL) {
+        const double angle =
+            pos * std::pow(10000.0, -2.0 * (j / 2) / kEmbed);
+        golden[t][j] += (j % 2 == 0) ? std::sin(angle) : std::cos(angle);
+      } else {
+        golden[t][j] += position_w[pos][j];
+      }
+      if (SEGMENTS > 0) {
+        golden[t][j] += segment_w[segments[t]][j];
+      }
+    }
+  }
+
+  const float(*pos_w)[kEmbed] =
+      POSITION == vhn::POSITION_SINUSOIDAL ? nullptr : position_w;
+  const int *seg = SEGMENTS > 0 ? segments : nullptr;
+  const float(*seg_w)[kEmbed] = SEGMENTS > 0 ? segment_w : nullptr;
+
+  static float ref[kMaxSeq][kEmbed], opt[kMaxSeq][kEmbed];
+  ref_t::emb(ref, tokens, seq_len, token_w, pos_w, seg, seg_w, start_pos);
+  opt_t::emb(opt, tokens, seq_len, token_w, pos_w, seg, seg_w, start_pos);
+
+  const int n = seq_len * kEmbed;
+  EXPECT_LT(ResultComparator::compare(&golden[0][0], &ref[0][0], n)
+                .max_abs_error,
+            1e-4f);
+  EXPECT_LT(ResultComparator::compare(&golden[0][0], &opt[0][0], n)
+                .max_abs_error,
+            1e-4f);
+}
+
+} // namespace
+
+TEST(FusedEmbeddingTest, LearnedPositions) {
+  run_fused_embedding<vhn::POSITION_LEARNED, 0>(20, 0);
+}
+
+TEST(FusedEmbeddingTest, LearnedPositionsWithSegments) {
+  run_fused_embedding<vhn::POSITION_LEARNED, kSegments>(17, 9);
+}
+
+TEST(FusedEmbeddingTest, SinusoidalPositions) {
+  run_fused_embedding<vhn::POSITION_SINUSOIDAL, 0>(kMaxSeq, 0);
+}
+
+// Decoding resumes mid-sequence; the recurrence must anchor at start_pos.
+TEST(FusedEmbeddingTest, SinusoidalWithSegmentsAndOffset) {
+  run_fused_embedding<vhn::POSITION_SINUSOIDAL, kSegments>(70, 85);
+}
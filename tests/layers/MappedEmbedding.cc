@@ -0,0 +1,64 @@
+#include <cstdio>
+#include <gtest/gtest.h>
+#include <string>
+#include <vhn.hh>
+
+namespace {
+
+constexpr int kVocab = 1000;
+constexpr int kEmbed = 48;
+
+using emb_hparams = vhn::EmbeddingHParams<kVocab, kEmbed>;
+using emb_t = vhn::Embedding<float, emb_hparams, void, OPT_NONE>;
+using mapped_t = vhn::MappedTensor<emb_t::Weight_t>;
+
+std::string temp_path(const char *name) {
+  return ::testing::TempDir() + name;
+}
+
+} // namespace
+
+TEST(MappedTensorTest, EmbeddingGatherFromMappedTable) {
+  BaseTestCase generator;
+  static emb_t::Weight_t table;
+  generator.generate_random_array(&table[0][0], kVocab * kEmbed);
+
+  // Place the table behind a small header to exercise a non-zero offset.
+  const std::string path = temp_path("vhn_mapped_embedding.bin");
+  constexpr std::size_t offset = 4096 + 64;
+  mapped_t::save(path, table, offset);
+
+  mapped_t weight(path, offset, vhn::MAP_ADVICE_RANDOM);
+  ASSERT_TRUE(weight.is_open());
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(weight.data()) %
+                mapped_t::alignment,
+            0u);
+
+  const int tokens[6] = {0, 999, 17, 17, 512, 3};
+  float ref[6][kEmbed], out[6][kEmbed];
+  emb_t::emb(ref, tokens, 6, table);
+  emb_t::emb(out, tokens, 6, weight.get());
+  for (int i = 0; i < 6; i++) {
+    for (int j = 0; j < kEmbed; j++) {
+      ASSERT_EQ(ref[i][j], out[i][j]);
+    }
+  }
+
+  mapped_t moved = std::move(weight);
+  EXPECT_FALSE(weight.is_open());
+  EXPECT_EQ(moved.get()[999][kEmbed - 1], table[999][kEmbed - 1]);
+  std::remove(path.c_str());
+}
+
+TEST(MappedTensorTest, RejectsMisalignedOffsetAndShortFile) {
+  const std::string path = temp_path("vhn_mapped_short.bin");
+  static float row[kEmbed] = {};
+  vhn::MappedTensor<float[kEmbed]>::save(path, row);
+
+  EXPECT_THROW((mapped_t(path)), std::runtime_error);
+  EXPECT_THROW((vhn::MappedTensor<float[kEmbed]>(path, 4)),
+               std::runtime_error);
+  EXPECT_NO_THROW((vhn::MappedTensor<float[kEmbed]>(path)));
+  EXPECT_THROW((mapped_t(temp_path("vhn_missing.bin"))), std::runtime_error);
+  std::remove(path.c_str());
+}
@@ -0,0 +1,290 @@
+#include <gtest/gtest.h>
+#include <vhn.hh>
+
+namespace {
+
+constexpr int kChannels = 6;
+
+using pool_config = vhn::Pool2dConfig<1, 2, 4>;
+
+template <vhn::PoolType POOL_TYPE, typename HParams>
+void pool2d_golden(float output[][HParams::out_width][HParams::out_height],
+                   const float input[][HParams::width][HParams::height]) {
+  for (int c = 0; c < HParams::channels; c++) {
+    for (int y = 0; y < HParams::out_width; y++) {
+      for (int x = 0; x < HParams::out_height; x++) {
+        float acc = (POOL_TYPE == vhn::POOL_MAX) ? -1e30f : 0.0f;
+        for (int ky = 0; ky < HParams::kernel_size; ky++) {
+          for (int kx = 0; kx < HParams::kernel_size; kx++) {
+            int iy = y * HParams::stride + ky - HParams::padding;
+            int ix = x * HParams::stride + kx - HParams::padding;
+            if (iy < 0 || iy >= HParams::width || ix < 0 ||
+                ix >= HParams::height) {
+              continue;
+            }
+            float v = input[c][iy][ix];
+            acc = (POOL_TYPE == vhn::POOL_MAX) ? std::max(acc, v) : acc + v;
+          }
+        }
+        if (POOL_TYPE == vhn::POOL_AVG) {
+          acc /= HParams::kernel_size * HParams::kernel_size;
+        }
+        output[c][y][x] = acc;
+      }
+    }
+  }
+}
+
+template <vhn::PoolType POOL_TYPE, typename HParams> void run_pool2d() {
+  using ref_t = vhn::Pool2d<float, HParams, void, OPT_NONE, POOL_TYPE>;
+  using opt_t =
+      vhn::Pool2d<float, HParams, pool_config, OPT_ENABLED, POOL_TYPE>;
+
+  BaseTestCase generator;
+  static typename ref_t::Input_t input[2];
+  static typename ref_t::Output_t golden[2], output_ref[2], output_opt[2];
+  constexpr int out_size =
+      HParams::channels * HParams::out_width * HParams::out_height;
+
+  generator.generate_random_array(&input[0][0][0][0],
+                                  sizeof(input) / sizeof(float));
+  pool2d_golden<POOL_TYPE, HParams>(golden[0], input[0]);
+  pool2d_golden<POOL_TYPE, HParams>(golden[1], input[1]);
+
+  ref_t::pool2d(output_ref, input, 2);
+  opt_t::pool2d(output_opt, input, 2);
+
+  EXPECT_LT(ResultComparator::compare(&output_ref[0][0][0][0],
+                                      &golden[0][0][0][0], 2 * out_size)
+                .max_abs_error,
+            1e-5f);
+  EXPECT_LT(ResultComparator::compare(&output_opt[0][0][0][0],
+                                      &golden[0][0][0][0], 2 * out_size)
+                .max_abs_error,
+            1e-5f);
+
+  // Stream form: pixels row-major with channels innermost.
+  vhn::stream<float> input_stream, output_stream;
+  for (int b = 0; b < 2; b++) {
+    for (int r = 0; r < HParams::width; r++) {
+      for (int c = 0; c < HParams::height; c++) {
+        for (int ch = 0; ch < HParams::channels; ch++) {
+          input_stream.write(input[b][ch][r][c]);
+        }
+      }
+    }
+  }
+  opt_t::pool2d(output_stream, input_stream, 2);
+
+  ASSERT_EQ(output_stream.size(), 2 * out_size);
+  float max_abs_error = 0.0f;
+  for (int b = 0; b < 2; b++) {
+    for (int r = 0; r < HParams::out_width; r++) {
+      for (int c = 0; c < HParams::out_height; c++) {
+        for (int ch = 0; ch < HParams::channels; ch++) {
+          max_abs_error =
+              std::max(max_abs_error,
+                       std::abs(output_stream.read() - golden[b][ch][r][c]));
+        }
+      }
+    }
+  }
+  EXPECT_LT(max_abs_error, 1e-5f);
+}
+
+} // namespace
+
+TEST(Pooling, MaxPool2d2x2) {
+  run_pool2d<vhn::POOL_MAX, vhn::Pool2dHParams<kChannels, 2, 2, 0, 8, 10>>();
+}
+
+TEST(Pooling, MaxPool2dOverlappingPadded) {
+  run_pool2d<vhn::POOL_MAX, vhn::Pool2dHParams<kChannels, 3, 2, 1, 9, 7>>();
+}
+
+TEST(Pooling, AvgPool2d2x2) {
+  run_pool2d<vhn::POOL_AVG, vhn::Pool2dHParams<kChannels, 2, 2, 0, 8, 10>>();
+}
+
+TEST(Pooling, AvgPool2dOverlappingPadded) {
+  run_pool2d<vhn::POOL_AVG, vhn::Pool2dHParams<kChannels, 3, 2, 1, 9, 7>>();
+}
+
+TEST(Pooling, MaxPool2dAliasesMatchGeneric) {
+  using hparams = vhn::Pool2dHParams<kChannels, 2, 2, 0, 4, 4>;
+  EXPECT_EQ((vhn::MaxPool2d<float, hparams>::pool_type), vhn::POOL_MAX);
+  EXPECT_EQ((vhn::AvgPool2d<float, hparams>::pool_type), vhn::POOL_AVG);
+  EXPECT_EQ(hparams::out_width, 2);
+}
+
+TEST(Pooling, GlobalAvgPool2d) {
+  using hparams = vhn::GlobalPool2dHParams<kChannels, 7, 5>;
+  using ref_t = vhn::GlobalAvgPool2d<float, hparams>;
+  using opt_t = vhn::GlobalAvgPool2d<float, hparams, pool_config, OPT_ENABLED>;
+  using max_t = vhn::GlobalMaxPool2d<float, hparams, pool_config, OPT_ENABLED>;
+
+  BaseTestCase generator;
+  float input[kChannels][7][5];
+  float golden_avg[kChannels], golden_max[kChannels];
+  float output_ref[kChannels], output_opt[kChannels], output_max[kChannels];
+  generator.generate_random_array(&input[0][0][0], kChannels * 35);
+
+  for (int c = 0; c < kChannels; c++) {
+    float sum = 0.0f, mx = -1e30f;
+    for (int y = 0; y < 7; y++) {
+      for (int x = 0; x < 5; x++) {
+        sum += input[c][y][x];
+        mx = std::max(mx, input[c][y][x]);
+      }
+    }
+    golden_avg[c] = sum / 35;
+    golden_max[c] = mx;
+  }
+
+  ref_t::pool2d(output_ref, input);
+  opt_t::pool2d(output_opt, input);
+  max_t::pool2d(output_max, input);
+
+  EXPECT_LT(ResultComparator::compare(output_ref, golden_avg, kChannels)
+                .max_abs_error,
+            1e-5f);
+  EXPECT_LT(ResultComparator::compare(output_opt, golden_avg, kChannels)
+                .max_abs_error,
+            1e-5f);
+  EXPECT_LT(ResultComparator::compare(output_max, golden_max, kChannels)
+                .max_abs_error,
+            1e-5f);
+
+  vhn::stream<float> input_stream, output_stream;
+  for (int y = 0; y < 7; y++) {
+    for (int x = 0; x < 5; x++) {
+      for (int c = 0; c < kChannels; c++) {
+        input_stream.write(input[c][y][x]);
+      }
+    }
+  }
+  opt_t::pool2d(output_stream, input_stream);
+  ASSERT_EQ(output_stream.size(), kChannels);
+  for (int c = 0; c < kChannels; c++) {
+    EXPECT_NEAR(output_stream.read(), golden_avg[c], 1e-5f);
+  }
+}
+
+TEST(Pooling, Pool1d) {
+  using hparams = vhn::Pool1dHParams<kChannels, 3, 2, 1, 21>;
+  using max_ref_t = vhn::MaxPool1d<float, hparams>;
+  using max_opt_t = vhn::MaxPool1d<float, hparams,
+                                   vhn::Pool1dConfig<1, 2, 4>, OPT_ENABLED>;
+  using avg_opt_t = vhn::AvgPool1d<float, hparams,
+                                   vhn::Pool1dConfig<1, 2, 4>, OPT_ENABLED>;
+  constexpr int out_length = hparams::out_length;
+  EXPECT_EQ(out_length, 11);
+
+  BaseTestCase generator;
+  float input[kChannels][21];
+  float golden_max[kChannels][out_length], golden_avg[kChannels][out_length];
+  float output_ref[kChannels][out_length], output_opt[kChannels][out_length],
+      output_avg[kChannels][out_length];
+  generator.generate_random_array(&input[0][0], kChannels * 21);
+
+  for (int c = 0; c < kChannels; c++) {
+    for (int pos = 0; pos < out_length; pos++) {
+      float mx = -1e30f, sum = 0.0f;
+      for (int k = 0; k < 3; k++) {
+        int i = pos * 2 + k - 1;
+        if (i >= 0 && i < 21) {
+          mx = std::max(mx, input[c][i]);
+          sum += input[c][i];
+        }
+      }
+      golden_max[c][pos] = mx;
+      golden_avg[c][pos] = sum / 3;
+    }
+  }
+
+  max_ref_t::pool1d(output_ref, input);
+  max_opt_t::pool1d(output_opt, input);
+  avg_opt_t::pool1d(output_avg, input);
+  EXPECT_LT(ResultComparator::compare(&output_ref[0][0], &golden_max[0][0],
+                                      kChannels * out_length)
+                .max_abs_error,
+            1e-5f);
+  EXPECT_LT(ResultComparator::compare(&output_opt[0][0], &golden_max[0][0],
+                                      kChannels * out_length)
+                .max_abs_error,
+            1e-5f);
+  EXPECT_LT(ResultComparator::compare(&output_avg[0][0], &golden_avg[0][0],
+                                      kChannels * out_length)
+                .max_abs_error,
+            1e-5f);
+
+  vhn::stream<float> input_stream, output_stream;
+  for (int i = 0; i < 21; i++) {
+    for (int c = 0; c < kChannels; c++) {
+      input_stream.write(input[c][i]);
+    }
+  }
+  max_opt_t::pool1d(output_stream, input_stream);
+  ASSERT_EQ(output_stream.size(), kChannels * out_length);
+  float max_abs_error = 0.0f;
+  for (int pos = 0; pos < out_length; pos++) {
+    for (int c = 0; c < kChannels; c++) {
+      max_abs_error = std::max(
+          max_abs_error, std::abs(output_stream.read() - golden_max[c][pos]));
+    }
+  }
+  EXPECT_LT(max_abs_error, 1e-5f);
+
+  using global_t = vhn::GlobalAvgPool1d<float, vhn::GlobalPool1dHParams<
+                                                   kChannels, 21>>;
+  float global_out[kChannels];
+  global_t::pool1d(global_out, input);
+  for (int c = 0; c < kChannels; c++) {
+    float sum = 0.0f;
+    for (int i = 0; i < 21; i++) {
+      sum += input[c][i];
+    }
+    EXPECT_NEAR(global_out[c], sum / 21, 1e-5f);
+  }
+}
+
+template <vhn::PoolType POOL_TYPE, int POOL_K, int POOL_S, int POOL_P,
+          typename ConvHParams>
+void run_conv_pool() {
+  using hparams =
+      vhn::Conv2dPool2dHParams<ConvHParams, POOL_TYPE, POOL_K, POOL_S, POOL_P>;
+  using ref_t = vhn::Conv2dPool2d<float, hparams, void, OPT_NONE>;
+  using opt_t = vhn::Conv2dPool2d<float, hparams,
+                                  vhn::Conv2dPool2dConfig<1, 2, 4>,
+                                  OPT_ENABLED>;
+
+  BaseTestCase generator;
+  static typename ref_t::Input_t input;
+  static typename ref_t::Weight_t weight;
+  static typename ref_t::Bias_t bias;
+  static typename ref_t::Output_t output_ref, output_opt;
+
+  generator.generate_random_array(&input[0][0][0],
+                                  sizeof(input) / sizeof(float));
+  generator.generate_random_array(&weight[0][0][0][0],
+                                  sizeof(weight) / sizeof(float));
+  generator.generate_random_array(bias, ref_t::out_channels);
+
+  ref_t::conv_pool2d(output_ref, input, weight, bias);
+  opt_t::conv_pool2d(output_opt, input, weight, bias);
+
+  auto result = ResultComparator::compare(&output_opt[0][0][0],
+                                          &output_ref[0][0][0],
+                                          sizeof(output_ref) / sizeof(float));
+  EXPECT_LT(result.max_abs_error, 1e-5f);
+}
+
+TEST(Pooling, FusedConvMaxPool) {
+  run_conv_pool<vhn::POOL_MAX, 2, 2, 0,
+                vhn::Conv2dHParams<4, 8, 3, 1, 12, 10>>();
+}
+
+TEST(Pooling, FusedConvAvgPoolOverlapping) {
+  run_conv_pool<vhn::POOL_AVG, 3, 2, 1,
+                vhn::Conv2dHParams<4, 6, 3, 0, 13, 11, 1, 1, 2>>();
+}
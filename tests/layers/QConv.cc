@@ -0,0 +1,147 @@
+#include <algorithm>
+#include <cmath>
+#include <gtest/gtest.h>
+#include <vhn.hh>
+
+namespace {
+
+using qconv1d_config = vhn::QConv1dConfig<1, 2, 4>;
+using qconv2d_config = vhn::QConv2dConfig<1, 2, 4>;
+
+float max_abs(const float *x, int n) {
+  float m = 0.0f;
+  for (int i = 0; i < n; i++) {
+    m = std::max(m, std::fabs(x[i]));
+  }
+  return m;
+}
+
+// Quantizes a float layer (per-tensor activations, per-channel weights),
+// runs both int8 variants and checks them against the float convolution.
+// FloatConv / QRef / QOpt share the tensor shapes of the layer.
+template <typename FloatConv, typename QRef, typename QOpt, bool RELU,
+          typename RunFloat, typename RunQ>
+void run_quantized(RunFloat run_float, RunQ run_q) {
+  constexpr int in_size =
+      sizeof(typename FloatConv::Input_t) / sizeof(float);
+  constexpr int w_size = sizeof(typename FloatConv::Weight_t) / sizeof(float);
+  constexpr int out_size =
+      sizeof(typename FloatConv::Output_t) / sizeof(float);
+  constexpr int channels = FloatConv::out_channels;
+
+  BaseTestCase generator;
+
+  static typename FloatConv::Input_t input;
+  static typename FloatConv::Weight_t weight;
+  static typename FloatConv::Bias_t bias;
+  static typename FloatConv::Output_t golden;
+  generator.generate_random_array(reinterpret_cast<float *>(input), in_size);
+  generator.generate_random_array(reinterpret_cast<float *>(weight), w_size);
+  generator.generate_random_array(bias, channels, 0.1f);
+
+  run_float(golden, input, weight, bias);
+  float *golden_flat = reinterpret_cast<float *>(golden);
+  if (RELU) {
+    for (int i = 0; i < out_size; i++) {
+      golden_flat[i] = std::max(golden_flat[i], 0.0f);
+    }
+  }
+
+  const float in_scale =
+      vhn::Quant::scale_for(reinterpret_cast<float *>(input), in_size);
+  const float out_scale = max_abs(golden_flat, out_size) / vhn::Quant::qmax;
+
+  static typename QRef::Input_t q_input;
+  static typename QRef::Weight_t q_weight;
+  static typename QRef::Bias_t q_bias;
+  static typename QRef::Multiplier_t multiplier;
+  static typename QRef::Shift_t shift;
+  static float w_scales[channels];
+
+  vhn::Quant::quantize_array(reinterpret_cast<vhn::qint8_t *>(q_input),
+                             reinterpret_cast<float *>(input), in_size,
+                             in_scale);
+  vhn::Quant::quantize_per_channel(reinterpret_cast<vhn::qint8_t *>(q_weight),
+                                   w_scales, reinterpret_cast<float *>(weight),
+                                   channels, w_size / channels);
+  vhn::Quant::prepare_requant(q_bias, multiplier, shift, bias, w_scales,
+                              in_scale, out_scale, channels);
+
+  static typename QRef::Output_t q_ref, q_opt;
+  run_q(q_ref, q_opt, q_input, q_weight, q_bias, multiplier, shift);
+
+  const vhn::qint8_t *ref_flat = reinterpret_cast<vhn::qint8_t *>(q_ref);
+  const vhn::qint8_t *opt_flat = reinterpret_cast<vhn::qint8_t *>(q_opt);
+  static float dequant[out_size];
+  vhn::Quant::dequantize_array(dequant, ref_flat, out_size, out_scale);
+
+  for (int i = 0; i < out_size; i++) {
+    ASSERT_EQ(ref_flat[i], opt_flat[i]) << "index " << i;
+    if (RELU) {
+      ASSERT_GE(ref_flat[i], 0);
+    }
+  }
+  // A few output LSBs of drift from quantizing inputs and weights.
+  EXPECT_LT(ResultComparator::compare(golden_flat, dequant, out_size)
+                .max_abs_error,
+            4.0f * out_scale);
+}
+
+template <typename ConvHParams, bool RELU> void run_qconv2d() {
+  using float_t = vhn::Conv2d<float, ConvHParams, void, OPT_NONE>;
+  using hparams = vhn::QConv2dHParams<ConvHParams, RELU>;
+  using ref_t = vhn::QConv2d<vhn::qint8_t, hparams, void, OPT_NONE>;
+  using opt_t =
+      vhn::QConv2d<vhn::qint8_t, hparams, qconv2d_config, OPT_ENABLED>;
+
+  run_quantized<float_t, ref_t, opt_t, RELU>(
+      [](auto out, auto in, auto w, auto b) { float_t::conv2d(out, in, w, b); },
+      [](auto ref, auto opt, auto in, auto w, auto b, auto m, auto s) {
+        ref_t::conv2d(ref, in, w, b, m, s);
+        opt_t::conv2d(opt, in, w, b, m, s);
+      });
+}
+
+template <typename ConvHParams, bool RELU> void run_qconv1d() {
+  using float_t = vhn::Conv1d<float, ConvHParams, void, OPT_NONE>;
+  using hparams = vhn::QConv1dHParams<ConvHParams, RELU>;
+  using ref_t = vhn::QConv1d<vhn::qint8_t, hparams, void, OPT_NONE>;
+  using opt_t =
+      vhn::QConv1d<vhn::qint8_t, hparams, qconv1d_config, OPT_ENABLED>;
+
+  run_quantized<float_t, ref_t, opt_t, RELU>(
+      [](auto out, auto in, auto w, auto b) { float_t::conv1d(out, in, w, b); },
+      [](auto ref, auto opt, auto in, auto w, auto b, auto m, auto s) {
+        ref_t::conv1d(ref, in, w, b, m, s);
+        opt_t::conv1d(opt, in, w, b, m, s);
+      });
+}
+
+} // namespace
+
+TEST(QConvTest, RequantizeRoundsAndSaturates) {
+  vhn::qint32_t multiplier;
+  int shift;
+  vhn::Quant::quantize_multiplier(0.25, multiplier, shift);
+  EXPECT_EQ(vhn::Quant::requantize<false>(10, multiplier, shift), 3);
+  EXPECT_EQ(vhn::Quant::requantize<false>(-10, multiplier, shift), -2);
+  EXPECT_EQ(vhn::Quant::requantize<false>(1000, multiplier, shift), 127);
+  EXPECT_EQ(vhn::Quant::requantize<false>(-1000, multiplier, shift), -128);
+  EXPECT_EQ(vhn::Quant::requantize<true>(-10, multiplier, shift), 0);
+}
+
+TEST(QConvTest, Conv2dMatchesFloat) {
+  run_qconv2d<vhn::Conv2dHParams<4, 8, 3, 1, 12, 10>, false>();
+}
+
+TEST(QConvTest, Conv2dReLUStrideGroups) {
+  run_qconv2d<vhn::Conv2dHParams<4, 6, 3, 1, 13, 11, 2, 1, 2>, true>();
+}
+
+TEST(QConvTest, Conv1dMatchesFloat) {
+  run_qconv1d<vhn::Conv1dHParams<6, 8, 5, 2, 40>, false>();
+}
+
+TEST(QConvTest, Conv1dReLUDilation) {
+  run_qconv1d<vhn::Conv1dHParams<4, 4, 3, 2, 33, 1, 2, 2>, true>();
+}
@@ -0,0 +1,65 @@
+#include <gtest/gtest.h>
+#include <vhn.hh>
+
+namespace {
+
+constexpr int kVocab = 64;
+constexpr int kEmbed = 37;
+
+using qemb_config = vhn::QEmbeddingConfig<1, 2, 4>;
+
+// Quantizes a random table, gathers a token sequence through both variants
+// and checks each element against the float table to within half a step of
+// its row's scale.
+template <int BITS> void run_qembedding() {
+  using hparams = vhn::QEmbeddingHParams<kVocab, kEmbed, BITS>;
+  using ref_t = vhn::QEmbedding<float, hparams, void, OPT_NONE>;
+  using opt_t = vhn::QEmbedding<float, hparams, qemb_config, OPT_ENABLED>;
+
+  BaseTestCase generator;
+  static float table[kVocab][kEmbed];
+  generator.generate_random_array(&table[0][0], kVocab * kEmbed);
+
+  static typename ref_t::Weight_t weight;
+  static typename ref_t::Scale_t scale;
+  static typename ref_t::Offset_t offset;
+  ref_t::quantize(weight, scale, offset, &table[0][0]);
+
+  constexpr int kLength = 20;
+  int tokens[kLength];
+  for (int i = 0; i < kLength; i++) {
+    tokens[i] = (i * 29 + 3) % kVocab;
+  }
+
+  static float ref[kLength][kEmbed], opt[kLength][kEmbed];
+  ref_t::emb(&ref[0][0], tokens, kLength, weight, scale, offset);
+  opt_t::emb(opt, tokens, kLength, weight, scale, offset);
+
+  for (int i = 0; i < kLength; i++) {
+    const int v = tokens[i];
+    for (int j = 0; j < kEmbed; j++) {
+      ASSERT_EQ(ref[i][j], opt[i][j]) << "token " << i << " dim " << j;
+      EXPECT_NEAR(ref[i][j], table[v][j], 0.5f * scale[v] + 1e-6f);
+    }
+  }
+
+  float single[kEmbed];
+  opt_t::emb(single, tokens[5], weight, scale, offset);
+  for (int j = 0; j < kEmbed; j++) {
+    EXPECT_EQ(single[j], ref[5][j]);
+  }
+}
+
+} // namespace
+
+TEST(QEmbeddingTest, Int8Rows) {
+  run_qembedding<8>();
+  using hparams = vhn::QEmbeddingHParams<kVocab, kEmbed, 8>;
+  EXPECT_EQ(hparams::row_bytes, kEmbed);
+}
+
+TEST(QEmbeddingTest, Packed4BitRows) {
+  run_qembedding<4>();
+  using hparams = vhn::QEmbeddingHParams<kVocab, kEmbed, 4>;
+  EXPECT_EQ(hparams::row_bytes, (kEmbed + 1) / 2);
+}
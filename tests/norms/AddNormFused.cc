@@ -0,0 +1,81 @@
+#include <gtest/gtest.h>
+#include <vhn.hh>
+
+namespace {
+
+constexpr int kDModel = 256;
+constexpr int kSeqLen = 8;
+
+using ln_hparams = vhn::LayerNormHParams<kDModel>;
+using ln_config = vhn::LayerNormConfig<1, 4, 4, vhn::LN_WELFORD>;
+
+template <NormType NORM_TYPE>
+using addnorm_hparams = vhn::AddNormHParams<ln_hparams, NORM_TYPE>;
+
+template <NormType NORM_TYPE>
+using addnorm_ref_t =
+    vhn::AddNorm<float, addnorm_hparams<NORM_TYPE>, void, OPT_NONE>;
+
+template <NormType NORM_TYPE, typename NORM_CONFIG, bool FUSED>
+using addnorm_opt_t =
+    vhn::AddNorm<float, addnorm_hparams<NORM_TYPE>,
+                 vhn::AddNormConfig<NORM_CONFIG, void, 4, FUSED>, OPT_ENABLED>;
+
+template <typename Ref, typename Dut> void run_addnorm(const float tolerance) {
+  BaseTestCase generator;
+
+  static float input[kSeqLen][kDModel];
+  static float residual[kSeqLen][kDModel];
+  static float gamma[kDModel];
+  static float beta[kDModel];
+  static float output_ref[kSeqLen][kDModel];
+  static float output_dut[kSeqLen][kDModel];
+  static float output_row[kDModel];
+
+  generator.generate_random_array(&input[0][0], kSeqLen * kDModel);
+  generator.generate_random_array(&residual[0][0], kSeqLen * kDModel);
+  generator.generate_random_array(gamma, kDModel);
+  generator.generate_random_array(beta, kDModel);
+
+  Ref::forward(output_ref, input, residual, kSeqLen, gamma, beta);
+  Dut::forward(output_dut, input, residual, kSeqLen, gamma, beta);
+
+  auto result = ResultComparator::compare(&output_dut[0][0], &output_ref[0][0],
+                                          kSeqLen * kDModel);
+  EXPECT_LT(result.max_abs_error, tolerance);
+
+  Dut::forward(output_row, input[kSeqLen - 1], residual[kSeqLen - 1], gamma,
+               beta);
+  auto row_result =
+      ResultComparator::compare(output_row, output_ref[kSeqLen - 1], kDModel);
+  EXPECT_LT(row_result.max_abs_error, tolerance);
+}
+
+} // namespace
+
+TEST(AddNormFused, PostNormMatchesReference) {
+  run_addnorm<addnorm_ref_t<POSTNORM>,
+              addnorm_opt_t<POSTNORM, ln_config, true>>(1e-4f);
+}
+
+TEST(AddNormFused, PreNormMatchesReference) {
+  run_addnorm<addnorm_ref_t<PRENORM>, addnorm_opt_t<PRENORM, ln_config, true>>(
+      1e-4f);
+}
+
+TEST(AddNormFused, PostNormUnoptimizedNorm) {
+  run_addnorm<addnorm_ref_t<POSTNORM>, addnorm_opt_t<POSTNORM, void, true>>(
+      1e-5f);
+}
+
+TEST(AddNormFused, PreNormUnoptimizedNorm) {
+  run_addnorm<addnorm_ref_t<PRENORM>, addnorm_opt_t<PRENORM, void, true>>(
+      1e-5f);
+}
+
+TEST(AddNormFused, UnfusedPathUnchanged) {
+  run_addnorm<addnorm_ref_t<POSTNORM>,
+              addnorm_opt_t<POSTNORM, ln_config, false>>(1e-4f);
+  run_addnorm<addnorm_ref_t<PRENORM>, addnorm_opt_t<PRENORM, ln_config, false>>(
+      1e-4f);
+}
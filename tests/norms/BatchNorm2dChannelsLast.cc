@@ -0,0 +1,93 @@
+#include <gtest/gtest.h>
+#include <vhn.hh>
+
+namespace {
+
+constexpr int kChannels = 12;
+constexpr int kWidth = 7;
+constexpr int kHeight = 5;
+
+using bn_ref_t = vhn::BatchNorm2d<float, kChannels, kWidth, kHeight>;
+using bn_nhwc_t =
+    vhn::BatchNorm2d<float, kChannels, kWidth, kHeight,
+                     vhn::BatchNorm2dConfig<1, 4, 4, vhn::LAYOUT_NHWC>,
+                     OPT_ENABLED>;
+
+// BatchNorm2d tensors are [C][HEIGHT][WIDTH], i.e. NCHW with the spatial
+// dimensions in (HEIGHT, WIDTH) order.
+using layout = vhn::LayoutTransform<float, kChannels, kHeight, kWidth>;
+
+struct BNParams {
+  float weight[kChannels];
+  float bias[kChannels];
+  float mean[kChannels];
+  float var[kChannels];
+
+  BNParams() {
+    BaseTestCase generator;
+    generator.generate_random_array(weight, kChannels);
+    generator.generate_random_array(bias, kChannels);
+    generator.generate_random_array(mean, kChannels);
+    generator.generate_random_array(var, kChannels);
+    for (int c = 0; c < kChannels; c++) {
+      var[c] = std::abs(var[c]) + 0.1f;
+    }
+  }
+};
+
+} // namespace
+
+TEST(BatchNorm2dChannelsLast, Tensor3dMatchesReference) {
+  BaseTestCase generator;
+  BNParams p;
+
+  static float input[2][kChannels][kHeight][kWidth];
+  static float output_ref[2][kChannels][kHeight][kWidth];
+  static float output_back[2][kChannels][kHeight][kWidth];
+  static float input_nhwc[2][kHeight][kWidth][kChannels];
+  static float output_nhwc[2][kHeight][kWidth][kChannels];
+
+  generator.generate_random_array(&input[0][0][0][0],
+                                  2 * kChannels * kHeight * kWidth);
+  layout::to_nhwc(input_nhwc, input, 2);
+
+  bn_ref_t::bn2d(output_ref, input, 2, p.weight, p.bias, p.mean, p.var);
+  bn_nhwc_t::bn2d(output_nhwc, input_nhwc, 2, p.weight, p.bias, p.mean, p.var);
+  layout::to_nchw(output_back, output_nhwc, 2);
+
+  auto result =
+      ResultComparator::compare(&output_back[0][0][0][0],
+                                &output_ref[0][0][0][0],
+                                2 * kChannels * kHeight * kWidth);
+  EXPECT_LT(result.max_abs_error, 1e-5f);
+}
+
+TEST(BatchNorm2dChannelsLast, Tensor2dMatchesReference) {
+  constexpr int spatial = kHeight * kWidth;
+  BaseTestCase generator;
+  BNParams p;
+
+  static float input[kChannels][spatial];
+  static float output_ref[kChannels][spatial];
+  static float input_nhwc[spatial][kChannels];
+  static float output_nhwc[spatial][kChannels];
+
+  generator.generate_random_array(&input[0][0], kChannels * spatial);
+  for (int c = 0; c < kChannels; c++) {
+    for (int s = 0; s < spatial; s++) {
+      input_nhwc[s][c] = input[c][s];
+    }
+  }
+
+  bn_ref_t::bn2d(output_ref, input, p.weight, p.bias, p.mean, p.var);
+  bn_nhwc_t::bn2d(output_nhwc, input_nhwc, p.weight, p.bias, p.mean, p.var);
+
+  float max_abs_error = 0.0f;
+  for (int c = 0; c < kChannels; c++) {
+    for (int s = 0; s < spatial; s++) {
+      max_abs_error = std::max(max_abs_error,
+                               std::abs(output_nhwc[s][c] - output_ref[c][s]));
+    }
+  }
+  EXPECT_LT(max_abs_error, 1e-5f);
+}
@@ -0,0 +1,102 @@
+#include <gtest/gtest.h>
+#include <vhn.hh>
+
+namespace {
+
+constexpr int kInChannels = 3;
+constexpr int kOutChannels = 8;
+constexpr int kKernel = 3;
+constexpr int kSize = 8;
+
+void generate_bn_params(BaseTestCase &generator, float *bn_weight,
+                        float *bn_bias, float *running_mean,
+                        float *running_var, const int channels) {
+  generator.generate_random_array(bn_weight, channels);
+  generator.generate_random_array(bn_bias, channels);
+  generator.generate_random_array(running_mean, channels);
+  generator.generate_random_array(running_var, channels);
+  for (int c = 0; c < channels; c++) {
+    running_var[c] = running_var[c] * running_var[c] + 0.1f;
+  }
+}
+
+} // namespace
+
+TEST(BatchNormFold, Conv2dBatchNorm2d) {
+  using conv_t =
+      vhn::Conv2d<float,
+                  vhn::Conv2dHParams<kInChannels, kOutChannels, kKernel, 1,
+                                     kSize, kSize>,
+                  void, OPT_NONE>;
+  using bn_t = vhn::BatchNorm2d<float, kOutChannels, conv_t::out_width,
+                                conv_t::out_height, void, OPT_NONE>;
+  using fold_t = vhn::BatchNormFold<conv_t>;
+
+  BaseTestCase generator;
+
+  static conv_t::Input_t input;
+  static conv_t::Weight_t weight, folded_weight;
+  static conv_t::Bias_t bias, folded_bias;
+  static conv_t::Output_t conv_out, bn_out, folded_out;
+  float bn_weight[kOutChannels], bn_bias[kOutChannels];
+  float running_mean[kOutChannels], running_var[kOutChannels];
+
+  generator.generate_random_array(&input[0][0][0],
+                                  kInChannels * kSize * kSize);
+  generator.generate_random_array(&weight[0][0][0][0],
+                                  kOutChannels * kInChannels * kKernel *
+                                      kKernel);
+  generator.generate_random_array(bias, kOutChannels);
+  generate_bn_params(generator, bn_weight, bn_bias, running_mean, running_var,
+                     kOutChannels);
+
+  conv_t::conv2d(conv_out, input, weight, bias);
+  bn_t::bn2d(bn_out, conv_out, bn_weight, bn_bias, running_mean, running_var);
+
+  fold_t::fold(folded_weight, folded_bias, weight, bias, bn_weight, bn_bias,
+               running_mean, running_var);
+  conv_t::conv2d(folded_out, input, folded_weight, folded_bias);
+
+  auto result = ResultComparator::compare(
+      &folded_out[0][0][0], &bn_out[0][0][0],
+      kOutChannels * conv_t::out_width * conv_t::out_height);
+  EXPECT_LT(result.max_abs_error, 1e-4f);
+}
+
+TEST(BatchNormFold, LinearBatchNorm1dInPlace) {
+  constexpr int kInFeatures = 32;
+  constexpr int kOutFeatures = 16;
+
+  using linear_t =
+      vhn::Linear<float, vhn::LinearHParams<kInFeatures, kOutFeatures>, void,
+                  OPT_NONE>;
+  using bn_t =
+      vhn::BatchNorm1d<float, vhn::BatchNorm1dHParams<kOutFeatures>, void,
+                       OPT_NONE>;
+  using fold_t = vhn::BatchNormFold<linear_t>;
+
+  BaseTestCase generator;
+
+  float input[kInFeatures];
+  linear_t::Weight_t weight;
+  linear_t::Bias_t bias;
+  float lin_out[kOutFeatures], bn_out[kOutFeatures], folded_out[kOutFeatures];
+  float bn_weight[kOutFeatures], bn_bias[kOutFeatures];
+  float running_mean[kOutFeatures], running_var[kOutFeatures];
+
+  generator.generate_random_array(input, kInFeatures);
+  generator.generate_random_array(&weight[0][0], kOutFeatures * kInFeatures);
+  generator.generate_random_array(bias, kOutFeatures);
+  generate_bn_params(generator, bn_weight, bn_bias, running_mean, running_var,
+                     kOutFeatures);
+
+  linear_t::lin(lin_out, input, weight, bias);
+  bn_t::bn1d(bn_out, lin_out, bn_weight, bn_bias, running_mean, running_var);
+
+  fold_t::fold(weight, bias, weight, bias, bn_weight, bn_bias, running_mean,
+               running_var);
+  linear_t::lin(folded_out, input, weight, bias);
+
+  auto result = ResultComparator::compare(folded_out, bn_out, kOutFeatures);
+  EXPECT_LT(result.max_abs_error, 1e-4f);
+}
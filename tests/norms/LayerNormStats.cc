@@ -0,0 +1,126 @@
+#include <gtest/gtest.h>
+#include <vhn.hh>
+
+namespace {
+
+constexpr int kHiddenDim = 1024;
+constexpr int kSeqLen = 4;
+
+using ln_hparams = vhn::LayerNormHParams<kHiddenDim>;
+using ln_ref_t = vhn::LayerNorm<float, ln_hparams, void, OPT_NONE>;
+
+template <vhn::LayerNormStats MODE>
+using ln_opt_t = vhn::LayerNorm<float, ln_hparams,
+                                vhn::LayerNormConfig<1, 4, 4, MODE>,
+                                OPT_ENABLED>;
+
+// Double-precision two-pass LayerNorm used as the ground truth.
+void ln_golden(float *output, const float *input, const float *gamma,
+               const float *beta, const float epsilon = 1e-5f) {
+  double mean = 0.0;
+  for (int i = 0; i < kHiddenDim; i++) {
+    mean += input[i];
+  }
+  mean /= kHiddenDim;
+
+  double variance = 0.0;
+  for (int i = 0; i < kHiddenDim; i++) {
+    double diff = input[i] - mean;
+    variance += diff * diff;
+  }
+  variance /= kHiddenDim;
+
+  double inv_std = 1.0 / std::sqrt(variance + epsilon);
+  for (int i = 0; i < kHiddenDim; i++) {
+    output[i] = static_cast<float>(gamma[i] * (input[i] - mean) * inv_std +
+                                   beta[i]);
+  }
+}
+
+template <vhn::LayerNormStats MODE> class LayerNormStatsTest {
+public:
+  static void run(const float offset, const float tolerance) {
+    BaseTestCase generator;
+
+    static float input[kSeqLen][kHiddenDim];
+    static float gamma[kHiddenDim];
+    static float beta[kHiddenDim];
+    static float output_ref[kSeqLen][kHiddenDim];
+    static float output_dut[kSeqLen][kHiddenDim];
+    static float output_golden[kHiddenDim];
+
+    generator.generate_random_array(&input[0][0], kSeqLen * kHiddenDim);
+    generator.generate_random_array(gamma, kHiddenDim);
+    generator.generate_random_array(beta, kHiddenDim);
+    for (int s = 0; s < kSeqLen; s++) {
+      for (int i = 0; i < kHiddenDim; i++) {
+        input[s][i] += offset;
+      }
+    }
+
+    ln_ref_t::ln(output_ref, input, kSeqLen, gamma, beta);
+    ln_opt_t<MODE>::ln(output_dut, input, kSeqLen, gamma, beta);
+
+    for (int s = 0; s < kSeqLen; s++) {
+      ln_golden(output_golden, input[s], gamma, beta);
+
+      auto vs_ref =
+          ResultComparator::compare(output_dut[s], output_ref[s], kHiddenDim);
+      auto vs_golden =
+          ResultComparator::compare(output_dut[s], output_golden, kHiddenDim);
+
+      EXPECT_LT(vs_ref.max_abs_error, tolerance) << "row " << s;
+      EXPECT_LT(vs_golden.max_abs_error, tolerance) << "row " << s;
+    }
+  }
+};
+
+} // namespace
+
+TEST(LayerNormStats, TwoPassMatchesReference) {
+  LayerNormStatsTest<vhn::LN_TWO_PASS>::run(0.0f, 1e-5f);
+}
+
+TEST(LayerNormStats, WelfordMatchesTwoPass) {
+  LayerNormStatsTest<vhn::LN_WELFORD>::run(0.0f, 1e-4f);
+}
+
+TEST(LayerNormStats, SumSqMatchesTwoPass) {
+  LayerNormStatsTest<vhn::LN_SUMSQ>::run(0.0f, 1e-4f);
+}
+
+TEST(LayerNormStats, SumSqKahanMatchesTwoPass) {
+  LayerNormStatsTest<vhn::LN_SUMSQ_KAHAN>::run(0.0f, 1e-4f);
+}
+
+TEST(LayerNormStats, WelfordLargeOffset) {
+  LayerNormStatsTest<vhn::LN_WELFORD>::run(1000.0f, 1e-2f);
+}
+
+TEST(LayerNormStats, SumSqLargeOffset) {
+  LayerNormStatsTest<vhn::LN_SUMSQ>::run(1000.0f, 1e-2f);
+}
+
+TEST(LayerNormStats, SumSqKahanLargeOffset) {
+  LayerNormStatsTest<vhn::LN_SUMSQ_KAHAN>::run(1000.0f, 1e-2f);
+}
+
+TEST(LayerNormStats, SingleRowOverload) {
+  BaseTestCase generator;
+
+  float input[kHiddenDim];
+  float gamma[kHiddenDim];
+  float beta[kHiddenDim];
+  float output_ref[kHiddenDim];
+  float output_dut[kHiddenDim];
+
+  generator.generate_random_array(input, kHiddenDim, 4.0f);
+  generator.generate_ones_array(gamma, kHiddenDim);
+  generator.generate_zeros_array(beta, kHiddenDim);
+
+  ln_ref_t::ln(output_ref, input, gamma, beta);
+  ln_opt_t<vhn::LN_WELFORD>::ln(output_dut, input, gamma, beta);
+
+  auto result = ResultComparator::compare(output_dut, output_ref, kHiddenDim);
+  EXPECT_LT(result.max_abs_error, 1e-4f);
+}
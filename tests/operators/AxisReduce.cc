@@ -0,0 +1,89 @@
+#include <gtest/gtest.h>
+#include <vhn.hh>
+
+namespace {
+
+using config = vhn::ReduceConfig<1, 4, 4, true>;
+
+// Direct strided golden over the [outer][len][inner] view.
+template <typename Shape, typename Op>
+void golden_reduce(float *output, const float *input, Op op,
+                   const bool mean) {
+  for (int o = 0; o < Shape::outer; o++) {
+    for (int j = 0; j < Shape::inner; j++) {
+      float acc = input[o * Shape::len * Shape::inner + j];
+      for (int k = 1; k < Shape::len; k++) {
+        acc = op(acc, input[(o * Shape::len + k) * Shape::inner + j]);
+      }
+      output[o * Shape::inner + j] = mean ? acc / Shape::len : acc;
+    }
+  }
+}
+
+template <int AXIS, int D0, int D1, int D2> void run_axis_reduce() {
+  using shape = vhn::AxisShape<AXIS, D0, D1, D2>;
+  using sum_t = vhn::ReduceSumAxis<float, AXIS, D0, D1, D2>;
+  using mean_t = vhn::ReduceMeanAxis<float, AXIS, D0, D1, D2, config,
+                                     OPT_ENABLED>;
+  using max_t = vhn::ReduceMaxAxis<float, AXIS, D0, D1, D2, config,
+                                   OPT_ENABLED>;
+  constexpr int size = shape::size;
+  constexpr int reduced = shape::reduced_size;
+
+  BaseTestCase generator;
+  static float input[size];
+  static float golden[reduced], output[reduced];
+  generator.generate_random_array(input, size);
+  for (int i = 0; i < size; i++) {
+    input[i] -= 2.0f; // all-negative, so max must not start from zero
+  }
+
+  auto add = [](float x, float y) { return x + y; };
+  auto max = [](float x, float y) { return x > y ? x : y; };
+
+  golden_reduce<shape>(golden, input, add, false);
+  sum_t::reduce(output, input);
+  EXPECT_LT(ResultComparator::compare(output, golden, reduced).max_abs_error,
+            1e-4f);
+
+  golden_reduce<shape>(golden, input, add, true);
+  mean_t::reduce(output, input);
+  EXPECT_LT(ResultComparator::compare(output, golden, reduced).max_abs_error,
+            1e-5f);
+
+  golden_reduce<shape>(golden, input, max, false);
+  max_t::reduce(output, input);
+  EXPECT_LT(ResultComparator::compare(output, golden, reduced).max_abs_error,
+            1e-7f);
+
+  vhn::stream<float> in_stream, out_stream;
+  for (int i = 0; i < size; i++) {
+    in_stream.write(input[i]);
+  }
+  max_t::reduce(out_stream, in_stream);
+  for (int i = 0; i < reduced; i++) {
+    output[i] = out_stream.read();
+  }
+  EXPECT_LT(ResultComparator::compare(output, golden, reduced).max_abs_error,
+            1e-7f);
+}
+
+} // namespace
+
+TEST(AxisReduceTest, Shape) {
+  using chw = vhn::AxisShape<1, 3, 4, 5>;
+  EXPECT_EQ(chw::outer, 3);
+  EXPECT_EQ(chw::len, 4);
+  EXPECT_EQ(chw::inner, 5);
+  EXPECT_EQ(chw::reduced_size, 15);
+}
+
+TEST(AxisReduceTest, Columns) { run_axis_reduce<0, 13, 24, 1>(); }
+
+TEST(AxisReduceTest, Rows) { run_axis_reduce<1, 13, 24, 1>(); }
+
+TEST(AxisReduceTest, Channels) { run_axis_reduce<0, 8, 6, 7>(); }
+
+TEST(AxisReduceTest, Height) { run_axis_reduce<1, 8, 6, 7>(); }
+
+TEST(AxisReduceTest, Width) { run_axis_reduce<2, 8, 6, 7>(); }
@@ -0,0 +1,87 @@
+#include <gtest/gtest.h>
+#include <vhn.hh>
+
+namespace {
+
+using config = vhn::ElementwiseConfig<1, 4, 4>;
+
+template <int AXIS, int D0, int D1, int D2> void run_broadcast() {
+  using shape = vhn::AxisShape<AXIS, D0, D1, D2>;
+  using add_t = vhn::BroadcastAdd<float, AXIS, D0, D1, D2>;
+  using mul_t = vhn::BroadcastMul<float, AXIS, D0, D1, D2, config,
+                                  OPT_ENABLED>;
+  constexpr int size = shape::size;
+
+  BaseTestCase generator;
+  static float input[size], operand[shape::reduced_size];
+  static float golden[size], output[size];
+  generator.generate_random_array(input, size);
+  generator.generate_random_array(operand, shape::reduced_size);
+
+  for (int o = 0; o < shape::outer; o++) {
+    for (int k = 0; k < shape::len; k++) {
+      for (int j = 0; j < shape::inner; j++) {
+        const int i = (o * shape::len + k) * shape::inner + j;
+        golden[i] = input[i] + operand[o * shape::inner + j];
+      }
+    }
+  }
+  add_t::elem(output, input, operand);
+  EXPECT_EQ(ResultComparator::compare(output, golden, size).max_abs_error,
+            0.0f);
+
+  for (int o = 0; o < shape::outer; o++) {
+    for (int k = 0; k < shape::len; k++) {
+      for (int j = 0; j < shape::inner; j++) {
+        const int i = (o * shape::len + k) * shape::inner + j;
+        golden[i] = input[i] * operand[o * shape::inner + j];
+      }
+    }
+  }
+  mul_t::elem(output, input, operand);
+  EXPECT_EQ(ResultComparator::compare(output, golden, size).max_abs_error,
+            0.0f);
+
+  vhn::stream<float> in_stream, out_stream;
+  for (int i = 0; i < size; i++) {
+    in_stream.write(input[i]);
+  }
+  mul_t::elem(out_stream, in_stream, operand);
+  for (int i = 0; i < size; i++) {
+    output[i] = out_stream.read();
+  }
+  EXPECT_EQ(ResultComparator::compare(output, golden, size).max_abs_error,
+            0.0f);
+}
+
+} // namespace
+
+// Bias add: one operand row repeated for every row.
+TEST(BroadcastTest, AlongRows) { run_broadcast<0, 9, 20, 1>(); }
+
+TEST(BroadcastTest, PerRow) { run_broadcast<1, 9, 20, 1>(); }
+
+// Per-channel scale of [C][H][W], viewed as [C][H * W].
+TEST(BroadcastTest, PerChannel) { run_broadcast<1, 4, 5 * 6, 1>(); }
+
+TEST(BroadcastTest, AlongChannels) { run_broadcast<0, 4, 5, 6>(); }
+
+// x - mean(x, axis) without materializing a transpose.
+TEST(BroadcastTest, CenterColumns) {
+  constexpr int kRows = 10;
+  constexpr int kCols = 12;
+  using mean_t = vhn::ReduceMeanAxis<float, 0, kRows, kCols>;
+  using sub_t = vhn::BroadcastSub<float, 0, kRows, kCols>;
+
+  BaseTestCase generator;
+  float input[kRows * kCols], mean[kCols], centered[kRows * kCols];
+  generator.generate_random_array(input, kRows * kCols);
+  mean_t::reduce(mean, input);
+  sub_t::elem(centered, input, mean);
+
+  float residual[kCols];
+  mean_t::reduce(residual, centered);
+  for (int c = 0; c < kCols; c++) {
+    EXPECT_NEAR(residual[c], 0.0f, 1e-6f);
+  }
+}
@@ -0,0 +1,111 @@
+#include <algorithm>
+#include <cmath>
+#include <gtest/gtest.h>
+#include <vhn.hh>
+
+namespace {
+
+constexpr int kN = 96;
+
+using elem_config = vhn::ElementwiseConfig<1, 2, 4>;
+
+template <OptLevel OPT>
+using config_for = std::conditional_t<OPT == OPT_NONE, void, elem_config>;
+
+// relu((x + a) * b) in a single pass against three separate passes.
+template <OptLevel OPT> void run_add_mul_relu() {
+  using fused_t = vhn::Fused<float, kN, config_for<OPT>, OPT, vhn::AddImpl,
+                             vhn::MulImpl, vhn::ReLUImpl>;
+  using add_t = vhn::Add<float, kN, void, OPT_NONE>;
+  using mul_t = vhn::Mul<float, kN, void, OPT_NONE>;
+  using relu_t = vhn::ReLU<float, kN, void, OPT_NONE>;
+
+  BaseTestCase generator;
+  float x[kN], a[kN], b[kN];
+  generator.generate_random_array(x, kN);
+  generator.generate_random_array(a, kN);
+  generator.generate_random_array(b, kN);
+
+  float t0[kN], t1[kN], golden[kN];
+  add_t::elem(t0, x, a);
+  mul_t::elem(t1, t0, b);
+  relu_t::elem(golden, t1);
+
+  float out[kN];
+  fused_t::elem(out, x, a, b);
+  for (int i = 0; i < kN; i++) {
+    ASSERT_EQ(out[i], golden[i]) << "index " << i;
+  }
+
+  // Scalar operands broadcast over the row.
+  fused_t::elem(out, x, a, 0.5f);
+  for (int i = 0; i < kN; i++) {
+    ASSERT_EQ(out[i], std::max((x[i] + a[i]) * 0.5f, 0.0f)) << "index " << i;
+  }
+}
+
+} // namespace
+
+TEST(FusedElementwiseTest, CountsOperands) {
+  using add_mul_relu =
+      vhn::FusedImpl<float, kN, vhn::AddImpl, vhn::MulImpl, vhn::ReLUImpl>;
+  using gelu_only = vhn::FusedImpl<float, kN, vhn::GeLUImpl>;
+  EXPECT_EQ(add_mul_relu::num_operands, 3);
+  EXPECT_EQ(gelu_only::num_operands, 1);
+  EXPECT_EQ(add_mul_relu::kernel(1.0f, 2.0f, -3.0f), 0.0f);
+  EXPECT_EQ(add_mul_relu::kernel(1.0f, 2.0f, 3.0f), 9.0f);
+}
+
+TEST(FusedElementwiseTest, AddMulReLUReference) {
+  run_add_mul_relu<OPT_NONE>();
+}
+
+TEST(FusedElementwiseTest, AddMulReLUOptimized) {
+  run_add_mul_relu<OPT_ENABLED>();
+}
+
+// Two-operand chains go through the existing elem overloads, batch included.
+TEST(FusedElementwiseTest, SubSigmoidBatch) {
+  constexpr int kBatch = 3;
+  using fused_t = vhn::Fused<float, kN, elem_config, OPT_ENABLED,
+                             vhn::SubImpl, vhn::SigmoidImpl>;
+
+  BaseTestCase generator;
+  float x[kBatch][kN], y[kBatch][kN], out[kBatch][kN];
+  generator.generate_random_array(&x[0][0], kBatch * kN);
+  generator.generate_random_array(&y[0][0], kBatch * kN);
+
+  fused_t::elem(out, x, y, kBatch);
+  for (int b = 0; b < kBatch; b++) {
+    for (int i = 0; i < kN; i++) {
+      const float golden = 1.0f / (1.0f + std::exp(-(x[b][i] - y[b][i])));
+      ASSERT_NEAR(out[b][i], golden, 1e-6f);
+    }
+  }
+}
+
+TEST(FusedElementwiseTest, StreamMatchesArray) {
+  using fused_t = vhn::Fused<float, kN, elem_config, OPT_ENABLED,
+                             vhn::MulImpl, vhn::AddImpl, vhn::GeLUImpl>;
+
+  BaseTestCase generator;
+  float x[kN], scale[kN], shift[kN], golden[kN];
+  generator.generate_random_array(x, kN);
+  generator.generate_random_array(scale, kN);
+  generator.generate_random_array(shift, kN);
+  fused_t::elem(golden, x, scale, shift);
+
+  vhn::stream<float> out_s, x_s, scale_s, shift_s;
+  for (int i = 0; i < kN; i++) {
+    x_s.write(x[i]);
+    scale_s.write(scale[i]);
+    shift_s.write(shift[i]);
+  }
+  fused_t::elem(out_s, x_s, scale_s, shift_s);
+
+  ASSERT_EQ(out_s.size(), kN);
+  for (int i = 0; i < kN; i++) {
+    ASSERT_EQ(out_s.read(), golden[i]) << "index " << i;
+  }
+  EXPECT_TRUE(x_s.empty() && scale_s.empty() && shift_s.empty());
+}
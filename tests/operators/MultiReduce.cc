@@ -0,0 +1,137 @@
+#include <cmath>
+#include <gtest/gtest.h>
+#include <vhn.hh>
+
+namespace {
+
+using config = vhn::ReduceConfig<1, 4, 4, true>;
+
+void golden_mean_var(const float *input, const int n, double &mean,
+                     double &variance) {
+  mean = 0.0;
+  for (int i = 0; i < n; i++) {
+    mean += input[i];
+  }
+  mean /= n;
+  variance = 0.0;
+  for (int i = 0; i < n; i++) {
+    variance += (input[i] - mean) * (input[i] - mean);
+  }
+  variance /= n;
+}
+
+// Welford and shifted sum/sum-of-squares against a double-precision golden,
+// for both the sequential and the partial-state path.
+template <int N> void run_mean_var(const float offset) {
+  using welford_t = vhn::ReduceWelford<float, N>;
+  using welford_opt_t = vhn::ReduceWelford<float, N, config, OPT_ENABLED>;
+  using sumsq_t = vhn::ReduceSumSq<float, N>;
+  using sumsq_opt_t = vhn::ReduceSumSq<float, N, config, OPT_ENABLED>;
+
+  BaseTestCase generator;
+  static float input[N];
+  generator.generate_random_array(input, N);
+  for (int i = 0; i < N; i++) {
+    input[i] += offset;
+  }
+
+  double mean, variance;
+  golden_mean_var(input, N, mean, variance);
+  const double mean_tol = 1e-5 * (1.0 + std::fabs(offset));
+  const double var_tol = 1e-3 * variance + 1e-6;
+
+  const vhn::MeanVar<float> results[] = {
+      welford_t::reduce(input), welford_opt_t::reduce(input),
+      sumsq_t::reduce(input), sumsq_opt_t::reduce(input)};
+  for (const auto &result : results) {
+    EXPECT_NEAR(result.mean, mean, mean_tol);
+    EXPECT_NEAR(result.variance, variance, var_tol);
+  }
+}
+
+} // namespace
+
+TEST(MultiReduceTest, MeanVarShort) { run_mean_var<5>(0.0f); }
+
+TEST(MultiReduceTest, MeanVarBlockAndTail) { run_mean_var<100>(0.0f); }
+
+// |mean| >> std: partial states must be merged without cancellation.
+TEST(MultiReduceTest, MeanVarLargeOffset) { run_mean_var<768>(1000.0f); }
+
+TEST(MultiReduceTest, MaxArgMax) {
+  constexpr int kN = 37;
+  using ref_t = vhn::ReduceMaxArgMax<float, kN>;
+  using opt_t = vhn::ReduceMaxArgMax<float, kN, config, OPT_ENABLED>;
+
+  float input[kN];
+  for (int i = 0; i < kN; i++) {
+    input[i] = -10.0f - i;
+  }
+  input[30] = -1.0f;
+  input[11] = -1.0f; // ties resolve to the first occurrence
+  input[19] = -1.0f;
+
+  const vhn::ValueIndex<float> ref = ref_t::reduce(input);
+  const vhn::ValueIndex<float> opt = opt_t::reduce(input);
+  EXPECT_EQ(ref.value, -1.0f);
+  EXPECT_EQ(ref.index, 11);
+  EXPECT_EQ(opt.value, -1.0f);
+  EXPECT_EQ(opt.index, 11);
+}
+
+TEST(MultiReduceTest, MaxSumExp) {
+  constexpr int kN = 129;
+  using ref_t = vhn::ReduceMaxSumExp<float, kN>;
+  using opt_t = vhn::ReduceMaxSumExp<float, kN, config, OPT_ENABLED>;
+
+  BaseTestCase generator;
+  float input[kN];
+  generator.generate_random_array(input, kN, 20.0f);
+
+  float max = input[0];
+  for (int i = 1; i < kN; i++) {
+    max = std::fmax(max, input[i]);
+  }
+  double sum = 0.0;
+  for (int i = 0; i < kN; i++) {
+    sum += std::exp(double(input[i]) - max);
+  }
+
+  const vhn::MaxSumExp<float> ref = ref_t::reduce(input);
+  const vhn::MaxSumExp<float> opt = opt_t::reduce(input);
+  EXPECT_EQ(ref.max, max);
+  EXPECT_EQ(opt.max, max);
+  EXPECT_NEAR(ref.sum, sum, 1e-5 * sum);
+  EXPECT_NEAR(opt.sum, sum, 1e-5 * sum);
+}
+
+TEST(MultiReduceTest, BatchAndStream) {
+  constexpr int kN = 50;
+  constexpr int kBatch = 3;
+  using ref_t = vhn::ReduceWelford<float, kN>;
+  using opt_t = vhn::ReduceWelford<float, kN, config, OPT_ENABLED>;
+
+  BaseTestCase generator;
+  float input[kBatch][kN];
+  generator.generate_random_array(&input[0][0], kBatch * kN);
+
+  vhn::MeanVar<float> ref[kBatch], opt[kBatch];
+  ref_t::reduce(ref, input, kBatch);
+  opt_t::reduce(opt, input, kBatch);
+
+  for (int b = 0; b < kBatch; b++) {
+    vhn::stream<float> ref_stream, opt_stream;
+    for (int i = 0; i < kN; i++) {
+      ref_stream.write(input[b][i]);
+      opt_stream.write(input[b][i]);
+    }
+    const vhn::MeanVar<float> ref_s = ref_t::reduce(ref_stream);
+    const vhn::MeanVar<float> opt_s = opt_t::reduce(opt_stream);
+
+    EXPECT_NEAR(opt[b].mean, ref[b].mean, 1e-5f);
+    EXPECT_NEAR(opt[b].variance, ref[b].variance, 1e-5f);
+    EXPECT_NEAR(ref_s.mean, ref[b].mean, 1e-6f);
+    EXPECT_NEAR(opt_s.mean, ref[b].mean, 1e-5f);
+    EXPECT_NEAR(opt_s.variance, ref[b].variance, 1e-5f);
+  }
+}
@@ -0,0 +1,72 @@
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <vhn.hh>
+
+namespace {
+
+using seq_config = vhn::ReduceConfig<1, 4, 4, false>;
+using tree_config = vhn::ReduceConfig<1, 4, 4, true>;
+
+// Checks the host multi-accumulator path against a double-precision golden
+// for lengths below, at and above one block of host_lanes.
+template <int N> void run_reduce(const float offset) {
+  using sum_t = vhn::ReduceSum<float, N, seq_config, OPT_ENABLED>;
+  using mean_t = vhn::ReduceMean<float, N, tree_config, OPT_ENABLED>;
+  using max_t = vhn::ReduceMax<float, N, tree_config, OPT_ENABLED>;
+  using min_t = vhn::ReduceMin<float, N, seq_config, OPT_ENABLED>;
+  using max_ref_t = vhn::ReduceMax<float, N>;
+
+  BaseTestCase generator;
+  static float input[N];
+  generator.generate_random_array(input, N);
+  for (int i = 0; i < N; i++) {
+    input[i] += offset;
+  }
+
+  double sum = 0.0;
+  for (int i = 0; i < N; i++) {
+    sum += input[i];
+  }
+  const float max = *std::max_element(input, input + N);
+  const float min = *std::min_element(input, input + N);
+
+  EXPECT_NEAR(sum_t::reduce(input), sum, 1e-5 * N);
+  EXPECT_NEAR(mean_t::reduce(input), sum / N, 1e-5);
+  EXPECT_EQ(max_t::reduce(input), max);
+  EXPECT_EQ(min_t::reduce(input), min);
+  EXPECT_EQ(max_ref_t::reduce(input), max);
+}
+
+} // namespace
+
+TEST(ReduceHostTest, Lanes) {
+  using reduce_t = vhn::ReduceSum<float, 1000, seq_config, OPT_ENABLED>;
+  using short_t = vhn::ReduceSum<float, 5, seq_config, OPT_ENABLED>;
+  EXPECT_EQ(reduce_t::host_lanes, 32);
+  EXPECT_EQ(short_t::host_lanes, 4);
+}
+
+TEST(ReduceHostTest, SingleElement) { run_reduce<1>(0.0f); }
+
+TEST(ReduceHostTest, ShorterThanBlock) { run_reduce<7>(0.0f); }
+
+TEST(ReduceHostTest, BlockAndTail) { run_reduce<100>(0.0f); }
+
+// All-negative rows: max / min must not be seeded with zero.
+TEST(ReduceHostTest, NegativeLargeRow) { run_reduce<1000>(-5.0f); }
+
+TEST(ReduceHostTest, Batch) {
+  constexpr int kN = 67;
+  constexpr int kBatch = 4;
+  using opt_t = vhn::ReduceSum<float, kN, tree_config, OPT_ENABLED>;
+  using ref_t = vhn::ReduceSum<float, kN>;
+
+  BaseTestCase generator;
+  float input[kBatch][kN], opt[kBatch], ref[kBatch];
+  generator.generate_random_array(&input[0][0], kBatch * kN);
+  opt_t::reduce(opt, input, kBatch);
+  ref_t::reduce(ref, input, kBatch);
+  for (int b = 0; b < kBatch; b++) {
+    EXPECT_NEAR(opt[b], ref[b], 1e-4f);
+  }
+}
@@ -0,0 +1,122 @@
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <numeric>
+#include <vhn.hh>
+
+namespace {
+
+using tree_config = vhn::TopKConfig<1, 4, 4, true>;
+using heap_config = vhn::TopKConfig<1, 4, 4, false>;
+
+// Stable descending sort: equal values keep the lower index first.
+void golden_topk(float *values, int *indices, const float *input, const int n,
+                 const int k) {
+  std::vector<int> order(n);
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin(), order.end(),
+                   [&](int a, int b) { return input[a] > input[b]; });
+  for (int s = 0; s < k; s++) {
+    values[s] = input[order[s]];
+    indices[s] = order[s];
+  }
+}
+
+template <typename TopKType>
+void expect_topk(const float *input, const float *golden_values,
+                 const int *golden_indices) {
+  constexpr int k = TopKType::k;
+  float values[k];
+  int indices[k];
+  TopKType::topk(values, indices, input);
+  for (int s = 0; s < k; s++) {
+    EXPECT_EQ(values[s], golden_values[s]) << "slot " << s;
+    EXPECT_EQ(indices[s], golden_indices[s]) << "slot " << s;
+  }
+
+  vhn::stream<float> input_stream;
+  for (int i = 0; i < TopKType::n; i++) {
+    input_stream.write(input[i]);
+  }
+  TopKType::topk(values, indices, input_stream);
+  for (int s = 0; s < k; s++) {
+    EXPECT_EQ(indices[s], golden_indices[s]) << "stream slot " << s;
+  }
+}
+
+template <int N, int K> void run_topk(const float *input) {
+  using hparams = vhn::TopKHParams<N, K>;
+  float values[K];
+  int indices[K];
+  golden_topk(values, indices, input, N, K);
+
+  expect_topk<vhn::TopK<float, hparams>>(input, values, indices);
+  expect_topk<vhn::TopK<float, hparams, tree_config, OPT_ENABLED>>(
+      input, values, indices);
+  expect_topk<vhn::TopK<float, hparams, heap_config, OPT_ENABLED>>(
+      input, values, indices);
+}
+
+template <int N, int K> void run_random_topk(const float offset) {
+  BaseTestCase generator;
+  static float input[N];
+  generator.generate_random_array(input, N);
+  for (int i = 0; i < N; i++) {
+    input[i] += offset;
+  }
+  run_topk<N, K>(input);
+}
+
+} // namespace
+
+TEST(TopKTest, Classifier) { run_random_topk<1000, 5>(0.0f); }
+
+TEST(TopKTest, AllNegative) { run_random_topk<333, 8>(-10.0f); }
+
+TEST(TopKTest, KEqualsN) { run_random_topk<7, 7>(0.0f); }
+
+TEST(TopKTest, SingleElement) { run_random_topk<1, 1>(0.0f); }
+
+TEST(TopKTest, Ties) {
+  constexpr int kN = 41;
+  float input[kN];
+  for (int i = 0; i < kN; i++) {
+    input[i] = float(i % 5);
+  }
+  run_topk<kN, 12>(input);
+}
+
+TEST(TopKTest, Batch) {
+  constexpr int kN = 64;
+  constexpr int kK = 3;
+  constexpr int kBatch = 4;
+  using topk_t = vhn::TopK<float, vhn::TopKHParams<kN, kK>, tree_config,
+                           OPT_ENABLED>;
+
+  BaseTestCase generator;
+  float input[kBatch][kN], values[kBatch][kK], golden_values[kK];
+  int indices[kBatch][kK], golden_indices[kK];
+  generator.generate_random_array(&input[0][0], kBatch * kN);
+  topk_t::topk(values, indices, input, kBatch);
+
+  for (int b = 0; b < kBatch; b++) {
+    golden_topk(golden_values, golden_indices, input[b], kN, kK);
+    for (int s = 0; s < kK; s++) {
+      EXPECT_EQ(values[b][s], golden_values[s]);
+      EXPECT_EQ(indices[b][s], golden_indices[s]);
+    }
+  }
+}
+
+TEST(TopKTest, ArgMax) {
+  constexpr int kN = 100;
+  using config = vhn::ReduceConfig<1, 4, 4, true>;
+  using argmax_t = vhn::ArgMax<float, kN, config, OPT_ENABLED>;
+
+  BaseTestCase generator;
+  float input[kN];
+  generator.generate_random_array(input, kN);
+  const int golden = int(std::max_element(input, input + kN) - input);
+
+  EXPECT_EQ(argmax_t::reduce(input).index, golden);
+  EXPECT_EQ((vhn::ArgMax<float, kN>::reduce(input).index), golden);
+}